@@ -23,6 +23,10 @@
 //
 
 use jni::{JNIEnv, objects::{JObject, JClass}};
+use jni::sys::{
+  self, jboolean, jbyte, jbyteArray, jchar, jclass, jdouble, jfieldID, jfloat, jint, jlong, jlongArray, jmethodID,
+  jobject, jobjectArray, jshort, jsize, jvalue,
+};
 
 /// Returns the value of the IMPL_LOOKUP field, throwing an exception if any error occurs 
 /// rather than killing the jvm.
@@ -69,3 +73,265 @@ pub fn throw_exception(env: JNIEnv, message: &str) {
     .and_then(|_| env.throw_new("dev/derklaro/reflexion/ReflexionException", message))
     .expect("unable to clear current and throw new exception");
 }
+
+/// Resolves the jfieldID of the given java.lang.reflect.Field. The id stays valid as long as
+/// the declaring class of the field is loaded, so it is resolved once when an accessor is created.
+///
+/// # Arguments
+///
+/// * `env`   - the current jni environment (pointer to the current running jvm).
+/// * `field` - the reflected field to resolve the id of.
+#[no_mangle]
+pub extern "system" fn Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_FieldId(env: JNIEnv, _ctx: JClass, field: jobject) -> jlong {
+  let raw = env.get_native_interface();
+  let field_id = unsafe { (**raw).FromReflectedField.unwrap()(raw, field) };
+  if field_id.is_null() {
+    throw_exception(env, "unable to resolve field id");
+    return 0;
+  }
+
+  field_id as jlong
+}
+
+/// Resolves the jmethodID of the given java.lang.reflect.Method or java.lang.reflect.Constructor.
+/// The id stays valid as long as the declaring class of the executable is loaded, so it is resolved
+/// once when an accessor is created.
+///
+/// # Arguments
+///
+/// * `env`        - the current jni environment (pointer to the current running jvm).
+/// * `executable` - the reflected method or constructor to resolve the id of.
+#[no_mangle]
+pub extern "system" fn Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_MethodId(env: JNIEnv, _ctx: JClass, executable: jobject) -> jlong {
+  let raw = env.get_native_interface();
+  let method_id = unsafe { (**raw).FromReflectedMethod.unwrap()(raw, executable) };
+  if method_id.is_null() {
+    throw_exception(env, "unable to resolve method id");
+    return 0;
+  }
+
+  method_id as jlong
+}
+
+/// Generates the typed get and set entry points for a field type. The getter reads the static
+/// field from the owner class if the given instance is null, the instance field otherwise. The
+/// setter works in the same way. The caller is responsible for passing an instance of the declaring
+/// class of the field and a value that is assignable to the field, no checks are done here.
+macro_rules! typed_field_access {
+  ($get_name:ident, $set_name:ident, $jtype:ty, $get:ident, $get_static:ident, $set:ident, $set_static:ident) => {
+    #[no_mangle]
+    pub extern "system" fn $get_name(env: JNIEnv, _ctx: JClass, instance: jobject, owner: jclass, field_id: jlong) -> $jtype {
+      let raw = env.get_native_interface();
+      unsafe {
+        if instance.is_null() {
+          (**raw).$get_static.unwrap()(raw, owner, field_id as jfieldID)
+        } else {
+          (**raw).$get.unwrap()(raw, instance, field_id as jfieldID)
+        }
+      }
+    }
+
+    #[no_mangle]
+    pub extern "system" fn $set_name(env: JNIEnv, _ctx: JClass, instance: jobject, owner: jclass, field_id: jlong, value: $jtype) {
+      let raw = env.get_native_interface();
+      unsafe {
+        if instance.is_null() {
+          (**raw).$set_static.unwrap()(raw, owner, field_id as jfieldID, value)
+        } else {
+          (**raw).$set.unwrap()(raw, instance, field_id as jfieldID, value)
+        }
+      }
+    }
+  };
+}
+
+typed_field_access!(
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_GetBooleanField,
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_SetBooleanField,
+  jboolean, GetBooleanField, GetStaticBooleanField, SetBooleanField, SetStaticBooleanField);
+typed_field_access!(
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_GetByteField,
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_SetByteField,
+  jbyte, GetByteField, GetStaticByteField, SetByteField, SetStaticByteField);
+typed_field_access!(
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_GetCharField,
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_SetCharField,
+  jchar, GetCharField, GetStaticCharField, SetCharField, SetStaticCharField);
+typed_field_access!(
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_GetShortField,
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_SetShortField,
+  jshort, GetShortField, GetStaticShortField, SetShortField, SetStaticShortField);
+typed_field_access!(
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_GetIntField,
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_SetIntField,
+  jint, GetIntField, GetStaticIntField, SetIntField, SetStaticIntField);
+typed_field_access!(
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_GetLongField,
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_SetLongField,
+  jlong, GetLongField, GetStaticLongField, SetLongField, SetStaticLongField);
+typed_field_access!(
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_GetFloatField,
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_SetFloatField,
+  jfloat, GetFloatField, GetStaticFloatField, SetFloatField, SetStaticFloatField);
+typed_field_access!(
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_GetDoubleField,
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_SetDoubleField,
+  jdouble, GetDoubleField, GetStaticDoubleField, SetDoubleField, SetStaticDoubleField);
+typed_field_access!(
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_GetObjectField,
+  Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_SetObjectField,
+  jobject, GetObjectField, GetStaticObjectField, SetObjectField, SetStaticObjectField);
+
+/// Reads the primitive instance fields with the given ids of the given object into the given output
+/// array in a single jni transition. Each value is stored as raw bits: integral values are widened
+/// to a long, floats and doubles are stored as their raw ieee 754 bits.
+///
+/// # Arguments
+///
+/// * `env`       - the current jni environment (pointer to the current running jvm).
+/// * `instance`  - the object to read the fields of, must not be null.
+/// * `field_ids` - the ids of the fields to read.
+/// * `kinds`     - the jvm type descriptor char of each field, must have the same length as the ids.
+/// * `out`       - the array to write the values into, must be at least as long as the ids.
+#[no_mangle]
+pub extern "system" fn Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_ReadFields(env: JNIEnv, _ctx: JClass, instance: jobject, field_ids: jlongArray, kinds: jbyteArray, out: jlongArray) {
+  let raw = env.get_native_interface();
+  unsafe {
+    let count = (**raw).GetArrayLength.unwrap()(raw, field_ids);
+    let mut ids = vec![0 as jlong; count as usize];
+    let mut types = vec![0 as jbyte; count as usize];
+    (**raw).GetLongArrayRegion.unwrap()(raw, field_ids, 0, count, ids.as_mut_ptr());
+    (**raw).GetByteArrayRegion.unwrap()(raw, kinds, 0, count, types.as_mut_ptr());
+
+    let mut values = vec![0 as jlong; count as usize];
+    for index in 0..count as usize {
+      values[index] = read_raw_field(raw, instance, ids[index] as jfieldID, types[index] as u8);
+    }
+    (**raw).SetLongArrayRegion.unwrap()(raw, out, 0, count, values.as_ptr());
+  }
+}
+
+/// Reads the raw bits of a primitive instance field, see `ReadFields` for the encoding.
+unsafe fn read_raw_field(raw: *mut sys::JNIEnv, instance: jobject, field_id: jfieldID, kind: u8) -> jlong {
+  match kind {
+    b'Z' => (**raw).GetBooleanField.unwrap()(raw, instance, field_id) as jlong,
+    b'B' => (**raw).GetByteField.unwrap()(raw, instance, field_id) as jlong,
+    b'C' => (**raw).GetCharField.unwrap()(raw, instance, field_id) as jlong,
+    b'S' => (**raw).GetShortField.unwrap()(raw, instance, field_id) as jlong,
+    b'I' => (**raw).GetIntField.unwrap()(raw, instance, field_id) as jlong,
+    b'J' => (**raw).GetLongField.unwrap()(raw, instance, field_id),
+    b'F' => (**raw).GetFloatField.unwrap()(raw, instance, field_id).to_bits() as jlong,
+    b'D' => (**raw).GetDoubleField.unwrap()(raw, instance, field_id).to_bits() as jlong,
+    _ => 0,
+  }
+}
+
+/// Builds the jni argument array for a method or constructor call. Primitive arguments are taken
+/// from the raw bits array (encoded like the values of `ReadFields`), reference arguments from the
+/// argument array, both indexed by the parameter position.
+unsafe fn build_arguments(raw: *mut sys::JNIEnv, kinds: jbyteArray, args: jobjectArray, prims: jlongArray) -> Vec<jvalue> {
+  let count = (**raw).GetArrayLength.unwrap()(raw, kinds);
+  let mut types = vec![0 as jbyte; count as usize];
+  (**raw).GetByteArrayRegion.unwrap()(raw, kinds, 0, count, types.as_mut_ptr());
+
+  // the raw bits are only passed if at least one parameter is primitive
+  let mut bits = vec![0 as jlong; count as usize];
+  if !prims.is_null() {
+    (**raw).GetLongArrayRegion.unwrap()(raw, prims, 0, count, bits.as_mut_ptr());
+  }
+
+  (**raw).EnsureLocalCapacity.unwrap()(raw, count);
+  let mut arguments = Vec::with_capacity(count as usize);
+  for index in 0..count as usize {
+    let value = bits[index];
+    arguments.push(match types[index] as u8 {
+      b'Z' => jvalue { z: (value != 0) as jboolean },
+      b'B' => jvalue { b: value as jbyte },
+      b'C' => jvalue { c: value as jchar },
+      b'S' => jvalue { s: value as jshort },
+      b'I' => jvalue { i: value as jint },
+      b'J' => jvalue { j: value },
+      b'F' => jvalue { f: f32::from_bits(value as u32) },
+      b'D' => jvalue { d: f64::from_bits(value as u64) },
+      _ => jvalue { l: (**raw).GetObjectArrayElement.unwrap()(raw, args, index as jsize) },
+    });
+  }
+  arguments
+}
+
+/// Calls the method with the given id which returns a reference type (or void). The static method
+/// is called on the owner class if the given instance is null, the instance method is called
+/// virtually otherwise. Exceptions thrown by the method stay pending and are rethrown as-is once
+/// the call returns to java.
+///
+/// # Arguments
+///
+/// * `env`       - the current jni environment (pointer to the current running jvm).
+/// * `instance`  - the instance to call the method on, null for static methods.
+/// * `owner`     - the declaring class of the method.
+/// * `method_id` - the id of the method to call.
+/// * `kinds`     - the jvm type descriptor char of each parameter.
+/// * `args`      - the arguments of the call, only reference arguments are read.
+/// * `prims`     - the raw bits of the primitive arguments, null if no parameter is primitive.
+#[no_mangle]
+pub extern "system" fn Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_CallObjectMethod(env: JNIEnv, _ctx: JClass, instance: jobject, owner: jclass, method_id: jlong, kinds: jbyteArray, args: jobjectArray, prims: jlongArray) -> jobject {
+  let raw = env.get_native_interface();
+  unsafe {
+    let arguments = build_arguments(raw, kinds, args, prims);
+    let method_id = method_id as jmethodID;
+    if instance.is_null() {
+      (**raw).CallStaticObjectMethodA.unwrap()(raw, owner, method_id, arguments.as_ptr())
+    } else {
+      (**raw).CallObjectMethodA.unwrap()(raw, instance, method_id, arguments.as_ptr())
+    }
+  }
+}
+
+/// Calls the static or instance method with the given function pair, depending on the instance.
+macro_rules! call_method {
+  ($raw:expr, $instance:expr, $owner:expr, $method_id:expr, $args:expr, $call:ident, $call_static:ident) => {
+    if $instance.is_null() {
+      (**$raw).$call_static.unwrap()($raw, $owner, $method_id, $args)
+    } else {
+      (**$raw).$call.unwrap()($raw, $instance, $method_id, $args)
+    }
+  };
+}
+
+/// Calls the method with the given id which returns a primitive type, returning the raw bits of
+/// the result (encoded like the values of `ReadFields`). See `CallObjectMethod` for the arguments,
+/// the return kind is the jvm type descriptor char of the return type.
+#[no_mangle]
+pub extern "system" fn Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_CallPrimitiveMethod(env: JNIEnv, _ctx: JClass, instance: jobject, owner: jclass, method_id: jlong, return_kind: jbyte, kinds: jbyteArray, args: jobjectArray, prims: jlongArray) -> jlong {
+  let raw = env.get_native_interface();
+  unsafe {
+    let arguments = build_arguments(raw, kinds, args, prims);
+    let args = arguments.as_ptr();
+    let id = method_id as jmethodID;
+    match return_kind as u8 {
+      b'Z' => call_method!(raw, instance, owner, id, args, CallBooleanMethodA, CallStaticBooleanMethodA) as jlong,
+      b'B' => call_method!(raw, instance, owner, id, args, CallByteMethodA, CallStaticByteMethodA) as jlong,
+      b'C' => call_method!(raw, instance, owner, id, args, CallCharMethodA, CallStaticCharMethodA) as jlong,
+      b'S' => call_method!(raw, instance, owner, id, args, CallShortMethodA, CallStaticShortMethodA) as jlong,
+      b'I' => call_method!(raw, instance, owner, id, args, CallIntMethodA, CallStaticIntMethodA) as jlong,
+      b'J' => call_method!(raw, instance, owner, id, args, CallLongMethodA, CallStaticLongMethodA),
+      b'F' => call_method!(raw, instance, owner, id, args, CallFloatMethodA, CallStaticFloatMethodA).to_bits() as jlong,
+      b'D' => call_method!(raw, instance, owner, id, args, CallDoubleMethodA, CallStaticDoubleMethodA).to_bits() as jlong,
+      _ => {
+        call_method!(raw, instance, owner, id, args, CallVoidMethodA, CallStaticVoidMethodA);
+        0
+      }
+    }
+  }
+}
+
+/// Constructs a new instance of the owner class using the constructor with the given id. See
+/// `CallObjectMethod` for the arguments.
+#[no_mangle]
+pub extern "system" fn Java_dev_derklaro_reflexion_internal_natives_FNativeReflect_NewObject(env: JNIEnv, _ctx: JClass, owner: jclass, method_id: jlong, kinds: jbyteArray, args: jobjectArray, prims: jlongArray) -> jobject {
+  let raw = env.get_native_interface();
+  unsafe {
+    let arguments = build_arguments(raw, kinds, args, prims);
+    (**raw).NewObjectA.unwrap()(raw, owner, method_id as jmethodID, arguments.as_ptr())
+  }
+}
@@ -0,0 +1,327 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.processor;
+
+import dev.derklaro.reflexion.processor.ResolvedTarget.MemberKind;
+import dev.derklaro.reflexion.processor.ResolvedTarget.ResolvedMember;
+import java.io.IOException;
+import java.io.Writer;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import javax.annotation.processing.Filer;
+import javax.lang.model.element.Element;
+import javax.lang.model.element.TypeElement;
+import javax.lang.model.type.ArrayType;
+import javax.lang.model.type.DeclaredType;
+import javax.lang.model.type.TypeKind;
+import javax.lang.model.type.TypeMirror;
+import javax.lang.model.util.Elements;
+import javax.tools.FileObject;
+import javax.tools.JavaFileObject;
+import javax.tools.StandardLocation;
+import org.jetbrains.annotations.NotNull;
+
+/**
+ * Internal: writes the accessor class and the native-image reflection configuration of a resolved target.
+ *
+ * @since 1.4
+ */
+final class AccessorClassWriter {
+
+  static final String REFLEXION_CONSTANT = "REFLEXION";
+
+  private static final String NATIVE_IMAGE_CONFIG_DIRECTORY = "META-INF/native-image/reflexion/";
+
+  private final Filer filer;
+  private final Elements elements;
+
+  /**
+   * Constructs a new accessor class writer.
+   *
+   * @param filer    the filer to create the generated files with.
+   * @param elements the element utilities of the current processing environment.
+   */
+  AccessorClassWriter(@NotNull Filer filer, @NotNull Elements elements) {
+    this.filer = filer;
+    this.elements = elements;
+  }
+
+  /**
+   * Writes the accessor class and the native-image reflection configuration of the given target.
+   *
+   * @param target     the target to write the files for.
+   * @param originator the element which declared the target.
+   * @throws IOException if an I/O error occurs while writing one of the files.
+   */
+  void write(@NotNull ResolvedTarget target, @NotNull Element originator) throws IOException {
+    JavaFileObject source = this.filer.createSourceFile(target.qualifiedClassName(), originator);
+    try (Writer writer = source.openWriter()) {
+      writer.write(this.accessorClassSource(target));
+    }
+
+    String configPath = NATIVE_IMAGE_CONFIG_DIRECTORY + target.qualifiedClassName() + "/reflect-config.json";
+    FileObject config = this.filer.createResource(StandardLocation.CLASS_OUTPUT, "", configPath, originator);
+    try (Writer writer = config.openWriter()) {
+      writer.write(this.reflectionConfig(target));
+    }
+  }
+
+  /**
+   * Generates the source code of the accessor class of the given target. All members are resolved directly in the
+   * static initializer of the generated class and wrapped using the default reflexion instance of the target class.
+   *
+   * @param target the target to generate the accessor class of.
+   * @return the source code of the accessor class.
+   */
+  private @NotNull String accessorClassSource(@NotNull ResolvedTarget target) {
+    StringBuilder source = new StringBuilder();
+    if (!target.outputPackage.isUnnamed()) {
+      source.append("package ").append(target.outputPackage.getQualifiedName()).append(";\n\n");
+    }
+
+    source
+      .append("import dev.derklaro.reflexion.FieldAccessor;\n")
+      .append("import dev.derklaro.reflexion.MethodAccessor;\n")
+      .append("import dev.derklaro.reflexion.Reflexion;\n")
+      .append("import java.lang.reflect.Constructor;\n")
+      .append("import java.lang.reflect.Method;\n\n")
+      .append("/**\n")
+      .append(" * Accessors for the members of {@code ").append(target.targetClass.getQualifiedName()).append("}.\n")
+      .append(" * Generated by the reflexion annotation processor, do not edit.\n")
+      .append(" */\n")
+      .append("public final class ").append(target.className).append(" {\n\n")
+      .append("  public static final Reflexion ").append(REFLEXION_CONSTANT).append(";\n");
+
+    for (ResolvedMember member : target.members) {
+      source.append("  public static final ").append(accessorType(member.kind)).append(' ')
+        .append(member.constantName).append(";\n");
+    }
+
+    source
+      .append("\n  static {\n")
+      .append("    try {\n")
+      .append("      ClassLoader loader = ").append(target.className).append(".class.getClassLoader();\n")
+      .append("      ").append(REFLEXION_CONSTANT).append(" = Reflexion.on(")
+      .append(this.classExpression(target.targetClass.asType())).append(");\n");
+
+    for (ResolvedMember member : target.members) {
+      source.append("      ").append(member.constantName).append(" = ").append(REFLEXION_CONSTANT).append(".wrap(")
+        .append(this.classExpression(member.declaringClass.asType()));
+      switch (member.kind) {
+        case FIELD:
+          source.append(".getDeclaredField(\"").append(member.name).append("\")");
+          break;
+        case METHOD:
+          source.append(".getDeclaredMethod(\"").append(member.name).append('"');
+          this.appendParameterTypes(source, member.parameterTypes, true);
+          source.append(')');
+          break;
+        case CONSTRUCTOR:
+          source.append(".getDeclaredConstructor(");
+          this.appendParameterTypes(source, member.parameterTypes, false);
+          source.append(')');
+          break;
+        default:
+          throw new IllegalArgumentException("Unsupported member kind " + member.kind);
+      }
+      source.append(");\n");
+    }
+
+    return source
+      .append("    } catch (ReflectiveOperationException exception) {\n")
+      .append("      throw new ExceptionInInitializerError(exception);\n")
+      .append("    }\n")
+      .append("  }\n\n")
+      .append("  private ").append(target.className).append("() {\n")
+      .append("    throw new UnsupportedOperationException();\n")
+      .append("  }\n")
+      .append("}\n")
+      .toString();
+  }
+
+  /**
+   * Generates the native-image reflection configuration for all members of the given target, grouped by their
+   * declaring class. Parameter types are registered as well as they are loaded reflectively by the accessor class.
+   *
+   * @param target the target to generate the reflection configuration of.
+   * @return the reflection configuration json of the given target.
+   */
+  private @NotNull String reflectionConfig(@NotNull ResolvedTarget target) {
+    Map<String, List<String>> fields = new LinkedHashMap<>();
+    Map<String, List<String>> methods = new LinkedHashMap<>();
+    fields.put(this.configTypeName(target.targetClass.asType()), new ArrayList<>());
+
+    for (ResolvedMember member : target.members) {
+      String declaringClass = this.configTypeName(member.declaringClass.asType());
+      if (member.kind == MemberKind.FIELD) {
+        fields.computeIfAbsent(declaringClass, key -> new ArrayList<>()).add("{\"name\":\"" + member.name + "\"}");
+        continue;
+      }
+
+      StringBuilder method = new StringBuilder("{\"name\":\"").append(member.name).append("\",\"parameterTypes\":[");
+      for (int i = 0; i < member.parameterTypes.size(); i++) {
+        TypeMirror parameterType = member.parameterTypes.get(i);
+        method.append(i == 0 ? "" : ",").append('"').append(this.configTypeName(parameterType)).append('"');
+        if (!parameterType.getKind().isPrimitive()) {
+          fields.putIfAbsent(this.configTypeName(parameterType), new ArrayList<>());
+        }
+      }
+      fields.putIfAbsent(declaringClass, new ArrayList<>());
+      methods.computeIfAbsent(declaringClass, key -> new ArrayList<>()).add(method.append("]}").toString());
+    }
+
+    StringBuilder config = new StringBuilder("[\n");
+    int entry = 0;
+    for (Map.Entry<String, List<String>> classFields : fields.entrySet()) {
+      List<String> classMethods = methods.getOrDefault(classFields.getKey(), new ArrayList<>());
+      config
+        .append(entry++ == 0 ? "" : ",\n")
+        .append("  {\n    \"name\": \"").append(classFields.getKey()).append('"')
+        .append(",\n    \"fields\": [").append(String.join(", ", classFields.getValue())).append(']')
+        .append(",\n    \"methods\": [").append(String.join(", ", classMethods)).append("]\n  }");
+    }
+    return config.append("\n]\n").toString();
+  }
+
+  /**
+   * Appends the class expressions of the given parameter types to the given source.
+   *
+   * @param source         the source to append the parameter types to.
+   * @param parameterTypes the parameter types to append.
+   * @param leadingComma   if a comma should be appended before the first parameter type.
+   */
+  private void appendParameterTypes(
+    @NotNull StringBuilder source,
+    @NotNull List<TypeMirror> parameterTypes,
+    boolean leadingComma
+  ) {
+    for (int i = 0; i < parameterTypes.size(); i++) {
+      if (leadingComma || i > 0) {
+        source.append(", ");
+      }
+      source.append(this.classExpression(parameterTypes.get(i)));
+    }
+  }
+
+  /**
+   * Get a java expression which evaluates to the class object of the given type. Primitive types are referenced as
+   * class literals, all other types are loaded by their binary name as they might not be accessible from the
+   * generated class.
+   *
+   * @param type the type to get the class expression for.
+   * @return a java expression evaluating to the class object of the given type.
+   */
+  private @NotNull String classExpression(@NotNull TypeMirror type) {
+    if (type.getKind().isPrimitive()) {
+      return type.toString() + ".class";
+    } else {
+      return "Class.forName(\"" + this.binaryName(type) + "\", false, loader)";
+    }
+  }
+
+  /**
+   * Get the name of the given type as returned by {@link Class#getName()}.
+   *
+   * @param type the reference type to get the binary name of.
+   * @return the binary name of the given type.
+   */
+  private @NotNull String binaryName(@NotNull TypeMirror type) {
+    if (type.getKind() == TypeKind.ARRAY) {
+      return "[" + this.descriptor(((ArrayType) type).getComponentType());
+    } else {
+      return this.elements.getBinaryName((TypeElement) ((DeclaredType) type).asElement()).toString();
+    }
+  }
+
+  /**
+   * Get the jvm type descriptor of the given type, for example {@code I} or {@code Ljava/lang/String;}, using dots
+   * as separators as used by {@link Class#forName(String)}.
+   *
+   * @param type the type to get the descriptor of.
+   * @return the descriptor of the given type.
+   */
+  private @NotNull String descriptor(@NotNull TypeMirror type) {
+    switch (type.getKind()) {
+      case BOOLEAN:
+        return "Z";
+      case BYTE:
+        return "B";
+      case SHORT:
+        return "S";
+      case CHAR:
+        return "C";
+      case INT:
+        return "I";
+      case LONG:
+        return "J";
+      case FLOAT:
+        return "F";
+      case DOUBLE:
+        return "D";
+      case ARRAY:
+        return "[" + this.descriptor(((ArrayType) type).getComponentType());
+      default:
+        return "L" + this.binaryName(type) + ";";
+    }
+  }
+
+  /**
+   * Get the name of the given type as used in the native-image reflection configuration, for example
+   * {@code int[]} or {@code java.util.Map$Entry}.
+   *
+   * @param type the type to get the configuration name of.
+   * @return the configuration name of the given type.
+   */
+  private @NotNull String configTypeName(@NotNull TypeMirror type) {
+    if (type.getKind() == TypeKind.ARRAY) {
+      return this.configTypeName(((ArrayType) type).getComponentType()) + "[]";
+    } else if (type.getKind().isPrimitive()) {
+      return type.toString();
+    } else {
+      return this.binaryName(type);
+    }
+  }
+
+  /**
+   * Get the simple name of the accessor type used for members of the given kind.
+   *
+   * @param kind the kind of member to get the accessor type for.
+   * @return the simple name of the accessor type for the given member kind.
+   */
+  private static @NotNull String accessorType(@NotNull MemberKind kind) {
+    switch (kind) {
+      case FIELD:
+        return "FieldAccessor";
+      case METHOD:
+        return "MethodAccessor<Method>";
+      case CONSTRUCTOR:
+        return "MethodAccessor<Constructor<?>>";
+      default:
+        throw new IllegalArgumentException("Unsupported member kind " + kind);
+    }
+  }
+}
@@ -0,0 +1,47 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.processor;
+
+import org.jetbrains.annotations.NotNull;
+
+/**
+ * Internal: thrown when a declared reflexion target cannot be processed. The message is reported as a compile error on
+ * the annotated element.
+ *
+ * @since 1.4
+ */
+final class ProcessingException extends Exception {
+
+  private static final long serialVersionUID = 3871092230723188724L;
+
+  /**
+   * Constructs a new processing exception.
+   *
+   * @param message the message describing why the target could not be processed.
+   */
+  ProcessingException(@NotNull String message) {
+    super(message, null, false, false);
+  }
+}
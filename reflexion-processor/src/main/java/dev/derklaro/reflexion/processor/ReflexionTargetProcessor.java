@@ -0,0 +1,114 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.processor;
+
+import dev.derklaro.reflexion.annotation.ReflexionTarget;
+import dev.derklaro.reflexion.annotation.ReflexionTargets;
+import java.io.IOException;
+import java.util.Collections;
+import java.util.HashSet;
+import java.util.LinkedHashSet;
+import java.util.Set;
+import javax.annotation.processing.AbstractProcessor;
+import javax.annotation.processing.ProcessingEnvironment;
+import javax.annotation.processing.RoundEnvironment;
+import javax.lang.model.SourceVersion;
+import javax.lang.model.element.Element;
+import javax.lang.model.element.TypeElement;
+import javax.tools.Diagnostic;
+import org.jetbrains.annotations.NotNull;
+
+/**
+ * An annotation processor which generates accessor classes for all classes declared using {@link ReflexionTarget}.
+ * Each generated class resolves the declared members once in its static initializer and exposes them as accessor
+ * constants, which avoids the class hierarchy travel and matcher evaluation of a runtime lookup. Members which cannot
+ * be resolved at compile time are reported as compile errors on the annotated element.
+ *
+ * @since 1.4
+ */
+public final class ReflexionTargetProcessor extends AbstractProcessor {
+
+  private TargetResolver resolver;
+  private AccessorClassWriter writer;
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public synchronized void init(@NotNull ProcessingEnvironment processingEnv) {
+    super.init(processingEnv);
+    this.resolver = new TargetResolver(processingEnv.getTypeUtils(), processingEnv.getElementUtils());
+    this.writer = new AccessorClassWriter(processingEnv.getFiler(), processingEnv.getElementUtils());
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NotNull Set<String> getSupportedAnnotationTypes() {
+    Set<String> supportedTypes = new HashSet<>();
+    supportedTypes.add(ReflexionTarget.class.getCanonicalName());
+    supportedTypes.add(ReflexionTargets.class.getCanonicalName());
+    return Collections.unmodifiableSet(supportedTypes);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NotNull SourceVersion getSupportedSourceVersion() {
+    return SourceVersion.latestSupported();
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public boolean process(@NotNull Set<? extends TypeElement> annotations, @NotNull RoundEnvironment roundEnv) {
+    // repeated annotations are wrapped in the container annotation, collect the elements annotated with either
+    Set<Element> annotatedElements = new LinkedHashSet<>();
+    annotatedElements.addAll(roundEnv.getElementsAnnotatedWith(ReflexionTarget.class));
+    annotatedElements.addAll(roundEnv.getElementsAnnotatedWith(ReflexionTargets.class));
+
+    for (Element element : annotatedElements) {
+      for (ReflexionTarget target : element.getAnnotationsByType(ReflexionTarget.class)) {
+        try {
+          ResolvedTarget resolvedTarget = this.resolver.resolve(element, target);
+          this.writer.write(resolvedTarget, element);
+        } catch (ProcessingException exception) {
+          this.processingEnv.getMessager().printMessage(Diagnostic.Kind.ERROR, exception.getMessage(), element);
+        } catch (IOException exception) {
+          this.processingEnv.getMessager().printMessage(
+            Diagnostic.Kind.ERROR,
+            "Unable to write accessor class for " + target.clazz() + ": " + exception.getMessage(),
+            element);
+        }
+      }
+    }
+
+    // the annotations are only relevant for this processor
+    return true;
+  }
+}
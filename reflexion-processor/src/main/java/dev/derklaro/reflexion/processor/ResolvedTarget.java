@@ -0,0 +1,137 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.processor;
+
+import java.util.List;
+import javax.lang.model.element.PackageElement;
+import javax.lang.model.element.TypeElement;
+import javax.lang.model.type.TypeMirror;
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Unmodifiable;
+
+/**
+ * Internal: a reflexion target of which all declared members were resolved, ready to be written into an accessor
+ * class.
+ *
+ * @since 1.4
+ */
+final class ResolvedTarget {
+
+  final PackageElement outputPackage;
+  final String className;
+  final TypeElement targetClass;
+  final List<ResolvedMember> members;
+
+  /**
+   * Constructs a new resolved target.
+   *
+   * @param outputPackage the package to generate the accessor class in.
+   * @param className     the simple name of the accessor class to generate.
+   * @param targetClass   the class which was declared as the target.
+   * @param members       the resolved members to generate accessors for.
+   */
+  ResolvedTarget(
+    @NotNull PackageElement outputPackage,
+    @NotNull String className,
+    @NotNull TypeElement targetClass,
+    @NotNull @Unmodifiable List<ResolvedMember> members
+  ) {
+    this.outputPackage = outputPackage;
+    this.className = className;
+    this.targetClass = targetClass;
+    this.members = members;
+  }
+
+  /**
+   * Get the fully qualified name of the accessor class to generate.
+   *
+   * @return the fully qualified name of the accessor class to generate.
+   */
+  @NotNull String qualifiedClassName() {
+    if (this.outputPackage.isUnnamed()) {
+      return this.className;
+    } else {
+      return this.outputPackage.getQualifiedName() + "." + this.className;
+    }
+  }
+
+  /**
+   * The kinds of members an accessor can be generated for.
+   *
+   * @since 1.4
+   */
+  enum MemberKind {
+
+    /**
+     * A field, wrapped into a field accessor.
+     */
+    FIELD,
+    /**
+     * A method, wrapped into a method accessor.
+     */
+    METHOD,
+    /**
+     * A constructor, wrapped into a method accessor.
+     */
+    CONSTRUCTOR
+  }
+
+  /**
+   * Internal: a single member of a target which was resolved at compile time.
+   *
+   * @since 1.4
+   */
+  static final class ResolvedMember {
+
+    final MemberKind kind;
+    final String constantName;
+    final TypeElement declaringClass;
+    final String name;
+    final List<TypeMirror> parameterTypes;
+
+    /**
+     * Constructs a new resolved member.
+     *
+     * @param kind           the kind of the member.
+     * @param constantName   the name of the constant holding the accessor in the generated class.
+     * @param declaringClass the class which declares the member.
+     * @param name           the name of the member, {@code <init>} for constructors.
+     * @param parameterTypes the erased parameter types of the member, empty for fields.
+     */
+    ResolvedMember(
+      @NotNull MemberKind kind,
+      @NotNull String constantName,
+      @NotNull TypeElement declaringClass,
+      @NotNull String name,
+      @NotNull @Unmodifiable List<TypeMirror> parameterTypes
+    ) {
+      this.kind = kind;
+      this.constantName = constantName;
+      this.declaringClass = declaringClass;
+      this.name = name;
+      this.parameterTypes = parameterTypes;
+    }
+  }
+}
@@ -0,0 +1,447 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.processor;
+
+import dev.derklaro.reflexion.annotation.ReflexionTarget;
+import dev.derklaro.reflexion.processor.ResolvedTarget.MemberKind;
+import dev.derklaro.reflexion.processor.ResolvedTarget.ResolvedMember;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Deque;
+import java.util.HashSet;
+import java.util.LinkedHashSet;
+import java.util.List;
+import java.util.Locale;
+import java.util.Set;
+import javax.lang.model.element.Element;
+import javax.lang.model.element.ExecutableElement;
+import javax.lang.model.element.TypeElement;
+import javax.lang.model.element.VariableElement;
+import javax.lang.model.type.ArrayType;
+import javax.lang.model.type.DeclaredType;
+import javax.lang.model.type.TypeKind;
+import javax.lang.model.type.TypeMirror;
+import javax.lang.model.util.ElementFilter;
+import javax.lang.model.util.Elements;
+import javax.lang.model.util.Types;
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: resolves the members declared in a reflexion target annotation against the types known to the compiler.
+ *
+ * @since 1.4
+ */
+final class TargetResolver {
+
+  private static final String ACCESSOR_CLASS_SUFFIX = "Accessors";
+
+  private final Types types;
+  private final Elements elements;
+
+  /**
+   * Constructs a new target resolver.
+   *
+   * @param types    the type utilities of the current processing environment.
+   * @param elements the element utilities of the current processing environment.
+   */
+  TargetResolver(@NotNull Types types, @NotNull Elements elements) {
+    this.types = types;
+    this.elements = elements;
+  }
+
+  /**
+   * Resolves all members declared by the given target annotation.
+   *
+   * @param annotatedElement the element which is annotated with the target annotation.
+   * @param target           the target annotation to resolve.
+   * @return the resolved target.
+   * @throws ProcessingException if the target class or one of the declared members cannot be resolved.
+   */
+  @NotNull ResolvedTarget resolve(
+    @NotNull Element annotatedElement,
+    @NotNull ReflexionTarget target
+  ) throws ProcessingException {
+    TypeElement targetClass = this.elements.getTypeElement(target.clazz());
+    if (targetClass == null) {
+      throw new ProcessingException("Unable to find target class " + target.clazz() + " on the compile classpath");
+    }
+
+    String className = target.name().isEmpty()
+      ? targetClass.getSimpleName() + ACCESSOR_CLASS_SUFFIX
+      : target.name();
+
+    // resolve all declared members, the constant names must be unique in the generated class
+    List<ResolvedMember> members = new ArrayList<>();
+    for (String field : target.fields()) {
+      members.add(this.resolveField(targetClass, field));
+    }
+    for (String method : target.methods()) {
+      members.add(this.resolveMethod(targetClass, method));
+    }
+    for (String constructor : target.constructors()) {
+      members.add(this.resolveConstructor(targetClass, constructor));
+    }
+
+    Set<String> constantNames = new HashSet<>();
+    constantNames.add(AccessorClassWriter.REFLEXION_CONSTANT);
+    for (ResolvedMember member : members) {
+      if (!constantNames.add(member.constantName)) {
+        throw new ProcessingException(String.format(
+          "Duplicate accessor constant %s in %s, declare the members with their parameter types or split the target",
+          member.constantName,
+          className));
+      }
+    }
+
+    return new ResolvedTarget(
+      this.elements.getPackageOf(annotatedElement),
+      className,
+      targetClass,
+      Collections.unmodifiableList(members));
+  }
+
+  /**
+   * Resolves the field with the given name which is declared closest to the given target class.
+   *
+   * @param targetClass the target class to start the search in.
+   * @param name        the name of the field to resolve.
+   * @return the resolved field.
+   * @throws ProcessingException if no field with the given name exists in the class hierarchy.
+   */
+  private @NotNull ResolvedMember resolveField(
+    @NotNull TypeElement targetClass,
+    @NotNull String name
+  ) throws ProcessingException {
+    for (TypeElement type : this.superClasses(targetClass)) {
+      for (VariableElement field : ElementFilter.fieldsIn(type.getEnclosedElements())) {
+        if (field.getSimpleName().contentEquals(name)) {
+          return new ResolvedMember(
+            MemberKind.FIELD,
+            constantName(name),
+            type,
+            name,
+            Collections.emptyList());
+        }
+      }
+    }
+
+    throw new ProcessingException("Unable to find field " + name + " in " + targetClass.getQualifiedName());
+  }
+
+  /**
+   * Resolves the method declared by the given specification which is declared closest to the given target class.
+   * Super classes are searched before super interfaces.
+   *
+   * @param targetClass the target class to start the search in.
+   * @param spec        the method specification, either a name or a name followed by the parameter types.
+   * @return the resolved method.
+   * @throws ProcessingException if the method cannot be found or the given name is ambiguous.
+   */
+  private @NotNull ResolvedMember resolveMethod(
+    @NotNull TypeElement targetClass,
+    @NotNull String spec
+  ) throws ProcessingException {
+    int parametersStart = spec.indexOf('(');
+    String name = (parametersStart == -1 ? spec : spec.substring(0, parametersStart)).trim();
+    List<TypeMirror> parameterTypes = parametersStart == -1 ? null : this.parseParameterTypes(spec, parametersStart);
+
+    ExecutableElement found = null;
+    TypeElement foundIn = null;
+    for (TypeElement type : this.hierarchy(targetClass)) {
+      for (ExecutableElement method : ElementFilter.methodsIn(type.getEnclosedElements())) {
+        if (!method.getSimpleName().contentEquals(name)) {
+          continue;
+        }
+
+        if (parameterTypes != null) {
+          // explicit parameter types, the first match is the closest one
+          if (this.hasParameterTypes(method, parameterTypes)) {
+            return new ResolvedMember(
+              MemberKind.METHOD,
+              constantName(name) + this.parameterSuffix(parameterTypes),
+              type,
+              name,
+              parameterTypes);
+          }
+        } else if (found == null) {
+          found = method;
+          foundIn = type;
+        } else if (!this.hasParameterTypes(method, this.erasedParameterTypes(found))) {
+          // a name-only declaration must not match methods with different signatures
+          throw new ProcessingException(String.format(
+            "Method name %s is ambiguous in %s, declare the method with its parameter types",
+            name,
+            targetClass.getQualifiedName()));
+        }
+      }
+    }
+
+    if (found == null) {
+      throw new ProcessingException("Unable to find method " + spec + " in " + targetClass.getQualifiedName());
+    }
+
+    return new ResolvedMember(
+      MemberKind.METHOD,
+      constantName(name),
+      foundIn,
+      name,
+      this.erasedParameterTypes(found));
+  }
+
+  /**
+   * Resolves the constructor with the given parameter types which is declared in the given target class.
+   *
+   * @param targetClass the target class declaring the constructor.
+   * @param spec        the constructor specification, the parameter types in parentheses.
+   * @return the resolved constructor.
+   * @throws ProcessingException if the specification is invalid or the constructor cannot be found.
+   */
+  private @NotNull ResolvedMember resolveConstructor(
+    @NotNull TypeElement targetClass,
+    @NotNull String spec
+  ) throws ProcessingException {
+    int parametersStart = spec.indexOf('(');
+    if (parametersStart != 0) {
+      throw new ProcessingException("Constructors must be declared as their parameter types in parentheses: " + spec);
+    }
+
+    List<TypeMirror> parameterTypes = this.parseParameterTypes(spec, parametersStart);
+    for (ExecutableElement constructor : ElementFilter.constructorsIn(targetClass.getEnclosedElements())) {
+      if (this.hasParameterTypes(constructor, parameterTypes)) {
+        return new ResolvedMember(
+          MemberKind.CONSTRUCTOR,
+          "CONSTRUCTOR" + this.parameterSuffix(parameterTypes),
+          targetClass,
+          "<init>",
+          parameterTypes);
+      }
+    }
+
+    throw new ProcessingException("Unable to find constructor " + spec + " in " + targetClass.getQualifiedName());
+  }
+
+  /**
+   * Parses the comma separated parameter types in parentheses which start at the given index of the given spec.
+   *
+   * @param spec            the member specification to parse the parameter types of.
+   * @param parametersStart the index of the opening parenthesis.
+   * @return the parsed parameter types.
+   * @throws ProcessingException if the parameter list is not closed or a type cannot be resolved.
+   */
+  private @NotNull List<TypeMirror> parseParameterTypes(
+    @NotNull String spec,
+    int parametersStart
+  ) throws ProcessingException {
+    int parametersEnd = spec.lastIndexOf(')');
+    if (parametersEnd < parametersStart || !spec.substring(parametersEnd + 1).trim().isEmpty()) {
+      throw new ProcessingException("Invalid parameter list in member declaration " + spec);
+    }
+
+    String parameters = spec.substring(parametersStart + 1, parametersEnd).trim();
+    if (parameters.isEmpty()) {
+      return Collections.emptyList();
+    }
+
+    List<TypeMirror> parameterTypes = new ArrayList<>();
+    for (String parameter : parameters.split(",")) {
+      parameterTypes.add(this.parseType(parameter.trim(), spec));
+    }
+    return Collections.unmodifiableList(parameterTypes);
+  }
+
+  /**
+   * Parses the given canonical type name, which is either a primitive type, a class or an array of these.
+   *
+   * @param typeName the canonical name of the type to parse.
+   * @param spec     the member specification the type is declared in, for error reporting.
+   * @return the parsed type.
+   * @throws ProcessingException if the type cannot be resolved.
+   */
+  private @NotNull TypeMirror parseType(@NotNull String typeName, @NotNull String spec) throws ProcessingException {
+    if (typeName.endsWith("[]")) {
+      String componentName = typeName.substring(0, typeName.length() - 2).trim();
+      return this.types.getArrayType(this.parseType(componentName, spec));
+    }
+
+    for (TypeKind kind : TypeKind.values()) {
+      if (kind.isPrimitive() && kind.name().toLowerCase(Locale.ROOT).equals(typeName)) {
+        return this.types.getPrimitiveType(kind);
+      }
+    }
+
+    TypeElement type = this.elements.getTypeElement(typeName);
+    if (type == null) {
+      throw new ProcessingException("Unable to find parameter type " + typeName + " of member declaration " + spec);
+    }
+    return this.types.erasure(type.asType());
+  }
+
+  /**
+   * Checks if the erased parameter types of the given executable are the same as the given types.
+   *
+   * @param executable     the executable to check the parameter types of.
+   * @param parameterTypes the expected erased parameter types.
+   * @return true if the executable has exactly the given parameter types, false otherwise.
+   */
+  private boolean hasParameterTypes(
+    @NotNull ExecutableElement executable,
+    @NotNull List<TypeMirror> parameterTypes
+  ) {
+    List<? extends VariableElement> parameters = executable.getParameters();
+    if (parameters.size() != parameterTypes.size()) {
+      return false;
+    }
+
+    for (int i = 0; i < parameters.size(); i++) {
+      TypeMirror erased = this.types.erasure(parameters.get(i).asType());
+      if (!this.types.isSameType(erased, parameterTypes.get(i))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Get the erased parameter types of the given executable.
+   *
+   * @param executable the executable to get the erased parameter types of.
+   * @return the erased parameter types of the given executable.
+   */
+  private @NotNull List<TypeMirror> erasedParameterTypes(@NotNull ExecutableElement executable) {
+    List<TypeMirror> parameterTypes = new ArrayList<>();
+    for (VariableElement parameter : executable.getParameters()) {
+      parameterTypes.add(this.types.erasure(parameter.asType()));
+    }
+    return Collections.unmodifiableList(parameterTypes);
+  }
+
+  /**
+   * Get the given class and all its super classes, starting with the given class.
+   *
+   * @param type the class to get the super classes of.
+   * @return the given class and all its super classes.
+   */
+  private @NotNull List<TypeElement> superClasses(@NotNull TypeElement type) {
+    List<TypeElement> superClasses = new ArrayList<>();
+    for (TypeElement current = type; current != null; current = this.asTypeElement(current.getSuperclass())) {
+      superClasses.add(current);
+    }
+    return superClasses;
+  }
+
+  /**
+   * Get the given class, its super classes and after that all super interfaces of them, breadth first.
+   *
+   * @param type the class to get the hierarchy of.
+   * @return the full class hierarchy of the given class.
+   */
+  private @NotNull Set<TypeElement> hierarchy(@NotNull TypeElement type) {
+    Set<TypeElement> hierarchy = new LinkedHashSet<>(this.superClasses(type));
+    Deque<TypeElement> interfaces = new ArrayDeque<>(hierarchy);
+    while (!interfaces.isEmpty()) {
+      for (TypeMirror superInterface : interfaces.poll().getInterfaces()) {
+        TypeElement element = this.asTypeElement(superInterface);
+        if (element != null && hierarchy.add(element)) {
+          interfaces.add(element);
+        }
+      }
+    }
+    return hierarchy;
+  }
+
+  /**
+   * Get the type element of the given type, if it is a declared type.
+   *
+   * @param type the type to get the element of.
+   * @return the type element of the given type, null if the type is not a declared type.
+   */
+  private @Nullable TypeElement asTypeElement(@NotNull TypeMirror type) {
+    if (type.getKind() == TypeKind.DECLARED) {
+      Element element = ((DeclaredType) type).asElement();
+      if (element.getKind().isClass() || element.getKind().isInterface()) {
+        return (TypeElement) element;
+      }
+    }
+    return null;
+  }
+
+  /**
+   * Get the suffix of a method or constructor constant from the given parameter types, for example
+   * {@code _STRING_INT_ARRAY} for the parameter types {@code String, int[]}.
+   *
+   * @param parameterTypes the parameter types to get the suffix for.
+   * @return the constant suffix for the given parameter types, an empty string if there are no parameter types.
+   */
+  private @NotNull String parameterSuffix(@NotNull List<TypeMirror> parameterTypes) {
+    StringBuilder suffix = new StringBuilder();
+    for (TypeMirror parameterType : parameterTypes) {
+      suffix.append('_').append(this.typeConstantName(parameterType));
+    }
+    return suffix.toString();
+  }
+
+  /**
+   * Get the name of the given type as used in accessor constant names.
+   *
+   * @param type the type to get the constant name of.
+   * @return the constant name of the given type.
+   */
+  private @NotNull String typeConstantName(@NotNull TypeMirror type) {
+    if (type.getKind() == TypeKind.ARRAY) {
+      return this.typeConstantName(((ArrayType) type).getComponentType()) + "_ARRAY";
+    }
+
+    if (type.getKind().isPrimitive()) {
+      return type.getKind().name();
+    }
+
+    TypeElement element = this.asTypeElement(type);
+    return constantName(element == null ? type.toString() : element.getSimpleName().toString());
+  }
+
+  /**
+   * Converts the given camel case member name to an upper snake case constant name, for example {@code helloWorld} to
+   * {@code HELLO_WORLD}.
+   *
+   * @param name the name to convert.
+   * @return the constant name of the given member name.
+   */
+  static @NotNull String constantName(@NotNull String name) {
+    StringBuilder constantName = new StringBuilder(name.length() + 4);
+    for (int i = 0; i < name.length(); i++) {
+      char current = name.charAt(i);
+      if (i > 0 && Character.isUpperCase(current)) {
+        char previous = name.charAt(i - 1);
+        if (Character.isLowerCase(previous) || Character.isDigit(previous)) {
+          constantName.append('_');
+        }
+      }
+      constantName.append(Character.toUpperCase(current));
+    }
+    return constantName.toString();
+  }
+}
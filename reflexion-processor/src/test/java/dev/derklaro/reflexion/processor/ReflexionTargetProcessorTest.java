@@ -0,0 +1,160 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.processor;
+
+import dev.derklaro.reflexion.FieldAccessor;
+import dev.derklaro.reflexion.MethodAccessor;
+import java.io.IOException;
+import java.net.URL;
+import java.net.URLClassLoader;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.stream.Collectors;
+import javax.tools.Diagnostic;
+import javax.tools.DiagnosticCollector;
+import javax.tools.JavaCompiler;
+import javax.tools.JavaFileObject;
+import javax.tools.StandardJavaFileManager;
+import javax.tools.ToolProvider;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Assumptions;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
+
+class ReflexionTargetProcessorTest {
+
+  private static final String BASE_SOURCE = String.join("\n",
+    "package sample;",
+    "class Base {",
+    "  private String world = \"world\";",
+    "  private int secret() { return 12; }",
+    "}");
+  private static final String GREETER_SOURCE = String.join("\n",
+    "package sample;",
+    "final class Greeter extends Base {",
+    "  private final String prefix;",
+    "  private Greeter() { this(\"Hello\"); }",
+    "  private Greeter(String prefix) { this.prefix = prefix; }",
+    "  private String greet(String name, int[] times) { return prefix + \" \" + name + \" \" + times.length; }",
+    "  private String greet(String name) { return prefix + \" \" + name; }",
+    "}");
+
+  @Test
+  void testAccessorClassIsGenerated(@TempDir Path directory) throws Exception {
+    String targets = String.join("\n",
+      "package sample;",
+      "import dev.derklaro.reflexion.annotation.ReflexionTarget;",
+      "@ReflexionTarget(",
+      "  clazz = \"sample.Greeter\",",
+      "  fields = {\"world\", \"prefix\"},",
+      "  methods = {\"secret\", \"greet(java.lang.String, int[])\", \"greet(java.lang.String)\"},",
+      "  constructors = {\"()\", \"(java.lang.String)\"})",
+      "final class Targets {",
+      "}");
+
+    Path output = directory.resolve("classes");
+    List<Diagnostic<? extends JavaFileObject>> diagnostics = compile(directory, output, targets);
+    Assertions.assertTrue(diagnostics.isEmpty(), diagnostics::toString);
+    Assertions.assertTrue(Files.exists(output.resolve(
+      "META-INF/native-image/reflexion/sample.GreeterAccessors/reflect-config.json")));
+
+    URL[] urls = new URL[]{output.toUri().toURL()};
+    try (URLClassLoader loader = new URLClassLoader(urls, this.getClass().getClassLoader())) {
+      Class<?> accessors = Class.forName("sample.GreeterAccessors", true, loader);
+      MethodAccessor<?> constructor = (MethodAccessor<?>) accessors.getField("CONSTRUCTOR_STRING").get(null);
+      Object greeter = constructor.invokeWithArgs("Hi").getOrThrow();
+
+      FieldAccessor world = (FieldAccessor) accessors.getField("WORLD").get(null);
+      Assertions.assertEquals("world", world.getValue(greeter).getOrThrow());
+      FieldAccessor prefix = (FieldAccessor) accessors.getField("PREFIX").get(null);
+      Assertions.assertEquals("Hi", prefix.getValue(greeter).getOrThrow());
+
+      MethodAccessor<?> secret = (MethodAccessor<?>) accessors.getField("SECRET").get(null);
+      Assertions.assertEquals(12, (Integer) secret.invoke(greeter).getOrThrow());
+
+      MethodAccessor<?> greet = (MethodAccessor<?>) accessors.getField("GREET_STRING_INT_ARRAY").get(null);
+      Assertions.assertEquals("Hi you 2", greet.invoke(greeter, "you", new int[2]).getOrThrow());
+
+      MethodAccessor<?> noArgs = (MethodAccessor<?>) accessors.getField("CONSTRUCTOR").get(null);
+      Object defaultGreeter = noArgs.invoke().getOrThrow();
+      MethodAccessor<?> greetName = (MethodAccessor<?>) accessors.getField("GREET_STRING").get(null);
+      Assertions.assertEquals("Hello you", greetName.invoke(defaultGreeter, "you").getOrThrow());
+    }
+  }
+
+  @Test
+  void testUnresolvableMembersAreReported(@TempDir Path directory) throws Exception {
+    String targets = String.join("\n",
+      "package sample;",
+      "import dev.derklaro.reflexion.annotation.ReflexionTarget;",
+      "@ReflexionTarget(clazz = \"sample.Greeter\", fields = \"missing\")",
+      "@ReflexionTarget(clazz = \"sample.Greeter\", name = \"AmbiguousAccessors\", methods = \"greet\")",
+      "final class Targets {",
+      "}");
+
+    List<String> errors = compile(directory, directory.resolve("classes"), targets).stream()
+      .filter(diagnostic -> diagnostic.getKind() == Diagnostic.Kind.ERROR)
+      .map(diagnostic -> diagnostic.getMessage(null))
+      .collect(Collectors.toList());
+    Assertions.assertEquals(2, errors.size(), errors::toString);
+    Assertions.assertTrue(errors.get(0).contains("field missing"));
+    Assertions.assertTrue(errors.get(1).contains("ambiguous"));
+  }
+
+  private static List<Diagnostic<? extends JavaFileObject>> compile(
+    Path directory,
+    Path output,
+    String targets
+  ) throws IOException {
+    JavaCompiler compiler = ToolProvider.getSystemJavaCompiler();
+    Assumptions.assumeTrue(compiler != null, "no system java compiler available");
+
+    Path sources = directory.resolve("sources").resolve("sample");
+    Files.createDirectories(sources);
+    Files.createDirectories(output);
+
+    List<Path> files = new ArrayList<>();
+    files.add(Files.write(sources.resolve("Base.java"), BASE_SOURCE.getBytes(StandardCharsets.UTF_8)));
+    files.add(Files.write(sources.resolve("Greeter.java"), GREETER_SOURCE.getBytes(StandardCharsets.UTF_8)));
+    files.add(Files.write(sources.resolve("Targets.java"), targets.getBytes(StandardCharsets.UTF_8)));
+
+    DiagnosticCollector<JavaFileObject> diagnostics = new DiagnosticCollector<>();
+    try (StandardJavaFileManager fileManager = compiler.getStandardFileManager(diagnostics, null, null)) {
+      List<String> options = Arrays.asList(
+        "-classpath", System.getProperty("java.class.path"),
+        "-d", output.toString(),
+        "-s", Files.createDirectories(directory.resolve("generated")).toString(),
+        "-processor", ReflexionTargetProcessor.class.getName());
+      Iterable<? extends JavaFileObject> units = fileManager.getJavaFileObjectsFromFiles(
+        files.stream().map(Path::toFile).collect(Collectors.toList()));
+      compiler.getTask(null, fileManager, diagnostics, options, null, units).call();
+    }
+    return diagnostics.getDiagnostics();
+  }
+}
@@ -32,6 +32,23 @@ repositories {
   mavenCentral()
 }
 
+// classes which replace their java 8 variant on java 9+, shipped in META-INF/versions/9 of the multi-release jar
+val mainSourceSet: SourceSet = the<SourceSetContainer>()["main"]
+val java9: SourceSet = the<SourceSetContainer>().create("java9") {
+  compileClasspath += mainSourceSet.output
+}
+// classes which replace their java 8 variant on java 11+ (for example flight recorder events), in META-INF/versions/11
+val java11: SourceSet = the<SourceSetContainer>().create("java11") {
+  compileClasspath += mainSourceSet.output
+}
+
+configurations {
+  getByName(java9.compileOnlyConfigurationName).extendsFrom(getByName("compileOnly"))
+  getByName(java9.annotationProcessorConfigurationName).extendsFrom(getByName("annotationProcessor"))
+  getByName(java11.compileOnlyConfigurationName).extendsFrom(getByName("compileOnly"))
+  getByName(java11.annotationProcessorConfigurationName).extendsFrom(getByName("annotationProcessor"))
+}
+
 dependencies {
   // lombok
   val lombokVersion = "1.18.24"
@@ -62,7 +79,54 @@ tasks.withType<JavaCompile> {
   options.isIncremental = true
 }
 
+tasks.named<JavaCompile>(java9.compileJavaTaskName) {
+  sourceCompatibility = JavaVersion.VERSION_1_9.toString()
+  targetCompatibility = JavaVersion.VERSION_1_9.toString()
+}
+
+tasks.named<JavaCompile>(java11.compileJavaTaskName) {
+  sourceCompatibility = JavaVersion.VERSION_11.toString()
+  targetCompatibility = JavaVersion.VERSION_11.toString()
+}
+
+tasks.named<Jar>("jar") {
+  into("META-INF/versions/9") {
+    from(java9.output)
+  }
+  into("META-INF/versions/11") {
+    from(java11.output)
+  }
+  manifest {
+    attributes("Multi-Release" to "true")
+  }
+}
+
+tasks.named<Jar>("sourcesJar") {
+  into("META-INF/versions/9") {
+    from(java9.allJava)
+  }
+  into("META-INF/versions/11") {
+    from(java11.allJava)
+  }
+}
+
 tasks.withType<Test> {
+  // the multi-release part of the jar is not used when running from the class directories
+  if (JavaVersion.current().isJava9Compatible) {
+    classpath = java9.output + classpath
+  }
+  if (JavaVersion.current().isJava11Compatible) {
+    classpath = java11.output + classpath
+  }
+
+  // collect the runtime statistics, they are verified by the tests
+  systemProperty("dev.derklaro.reflexion.stats", "true")
+  // the natives are only bundled if they were built before (the ci always builds them), the native tests must not be
+  // skipped in that case
+  if (file("src/main/resources/reflexion-native").isDirectory) {
+    systemProperty("dev.derklaro.reflexion.test.requireNatives", "true")
+  }
+
   useJUnitPlatform()
   testLogging {
     events("started", "passed", "skipped", "failed")
@@ -84,6 +148,11 @@ tasks.withType<Javadoc> {
   options.addStringOption("-html5")
 }
 
+extensions.configure<me.champeau.jmh.JmhParameters> {
+  // report the allocation rate of each benchmark
+  profilers.add("gc")
+}
+
 extensions.configure<CheckstyleExtension> {
   toolVersion = "10.0"
 }
@@ -0,0 +1,227 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.util;
+
+import dev.derklaro.reflexion.AccessorFactory;
+import java.lang.reflect.Member;
+import jdk.jfr.Category;
+import jdk.jfr.Description;
+import jdk.jfr.Event;
+import jdk.jfr.EventType;
+import jdk.jfr.Label;
+import jdk.jfr.Name;
+import jdk.jfr.StackTrace;
+import jdk.jfr.Threshold;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: emits java flight recorder events for expensive operations of reflexion. This is the java 11+ variant
+ * which emits the events, it replaces the java 8 no-op variant in the multi-release jar. The events are part of the
+ * {@code Reflexion} category and are recorded with a threshold of 0 ms by default, the threshold (and whether an event
+ * is enabled at all) can be configured in the flight recorder settings of a recording, for example using
+ * {@code dev.derklaro.reflexion.MemberWrap#threshold=1 ms}.
+ *
+ * @since 1.4
+ */
+public final class FlightEvents {
+
+  private static final EventType CLASS_RESOLUTION_TYPE = EventType.getEventType(ClassResolutionEvent.class);
+  private static final EventType POPULATION_TYPE = EventType.getEventType(PopulationEvent.class);
+  private static final EventType WRAP_TYPE = EventType.getEventType(WrapEvent.class);
+
+  private FlightEvents() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Begins a class resolution event.
+   *
+   * @return the started event, null if the event is not enabled.
+   */
+  public static @Nullable Object beginClassResolution() {
+    return CLASS_RESOLUTION_TYPE.isEnabled() ? begin(new ClassResolutionEvent()) : null;
+  }
+
+  /**
+   * Ends and commits the given class resolution event, if the event took longer than its configured threshold.
+   *
+   * @param event     the event returned by {@link #beginClassResolution()}, passing null is a no-op.
+   * @param className the name of the class which was resolved.
+   * @param found     if the class was found.
+   */
+  public static void endClassResolution(@Nullable Object event, @NonNull String className, boolean found) {
+    if (event != null) {
+      ClassResolutionEvent resolution = (ClassResolutionEvent) event;
+      resolution.end();
+      if (resolution.shouldCommit()) {
+        resolution.className = className;
+        resolution.found = found;
+        resolution.commit();
+      }
+    }
+  }
+
+  /**
+   * Begins a hierarchy population event.
+   *
+   * @return the started event, null if the event is not enabled.
+   */
+  public static @Nullable Object beginPopulation() {
+    return POPULATION_TYPE.isEnabled() ? begin(new PopulationEvent()) : null;
+  }
+
+  /**
+   * Ends and commits the given hierarchy population event, if the event took longer than its configured threshold.
+   *
+   * @param event       the event returned by {@link #beginPopulation()}, passing null is a no-op.
+   * @param type        the class whose hierarchy was populated.
+   * @param memberType  the type of members which were collected (field, method or constructor).
+   * @param memberCount the amount of members which were collected.
+   */
+  public static void endPopulation(
+    @Nullable Object event,
+    @NonNull Class<?> type,
+    @NonNull String memberType,
+    int memberCount
+  ) {
+    if (event != null) {
+      PopulationEvent population = (PopulationEvent) event;
+      population.end();
+      if (population.shouldCommit()) {
+        population.type = type;
+        population.memberType = memberType;
+        population.memberCount = memberCount;
+        population.commit();
+      }
+    }
+  }
+
+  /**
+   * Begins a member wrap event.
+   *
+   * @return the started event, null if the event is not enabled.
+   */
+  public static @Nullable Object beginWrap() {
+    return WRAP_TYPE.isEnabled() ? begin(new WrapEvent()) : null;
+  }
+
+  /**
+   * Ends and commits the given member wrap event, if the event took longer than its configured threshold.
+   *
+   * @param event   the event returned by {@link #beginWrap()}, passing null is a no-op.
+   * @param member  the member which was wrapped.
+   * @param factory the accessor factory which wrapped the member.
+   */
+  public static void endWrap(@Nullable Object event, @NonNull Member member, @NonNull AccessorFactory factory) {
+    if (event != null) {
+      WrapEvent wrap = (WrapEvent) event;
+      wrap.end();
+      if (wrap.shouldCommit()) {
+        wrap.declaringClass = member.getDeclaringClass();
+        wrap.memberName = member.getName();
+        wrap.factory = factory.getClass().getName();
+        wrap.commit();
+      }
+    }
+  }
+
+  /**
+   * Begins the timing of the given event.
+   *
+   * @param event the event to begin.
+   * @return the given event.
+   */
+  private static @NonNull Event begin(@NonNull Event event) {
+    event.begin();
+    return event;
+  }
+
+  /**
+   * The event emitted when resolving a class by its name.
+   *
+   * @since 1.4
+   */
+  @StackTrace
+  @Threshold("0 ms")
+  @Category("Reflexion")
+  @Label("Class Resolution")
+  @Name("dev.derklaro.reflexion.ClassResolution")
+  @Description("Resolution of a class by its name")
+  static final class ClassResolutionEvent extends Event {
+
+    @Label("Class Name")
+    String className;
+
+    @Label("Found")
+    boolean found;
+  }
+
+  /**
+   * The event emitted when the members of a class hierarchy are collected into a member cache.
+   *
+   * @since 1.4
+   */
+  @StackTrace
+  @Threshold("0 ms")
+  @Category("Reflexion")
+  @Label("Hierarchy Population")
+  @Name("dev.derklaro.reflexion.HierarchyPopulation")
+  @Description("Collection of all members of a type in a class hierarchy")
+  static final class PopulationEvent extends Event {
+
+    @Label("Type")
+    Class<?> type;
+
+    @Label("Member Type")
+    String memberType;
+
+    @Label("Member Count")
+    int memberCount;
+  }
+
+  /**
+   * The event emitted when an accessor factory wraps a member.
+   *
+   * @since 1.4
+   */
+  @StackTrace
+  @Threshold("0 ms")
+  @Category("Reflexion")
+  @Label("Member Wrap")
+  @Name("dev.derklaro.reflexion.MemberWrap")
+  @Description("Creation of an accessor for a member by an accessor factory")
+  static final class WrapEvent extends Event {
+
+    @Label("Declaring Class")
+    Class<?> declaringClass;
+
+    @Label("Member Name")
+    String memberName;
+
+    @Label("Factory")
+    String factory;
+  }
+}
@@ -0,0 +1,214 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.atomic;
+
+import dev.derklaro.reflexion.AccessorFactory;
+import dev.derklaro.reflexion.AtomicFieldAccessor;
+import dev.derklaro.reflexion.Reflexion;
+import dev.derklaro.reflexion.ReflexionException;
+import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodHandles.Lookup;
+import java.lang.invoke.VarHandle;
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: creates atomic accessors for fields. This is the java 9 variant of the class, shipped in
+ * {@code META-INF/versions/9} of the multi-release jar, which wraps fields into var handles.
+ *
+ * @since 1.4
+ */
+public final class AtomicAccessors {
+
+  private AtomicAccessors() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Wraps the given field into an atomic accessor.
+   *
+   * @param reflexion the reflexion instance which requested the accessor.
+   * @param field     the field to wrap.
+   * @return an atomic accessor for the given field.
+   * @throws NullPointerException if the given reflexion instance or field is null.
+   * @throws ReflexionException   if the var handle for the given field cannot be created.
+   */
+  public static @NonNull AtomicFieldAccessor wrapField(@NonNull Reflexion reflexion, @NonNull Field field) {
+    try {
+      Lookup lookup = resolveLookup(reflexion.getAccessorFactory(), field.getDeclaringClass());
+      return new VarHandleFieldAccessor(field, reflexion, lookup.unreflectVarHandle(field));
+    } catch (IllegalAccessException exception) {
+      throw new ReflexionException(exception);
+    }
+  }
+
+  /**
+   * Resolves the lookup to use when creating the var handle for a field in the given class. The trusted lookup of the
+   * given factory is preferred as it allows access to all fields (including writes to final fields), otherwise a
+   * private lookup is used which requires the package of the class to be open to this library.
+   *
+   * @param factory   the accessor factory of the reflexion instance which requested the accessor.
+   * @param declaring the class declaring the field to access.
+   * @return the lookup to use for var handle creation.
+   * @throws IllegalAccessException if no lookup with private access to the given class is available.
+   */
+  private static @NonNull Lookup resolveLookup(
+    @NonNull AccessorFactory factory,
+    @NonNull Class<?> declaring
+  ) throws IllegalAccessException {
+    if (factory instanceof MethodHandleAccessorFactory) {
+      Lookup trustedLookup = ((MethodHandleAccessorFactory) factory).lookup();
+      if (trustedLookup != null) {
+        return trustedLookup;
+      }
+    }
+
+    // no trusted lookup available, only works if the package is open to us
+    return MethodHandles.privateLookupIn(declaring, MethodHandles.lookup());
+  }
+
+  /**
+   * An atomic field accessor which delegates all operations to a var handle.
+   *
+   * @since 1.4
+   */
+  private static final class VarHandleFieldAccessor implements AtomicFieldAccessor {
+
+    private final Field field;
+    private final Reflexion reflexion;
+    private final VarHandle varHandle;
+    private final boolean staticField;
+
+    /**
+     * Constructs a new var handle field accessor instance.
+     *
+     * @param field     the field which is wrapped by the new accessor.
+     * @param reflexion the reflexion instance which requested the accessor.
+     * @param varHandle the var handle to access the field.
+     */
+    public VarHandleFieldAccessor(Field field, Reflexion reflexion, VarHandle varHandle) {
+      this.field = field;
+      this.reflexion = reflexion;
+      this.varHandle = varHandle;
+      this.staticField = Modifier.isStatic(field.getModifiers());
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Field getMember() {
+      return this.field;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Reflexion getReflexion() {
+      return this.reflexion;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <T> T getVolatile(@Nullable Object instance) {
+      if (this.staticField) {
+        // static var handles have no coordinates
+        return (T) this.varHandle.getVolatile();
+      } else {
+        return (T) this.varHandle.getVolatile(instance);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <T> T getAcquire(@Nullable Object instance) {
+      if (this.staticField) {
+        return (T) this.varHandle.getAcquire();
+      } else {
+        return (T) this.varHandle.getAcquire(instance);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setRelease(@Nullable Object instance, @Nullable Object value) {
+      if (this.staticField) {
+        this.varHandle.setRelease(value);
+      } else {
+        this.varHandle.setRelease(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean compareAndSet(@Nullable Object instance, @Nullable Object expected, @Nullable Object value) {
+      if (this.staticField) {
+        return this.varHandle.compareAndSet(expected, value);
+      } else {
+        return this.varHandle.compareAndSet(instance, expected, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <T> T getAndAdd(@Nullable Object instance, @NonNull Object delta) {
+      if (this.staticField) {
+        return (T) this.varHandle.getAndAdd(delta);
+      } else {
+        return (T) this.varHandle.getAndAdd(instance, delta);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <T> T getAndSet(@Nullable Object instance, @Nullable Object value) {
+      if (this.staticField) {
+        return (T) this.varHandle.getAndSet(value);
+      } else {
+        return (T) this.varHandle.getAndSet(instance, value);
+      }
+    }
+  }
+}
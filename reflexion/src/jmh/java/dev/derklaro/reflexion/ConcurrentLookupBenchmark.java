@@ -0,0 +1,92 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.matcher.MethodMatcher;
+import java.lang.reflect.Modifier;
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Threads;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Measures how lookups on a reflexion instance shared between threads scale with the amount of threads. The throughput
+ * per thread should stay roughly the same, a drop indicates contention on the shared member caches.
+ */
+@Fork(value = 1)
+@State(Scope.Benchmark)
+@Measurement(iterations = 5)
+@BenchmarkMode(Mode.Throughput)
+@Warmup(iterations = 3, time = 5)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+public class ConcurrentLookupBenchmark {
+
+  private final Reflexion reflexion = Reflexion.on(SeedClass.class);
+
+  @Setup
+  public void setUp() {
+    // populate the shared caches once, the benchmarks measure the reads
+    this.reflexion.findField("WORLD");
+    this.reflexion.findMethods(MethodMatcher.newMatcher().hasModifier(Modifier.PUBLIC));
+  }
+
+  @Benchmark
+  @Threads(1)
+  public Object testFindFieldOneThread() {
+    return this.reflexion.findField("WORLD");
+  }
+
+  @Benchmark
+  @Threads(4)
+  public Object testFindFieldFourThreads() {
+    return this.reflexion.findField("WORLD");
+  }
+
+  @Benchmark
+  @Threads(Threads.MAX)
+  public Object testFindFieldAllThreads() {
+    return this.reflexion.findField("WORLD");
+  }
+
+  @Benchmark
+  @Threads(1)
+  public Object testFindMethodsOneThread() {
+    return this.reflexion.findMethods(MethodMatcher.newMatcher().hasModifier(Modifier.PUBLIC));
+  }
+
+  @Benchmark
+  @Threads(Threads.MAX)
+  public Object testFindMethodsAllThreads() {
+    return this.reflexion.findMethods(MethodMatcher.newMatcher().hasModifier(Modifier.PUBLIC));
+  }
+}
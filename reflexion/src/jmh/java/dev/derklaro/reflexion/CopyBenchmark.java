@@ -0,0 +1,84 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.matcher.FieldMatcher;
+import java.lang.reflect.Modifier;
+import java.util.Collection;
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Compares copying the state of an instance using a compiled copier with a get/set pair per field.
+ */
+@Fork(value = 1)
+@State(Scope.Benchmark)
+@Measurement(iterations = 5)
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 3, time = 5)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public class CopyBenchmark {
+
+  private final SeedClass source = new SeedClass();
+  private final SeedClass target = new SeedClass();
+
+  private ReflexionCopier<SeedClass> copier;
+  private Collection<FieldAccessor> fields;
+
+  @Setup
+  public void setUp() {
+    Reflexion reflexion = Reflexion.on(SeedClass.class);
+
+    this.copier = reflexion.copier();
+    this.fields = reflexion.findFields(FieldMatcher.newMatcher()
+      .and(field -> !Modifier.isStatic(field.getModifiers())));
+  }
+
+  @Benchmark
+  public void testCopyPerField() {
+    for (FieldAccessor field : this.fields) {
+      field.setValue(this.target, field.getValue(this.source).getOrThrow()).getOrThrow();
+    }
+  }
+
+  @Benchmark
+  public void testCopyCompiled() {
+    this.copier.copy(this.source, this.target);
+  }
+
+  @Benchmark
+  public SeedClass testCloneCompiled() {
+    return this.copier.clone(this.source);
+  }
+}
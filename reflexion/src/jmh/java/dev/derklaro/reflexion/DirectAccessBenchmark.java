@@ -0,0 +1,106 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.lang.reflect.Method;
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Compares the result based accessor api with the direct one. Run with the gc profiler (enabled by default in the
+ * build script) to compare the allocation rate, the direct variants are expected to allocate 0 bytes per operation.
+ */
+@Fork(value = 1)
+@State(Scope.Benchmark)
+@Measurement(iterations = 5)
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 3, time = 5)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public class DirectAccessBenchmark {
+
+  private SeedClass instance;
+  private FieldAccessor fieldAccessor;
+  private MethodAccessor<Method> methodAccessor;
+  private MethodAccessor<Method> setterAccessor;
+
+  @Setup
+  public void setUp() {
+    Reflexion reflexion = Reflexion.on(SeedClass.class);
+
+    this.instance = new SeedClass();
+    this.fieldAccessor = reflexion.findField("name").orElseThrow(IllegalStateException::new);
+    this.methodAccessor = reflexion.findMethod("getName").orElseThrow(IllegalStateException::new);
+    this.setterAccessor = reflexion.findMethod("setName", String.class).orElseThrow(IllegalStateException::new);
+  }
+
+  @Benchmark
+  public Object testFieldGetResult() {
+    return this.fieldAccessor.getValue(this.instance).getOrThrow();
+  }
+
+  @Benchmark
+  public Object testFieldGetDirect() {
+    return this.fieldAccessor.getValueDirect(this.instance);
+  }
+
+  @Benchmark
+  public void testFieldSetResult() {
+    this.fieldAccessor.setValue(this.instance, "World").getOrThrow();
+  }
+
+  @Benchmark
+  public void testFieldSetDirect() {
+    this.fieldAccessor.setValueDirect(this.instance, "World");
+  }
+
+  @Benchmark
+  public Object testMethodInvokeResult() {
+    return this.methodAccessor.invoke(this.instance).getOrThrow();
+  }
+
+  @Benchmark
+  public Object testMethodInvokeDirect() {
+    return this.methodAccessor.invokeDirect(this.instance);
+  }
+
+  @Benchmark
+  public Object testMethodInvokeVarargs() {
+    return this.setterAccessor.invokeDirect(this.instance, "World");
+  }
+
+  @Benchmark
+  public Object testMethodInvokeFixedArity() {
+    return this.setterAccessor.invoke1(this.instance, "World");
+  }
+}
@@ -0,0 +1,93 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.lang.invoke.MethodHandle;
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Compares the exact method handles exposed by the accessors, stored in static final fields and called using
+ * invokeExact, with the generic accessor api.
+ */
+@Fork(value = 1)
+@State(Scope.Benchmark)
+@Measurement(iterations = 5)
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 3, time = 5)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public class ExactHandleBenchmark {
+
+  private static final FieldAccessor FIELD_ACCESSOR = Reflexion.on(SeedClass.class)
+    .findField("name")
+    .orElseThrow(IllegalStateException::new);
+  private static final MethodAccessor<?> METHOD_ACCESSOR = Reflexion.on(SeedClass.class)
+    .findMethod("getName")
+    .orElseThrow(IllegalStateException::new);
+
+  private static final MethodHandle GETTER = FIELD_ACCESSOR.getterHandle();
+  private static final MethodHandle SETTER = FIELD_ACCESSOR.setterHandle();
+  private static final MethodHandle METHOD = METHOD_ACCESSOR.asMethodHandle();
+
+  private final SeedClass instance = new SeedClass();
+
+  @Benchmark
+  public Object testFieldGetGeneric() {
+    return FIELD_ACCESSOR.getValueDirect(this.instance);
+  }
+
+  @Benchmark
+  public String testFieldGetExact() throws Throwable {
+    return (String) GETTER.invokeExact(this.instance);
+  }
+
+  @Benchmark
+  public void testFieldSetGeneric() {
+    FIELD_ACCESSOR.setValueDirect(this.instance, "World");
+  }
+
+  @Benchmark
+  public void testFieldSetExact() throws Throwable {
+    SETTER.invokeExact(this.instance, "World");
+  }
+
+  @Benchmark
+  public Object testMethodInvokeGeneric() {
+    return METHOD_ACCESSOR.invokeDirect(this.instance);
+  }
+
+  @Benchmark
+  public String testMethodInvokeExact() throws Throwable {
+    return (String) METHOD.invokeExact(this.instance);
+  }
+}
@@ -0,0 +1,279 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.bytecode.BytecodeAccessorFactory;
+import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.JniAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.NativeAccessorFactory;
+import dev.derklaro.reflexion.internal.unsafe.UnsafeAccessorFactory;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Method;
+import java.util.Arrays;
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Compares all default accessor factories with each other, separated in cold lookups (empty registry), warm lookups
+ * (populated registry) and invocations of accessors which are held by the caller. {@link PlainAccessBenchmark}
+ * provides the baseline for the invocation benchmarks. The results are the basis for the static priority of the
+ * default factories, which is implemented by their {@code compareTo} methods; re-run the matrix when changing a
+ * factory. The gc profiler is enabled by default in the build script and reports the allocation rate of each benchmark.
+ * Factories which are not available in the current environment fail during the setup and are skipped by jmh.
+ */
+@Fork(value = 1)
+@State(Scope.Benchmark)
+@Measurement(iterations = 5)
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 3, time = 5)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public class FactoryMatrixBenchmark {
+
+  private static final Object ARG = new Object();
+
+  @Param({"bytecode", "native", "method-handles", "unsafe", "jni", "bare"})
+  private String factory;
+
+  private final MatrixTarget instance = new MatrixTarget();
+
+  private AccessorFactory accessorFactory;
+  private Reflexion reflexion;
+
+  private FieldAccessor instanceInt;
+  private FieldAccessor instanceString;
+  private FieldAccessor staticInt;
+  private FieldAccessor staticString;
+
+  private MethodAccessor<Method> staticMethod;
+  private MethodAccessor<Method> args0;
+  private MethodAccessor<Method> args1;
+  private MethodAccessor<Method> args2;
+  private MethodAccessor<Method> args3;
+  private MethodAccessor<Method> args4;
+  private MethodAccessor<Method> args5;
+
+  private MethodAccessor<Constructor<?>> noArgsConstructor;
+  private MethodAccessor<Constructor<?>> argsConstructor;
+
+  /**
+   * Creates the accessor factory with the given name.
+   *
+   * @param name the name of the factory to create.
+   * @return the factory with the given name.
+   * @throws IllegalArgumentException if the given name is unknown.
+   */
+  private static AccessorFactory createFactory(String name) {
+    switch (name) {
+      case "bytecode":
+        return new BytecodeAccessorFactory();
+      case "native":
+        return new NativeAccessorFactory();
+      case "method-handles":
+        return new MethodHandleAccessorFactory();
+      case "unsafe":
+        return new UnsafeAccessorFactory();
+      case "jni":
+        return new JniAccessorFactory();
+      case "bare":
+        return new BareAccessorFactory();
+      default:
+        throw new IllegalArgumentException("Unknown factory " + name);
+    }
+  }
+
+  @Setup
+  public void setUp() {
+    this.accessorFactory = createFactory(this.factory);
+    if (!this.accessorFactory.isAvailable()) {
+      throw new IllegalStateException("Factory " + this.factory + " is not available in the current environment");
+    }
+
+    this.reflexion = Reflexion.on(MatrixTarget.class, null, this.accessorFactory);
+
+    this.instanceInt = this.reflexion.findField("counter").orElseThrow(IllegalStateException::new);
+    this.instanceString = this.reflexion.findField("name").orElseThrow(IllegalStateException::new);
+    this.staticInt = this.reflexion.findField("staticCounter").orElseThrow(IllegalStateException::new);
+    this.staticString = this.reflexion.findField("staticName").orElseThrow(IllegalStateException::new);
+
+    this.staticMethod = this.reflexion.findMethod("staticName").orElseThrow(IllegalStateException::new);
+    this.args0 = this.reflexion.findMethod("args0").orElseThrow(IllegalStateException::new);
+    this.args1 = this.findArgsMethod(1);
+    this.args2 = this.findArgsMethod(2);
+    this.args3 = this.findArgsMethod(3);
+    this.args4 = this.findArgsMethod(4);
+    this.args5 = this.findArgsMethod(5);
+
+    this.noArgsConstructor = this.reflexion.findConstructor().orElseThrow(IllegalStateException::new);
+    this.argsConstructor = this.reflexion
+      .findConstructor(String.class, int.class)
+      .orElseThrow(IllegalStateException::new);
+  }
+
+  /**
+   * Finds the method of the target which takes the given amount of object arguments.
+   *
+   * @param args the amount of arguments of the method.
+   * @return the accessor for the method with the given argument count.
+   */
+  private MethodAccessor<Method> findArgsMethod(int args) {
+    Class<?>[] paramTypes = new Class<?>[args];
+    Arrays.fill(paramTypes, Object.class);
+    return this.reflexion.findMethod("args" + args, paramTypes).orElseThrow(IllegalStateException::new);
+  }
+
+  // ------------------
+  // lookups
+  // ------------------
+
+  @Benchmark
+  public Object testFieldLookupCold() {
+    // drop the cached members and accessors to simulate the first lookup of the class
+    ReflexionRegistry.invalidate(MatrixTarget.class);
+    return Reflexion.on(MatrixTarget.class, null, this.accessorFactory)
+      .findField("name")
+      .orElseThrow(IllegalStateException::new);
+  }
+
+  @Benchmark
+  public Object testFieldLookupWarm() {
+    return this.reflexion.findField("name").orElseThrow(IllegalStateException::new);
+  }
+
+  @Benchmark
+  public Object testMethodLookupCold() {
+    ReflexionRegistry.invalidate(MatrixTarget.class);
+    return Reflexion.on(MatrixTarget.class, null, this.accessorFactory)
+      .findMethod("args0")
+      .orElseThrow(IllegalStateException::new);
+  }
+
+  @Benchmark
+  public Object testMethodLookupWarm() {
+    return this.reflexion.findMethod("args0").orElseThrow(IllegalStateException::new);
+  }
+
+  // ------------------
+  // held field accessors
+  // ------------------
+
+  @Benchmark
+  public Object testInstanceIntGet() {
+    return this.instanceInt.getValueDirect(this.instance);
+  }
+
+  @Benchmark
+  public void testInstanceIntSet() {
+    this.instanceInt.setValueDirect(this.instance, 2);
+  }
+
+  @Benchmark
+  public Object testInstanceStringGet() {
+    return this.instanceString.getValueDirect(this.instance);
+  }
+
+  @Benchmark
+  public void testInstanceStringSet() {
+    this.instanceString.setValueDirect(this.instance, "Instance");
+  }
+
+  @Benchmark
+  public Object testStaticIntGet() {
+    return this.staticInt.getValueDirect(null);
+  }
+
+  @Benchmark
+  public Object testStaticStringGet() {
+    return this.staticString.getValueDirect(null);
+  }
+
+  @Benchmark
+  public void testStaticStringSet() {
+    this.staticString.setValueDirect(null, "Static");
+  }
+
+  // ------------------
+  // held method accessors
+  // ------------------
+
+  @Benchmark
+  public Object testStaticMethod() {
+    return this.staticMethod.invoke0(null);
+  }
+
+  @Benchmark
+  public Object testMethodArgs0() {
+    return this.args0.invoke0(this.instance);
+  }
+
+  @Benchmark
+  public Object testMethodArgs1() {
+    return this.args1.invoke1(this.instance, ARG);
+  }
+
+  @Benchmark
+  public Object testMethodArgs2() {
+    return this.args2.invoke2(this.instance, ARG, ARG);
+  }
+
+  @Benchmark
+  public Object testMethodArgs3() {
+    return this.args3.invoke3(this.instance, ARG, ARG, ARG);
+  }
+
+  @Benchmark
+  public Object testMethodArgs4() {
+    return this.args4.invoke4(this.instance, ARG, ARG, ARG, ARG);
+  }
+
+  @Benchmark
+  public Object testMethodArgs5() {
+    return this.args5.invoke5(this.instance, ARG, ARG, ARG, ARG, ARG);
+  }
+
+  // ------------------
+  // held constructor accessors
+  // ------------------
+
+  @Benchmark
+  public Object testNoArgsConstructor() {
+    return this.noArgsConstructor.invoke0(null);
+  }
+
+  @Benchmark
+  public Object testArgsConstructor() {
+    return this.argsConstructor.invoke2(null, "Instance", 1);
+  }
+}
@@ -0,0 +1,111 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.lang.reflect.Method;
+import java.util.concurrent.TimeUnit;
+import java.util.function.BiFunction;
+import java.util.function.Function;
+import java.util.function.ToIntFunction;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Compares members bound to functional interfaces using {@link MethodAccessor#asInterface(Class)} and
+ * {@link FieldAccessor#getterAsInterface(Class)} with the direct accessor api. The plain java baseline for the same
+ * members is available in {@link PlainAccessBenchmark}.
+ */
+@Fork(value = 1)
+@State(Scope.Benchmark)
+@Measurement(iterations = 5)
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 3, time = 5)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public class LambdaBindingBenchmark {
+
+  private static final Object ARG = new Object();
+
+  private final MatrixTarget instance = new MatrixTarget();
+
+  private MethodAccessor<Method> args0Accessor;
+  private MethodAccessor<Method> args1Accessor;
+  private FieldAccessor counterAccessor;
+
+  private Function<MatrixTarget, Object> args0Function;
+  private BiFunction<MatrixTarget, Object, Object> args1Function;
+  private ToIntFunction<MatrixTarget> counterFunction;
+
+  @Setup
+  @SuppressWarnings("unchecked")
+  public void setUp() {
+    Reflexion reflexion = Reflexion.on(MatrixTarget.class);
+
+    this.args0Accessor = reflexion.findMethod("args0").orElseThrow(IllegalStateException::new);
+    this.args1Accessor = reflexion.findMethod("args1", Object.class).orElseThrow(IllegalStateException::new);
+    this.counterAccessor = reflexion.findField("counter").orElseThrow(IllegalStateException::new);
+
+    this.args0Function = this.args0Accessor.asInterface(Function.class);
+    this.args1Function = this.args1Accessor.asInterface(BiFunction.class);
+    this.counterFunction = this.counterAccessor.getterAsInterface(ToIntFunction.class);
+  }
+
+  @Benchmark
+  public Object testMethodArgs0Accessor() {
+    return this.args0Accessor.invoke0(this.instance);
+  }
+
+  @Benchmark
+  public Object testMethodArgs0Interface() {
+    return this.args0Function.apply(this.instance);
+  }
+
+  @Benchmark
+  public Object testMethodArgs1Accessor() {
+    return this.args1Accessor.invoke1(this.instance, ARG);
+  }
+
+  @Benchmark
+  public Object testMethodArgs1Interface() {
+    return this.args1Function.apply(this.instance, ARG);
+  }
+
+  @Benchmark
+  public int testFieldIntGetAccessor() {
+    return this.counterAccessor.getInt(this.instance);
+  }
+
+  @Benchmark
+  public int testFieldIntGetInterface() {
+    return this.counterFunction.applyAsInt(this.instance);
+  }
+}
@@ -0,0 +1,74 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+/**
+ * The target of the factory matrix benchmarks. All members are package-private, so that the same members can be
+ * accessed directly as a baseline.
+ */
+public final class MatrixTarget {
+
+  static int staticCounter = 1;
+  static String staticName = "Static";
+
+  int counter = 1;
+  String name = "Instance";
+
+  MatrixTarget() {
+  }
+
+  MatrixTarget(String name, int counter) {
+    this.name = name;
+    this.counter = counter;
+  }
+
+  static String staticName() {
+    return staticName;
+  }
+
+  String args0() {
+    return this.name;
+  }
+
+  Object args1(Object a) {
+    return a;
+  }
+
+  Object args2(Object a, Object b) {
+    return b;
+  }
+
+  Object args3(Object a, Object b, Object c) {
+    return c;
+  }
+
+  Object args4(Object a, Object b, Object c, Object d) {
+    return d;
+  }
+
+  Object args5(Object a, Object b, Object c, Object d, Object e) {
+    return e;
+  }
+}
@@ -0,0 +1,133 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * The plain java baseline for the held accessor benchmarks of {@link FactoryMatrixBenchmark}, each benchmark accesses
+ * the same member directly.
+ */
+@Fork(value = 1)
+@State(Scope.Benchmark)
+@Measurement(iterations = 5)
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 3, time = 5)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public class PlainAccessBenchmark {
+
+  private static final Object ARG = new Object();
+
+  private final MatrixTarget instance = new MatrixTarget();
+
+  @Benchmark
+  public Object testInstanceIntGet() {
+    return this.instance.counter;
+  }
+
+  @Benchmark
+  public void testInstanceIntSet() {
+    this.instance.counter = 2;
+  }
+
+  @Benchmark
+  public Object testInstanceStringGet() {
+    return this.instance.name;
+  }
+
+  @Benchmark
+  public void testInstanceStringSet() {
+    this.instance.name = "Instance";
+  }
+
+  @Benchmark
+  public Object testStaticIntGet() {
+    return MatrixTarget.staticCounter;
+  }
+
+  @Benchmark
+  public Object testStaticStringGet() {
+    return MatrixTarget.staticName;
+  }
+
+  @Benchmark
+  public void testStaticStringSet() {
+    MatrixTarget.staticName = "Static";
+  }
+
+  @Benchmark
+  public Object testStaticMethod() {
+    return MatrixTarget.staticName();
+  }
+
+  @Benchmark
+  public Object testMethodArgs0() {
+    return this.instance.args0();
+  }
+
+  @Benchmark
+  public Object testMethodArgs1() {
+    return this.instance.args1(ARG);
+  }
+
+  @Benchmark
+  public Object testMethodArgs2() {
+    return this.instance.args2(ARG, ARG);
+  }
+
+  @Benchmark
+  public Object testMethodArgs3() {
+    return this.instance.args3(ARG, ARG, ARG);
+  }
+
+  @Benchmark
+  public Object testMethodArgs4() {
+    return this.instance.args4(ARG, ARG, ARG, ARG);
+  }
+
+  @Benchmark
+  public Object testMethodArgs5() {
+    return this.instance.args5(ARG, ARG, ARG, ARG, ARG);
+  }
+
+  @Benchmark
+  public Object testNoArgsConstructor() {
+    return new MatrixTarget();
+  }
+
+  @Benchmark
+  public Object testArgsConstructor() {
+    return new MatrixTarget("Instance", 1);
+  }
+}
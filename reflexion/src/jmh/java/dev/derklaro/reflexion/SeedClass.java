@@ -27,4 +27,16 @@
 public final class SeedClass {
 
   private static final String WORLD = "Hello World";
+
+  private String name = "World";
+  private int counter = 1;
+  private long timestamp = 2L;
+
+  private String getName() {
+    return this.name;
+  }
+
+  private void setName(String name) {
+    this.name = name;
+  }
 }
@@ -41,7 +41,12 @@
  * </ol>
  * <p>
  * External factories are accepted as well when being provided as a service to the current jvm. Note that the default
- * factories will always be under consideration as well.
+ * factories will always be under consideration as well. The default factories are probed in the order of their static
+ * priority, only the best available default factory is constructed and compared with the external factories. Details
+ * about the selection are available from {@link Reflexion#getFactorySelection()}. The priority of the default factories
+ * is static and not measured at runtime. The factory matrix benchmark, which is part of the jmh benchmarks of the
+ * project, compares the lookup and invocation costs of each default factory with plain java access and exists to
+ * validate that order.
  *
  * @since 1.0
  */
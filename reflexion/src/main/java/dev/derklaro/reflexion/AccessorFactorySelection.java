@@ -0,0 +1,191 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.time.Duration;
+import java.util.Collections;
+import java.util.List;
+import lombok.NonNull;
+import org.jetbrains.annotations.Unmodifiable;
+
+/**
+ * A report about the selection of the default accessor factory used by reflexion. The report contains the selected
+ * factory and all factories which were probed during the selection, including the time it took to construct the
+ * factory and check its availability. The default factories are probed in the order of their static priority and the
+ * probing stops at the first available one, therefore factories with a lower priority are usually not constructed (and
+ * not listed in the report) at all.
+ *
+ * @see Reflexion#getFactorySelection()
+ * @since 1.4
+ */
+public final class AccessorFactorySelection {
+
+  private final AccessorFactory selectedFactory;
+  private final List<Probe> probes;
+  private final Duration totalTime;
+
+  /**
+   * Constructs a new factory selection report. Internal use only, the report of the default factory selection can be
+   * obtained from {@link Reflexion#getFactorySelection()}.
+   *
+   * @param selectedFactory the factory which was selected.
+   * @param probes          all factories that were probed during the selection, in probe order.
+   * @param totalTime       the time the whole factory selection took.
+   * @throws NullPointerException if the given factory, probes or time is null.
+   */
+  public AccessorFactorySelection(
+    @NonNull AccessorFactory selectedFactory,
+    @NonNull List<Probe> probes,
+    @NonNull Duration totalTime
+  ) {
+    this.selectedFactory = selectedFactory;
+    this.probes = Collections.unmodifiableList(probes);
+    this.totalTime = totalTime;
+  }
+
+  /**
+   * Get the factory which was selected as the default accessor factory.
+   *
+   * @return the selected accessor factory.
+   */
+  public @NonNull AccessorFactory getSelectedFactory() {
+    return this.selectedFactory;
+  }
+
+  /**
+   * Get all factories which were probed during the selection, in the order they were probed.
+   *
+   * @return all probed factories.
+   */
+  public @Unmodifiable @NonNull List<Probe> getProbes() {
+    return this.probes;
+  }
+
+  /**
+   * Get the time the whole factory selection took, including loading the factories provided as a service.
+   *
+   * @return the time the factory selection took.
+   */
+  public @NonNull Duration getTotalTime() {
+    return this.totalTime;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull String toString() {
+    StringBuilder builder = new StringBuilder("AccessorFactorySelection(selected=")
+      .append(this.selectedFactory.getClass().getName())
+      .append(", totalTime=")
+      .append(this.totalTime.toNanos() / 1000)
+      .append("us, probes=[");
+    for (int i = 0; i < this.probes.size(); i++) {
+      builder.append(i == 0 ? "" : ", ").append(this.probes.get(i));
+    }
+    return builder.append("])").toString();
+  }
+
+  /**
+   * The result of probing a single accessor factory during the selection.
+   *
+   * @since 1.4
+   */
+  public static final class Probe {
+
+    private final Class<? extends AccessorFactory> factoryType;
+    private final boolean service;
+    private final boolean available;
+    private final Duration probeTime;
+
+    /**
+     * Constructs a new probe result.
+     *
+     * @param factoryType the type of the probed factory.
+     * @param service     if the factory was provided as a service rather than being a default factory.
+     * @param available   if the factory reported to be available.
+     * @param probeTime   the time it took to construct the factory and check its availability.
+     * @throws NullPointerException if the given factory type or probe time is null.
+     */
+    public Probe(
+      @NonNull Class<? extends AccessorFactory> factoryType,
+      boolean service,
+      boolean available,
+      @NonNull Duration probeTime
+    ) {
+      this.factoryType = factoryType;
+      this.service = service;
+      this.available = available;
+      this.probeTime = probeTime;
+    }
+
+    /**
+     * Get the type of the factory which was probed.
+     *
+     * @return the type of the probed factory.
+     */
+    public @NonNull Class<? extends AccessorFactory> getFactoryType() {
+      return this.factoryType;
+    }
+
+    /**
+     * Get if the factory was provided as a service rather than being one of the default factories.
+     *
+     * @return true if the factory was provided as a service, false otherwise.
+     */
+    public boolean isService() {
+      return this.service;
+    }
+
+    /**
+     * Get if the factory reported to be available in the current environment.
+     *
+     * @return true if the factory is available, false otherwise.
+     */
+    public boolean isAvailable() {
+      return this.available;
+    }
+
+    /**
+     * Get the time it took to construct the factory and check its availability.
+     *
+     * @return the time it took to probe the factory.
+     */
+    public @NonNull Duration getProbeTime() {
+      return this.probeTime;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull String toString() {
+      return this.factoryType.getSimpleName()
+        + (this.service ? "[service]" : "")
+        + (this.available ? "(available, " : "(unavailable, ")
+        + this.probeTime.toNanos() / 1000 + "us)";
+    }
+  }
+}
@@ -0,0 +1,194 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.reflect.Field;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+import org.jetbrains.annotations.UnknownNullability;
+
+/**
+ * An accessor for a field which supports memory ordering and atomic update operations, comparable to the operations
+ * provided by a VarHandle. An atomic accessor can be obtained from any field accessor by calling
+ * {@link FieldAccessor#atomic()}. All methods of this accessor rethrow exceptions unchecked rather than wrapping them
+ * in a result.
+ * <p>
+ * Operations which are not supported for the type of the wrapped field (for example {@code getAndAdd} on a field which
+ * is not numeric) throw an {@link UnsupportedOperationException}. Values which do not match the type of the field
+ * cause a {@link ClassCastException}.
+ *
+ * @since 1.4
+ */
+public interface AtomicFieldAccessor extends BaseAccessor<Field> {
+
+  /**
+   * Gets the value of the wrapped field with volatile memory semantics, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static).
+   *
+   * @param <T> the type of the data returned from the field.
+   * @return the value of the field.
+   * @see #getVolatile(Object)
+   */
+  default @UnknownNullability <T> T getVolatile() {
+    return this.getVolatile(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field with volatile memory semantics, as if the field was declared volatile.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @param <T>      the type of the data returned from the field.
+   * @return the value of the field.
+   */
+  @UnknownNullability <T> T getVolatile(@Nullable Object instance);
+
+  /**
+   * Gets the value of the wrapped field with acquire memory semantics, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static).
+   *
+   * @param <T> the type of the data returned from the field.
+   * @return the value of the field.
+   * @see #getAcquire(Object)
+   */
+  default @UnknownNullability <T> T getAcquire() {
+    return this.getAcquire(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field with acquire memory semantics. Subsequent reads and writes are not reordered
+   * before this read.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @param <T>      the type of the data returned from the field.
+   * @return the value of the field.
+   */
+  @UnknownNullability <T> T getAcquire(@Nullable Object instance);
+
+  /**
+   * Sets the value of the wrapped field with release memory semantics, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static).
+   *
+   * @param value the new value of the field.
+   * @see #setRelease(Object, Object)
+   */
+  default void setRelease(@Nullable Object value) {
+    this.setRelease(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field with release memory semantics. Prior reads and writes are not reordered after
+   * this write.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  void setRelease(@Nullable Object instance, @Nullable Object value);
+
+  /**
+   * Atomically sets the value of the wrapped field to the given value if the current value of the field is the
+   * expected value, using the instance the reflexion object which created this instance is bound to (but only if the
+   * field is not static).
+   *
+   * @param expected the expected current value of the field.
+   * @param value    the new value of the field.
+   * @return true if the value was set, false if the current value did not match the expected value.
+   * @see #compareAndSet(Object, Object, Object)
+   */
+  default boolean compareAndSet(@Nullable Object expected, @Nullable Object value) {
+    return this.compareAndSet(Util.implicitInstance(this), expected, value);
+  }
+
+  /**
+   * Atomically sets the value of the wrapped field to the given value if the current value of the field is the
+   * expected value, with volatile memory semantics. Reference fields are compared by identity, primitive fields by
+   * their value.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param expected the expected current value of the field.
+   * @param value    the new value of the field.
+   * @return true if the value was set, false if the current value did not match the expected value.
+   */
+  boolean compareAndSet(@Nullable Object instance, @Nullable Object expected, @Nullable Object value);
+
+  /**
+   * Atomically adds the given delta to the value of the wrapped field, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static).
+   *
+   * @param delta the value to add to the field value, must be of the boxed type of the field.
+   * @param <T>   the type of the data returned from the field.
+   * @return the value of the field before the update.
+   * @see #getAndAdd(Object, Object)
+   */
+  default @UnknownNullability <T> T getAndAdd(@NonNull Object delta) {
+    return this.getAndAdd(Util.implicitInstance(this), delta);
+  }
+
+  /**
+   * Atomically adds the given delta to the value of the wrapped field with volatile memory semantics. This operation is
+   * only supported for numeric primitive fields.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to update the field value in.
+   * @param delta    the value to add to the field value, must be of the boxed type of the field.
+   * @param <T>      the type of the data returned from the field.
+   * @return the value of the field before the update.
+   */
+  @UnknownNullability <T> T getAndAdd(@Nullable Object instance, @NonNull Object delta);
+
+  /**
+   * Atomically sets the value of the wrapped field to the given value, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static).
+   *
+   * @param value the new value of the field.
+   * @param <T>   the type of the data returned from the field.
+   * @return the value of the field before the update.
+   * @see #getAndSet(Object, Object)
+   */
+  default @UnknownNullability <T> T getAndSet(@Nullable Object value) {
+    return this.getAndSet(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Atomically sets the value of the wrapped field to the given value with volatile memory semantics.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   * @param <T>      the type of the data returned from the field.
+   * @return the value of the field before the update.
+   */
+  @UnknownNullability <T> T getAndSet(@Nullable Object instance, @Nullable Object value);
+}
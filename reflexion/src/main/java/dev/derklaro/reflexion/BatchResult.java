@@ -0,0 +1,200 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+import org.jetbrains.annotations.Unmodifiable;
+
+/**
+ * The result of a bulk operation of an accessor, for example {@link FieldAccessor#readAll(Object[], Object[])}. Unlike
+ * a {@link Result} a batch result is not created for each element of the batch, it only holds the index and exception
+ * of the elements for which the operation failed. A batch in which no operation failed always returns the same
+ * shared result instance.
+ *
+ * @since 1.4
+ */
+public final class BatchResult {
+
+  private static final BatchResult SUCCESS = new BatchResult(Collections.emptyList());
+
+  private final List<Failure> failures;
+
+  /**
+   * Constructs a new batch result.
+   *
+   * @param failures the failures which occurred while executing the batch.
+   */
+  private BatchResult(@NonNull @Unmodifiable List<Failure> failures) {
+    this.failures = failures;
+  }
+
+  /**
+   * Get if the operation was successful for all elements of the batch.
+   *
+   * @return true if no operation of the batch failed, false otherwise.
+   */
+  public boolean wasSuccessful() {
+    return this.failures.isEmpty();
+  }
+
+  /**
+   * Get the failures which occurred while executing the batch, ordered by their index.
+   *
+   * @return the failures of the batch, empty if the batch was successful.
+   */
+  public @NonNull @Unmodifiable List<Failure> getFailures() {
+    return this.failures;
+  }
+
+  /**
+   * Throws a reflexion exception caused by the exception of the first failed operation of the batch, does nothing if
+   * the batch was successful.
+   *
+   * @throws ReflexionException if an operation of the batch failed.
+   */
+  public void rethrowFirst() {
+    if (!this.failures.isEmpty()) {
+      throw new ReflexionException(this.failures.get(0).getException());
+    }
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull String toString() {
+    return "BatchResult(failures=" + this.failures + ")";
+  }
+
+  /**
+   * A single failed operation of a batch.
+   *
+   * @since 1.4
+   */
+  public static final class Failure {
+
+    private final int index;
+    private final Throwable exception;
+
+    /**
+     * Constructs a new failure.
+     *
+     * @param index     the index of the element for which the operation failed.
+     * @param exception the exception thrown by the operation.
+     */
+    private Failure(int index, @NonNull Throwable exception) {
+      this.index = index;
+      this.exception = exception;
+    }
+
+    /**
+     * Get the index of the element in the batch for which the operation failed.
+     *
+     * @return the index of the element for which the operation failed.
+     */
+    public int getIndex() {
+      return this.index;
+    }
+
+    /**
+     * Get the exception thrown by the failed operation.
+     *
+     * @return the exception thrown by the failed operation.
+     */
+    public @NonNull Throwable getException() {
+      return this.exception;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull String toString() {
+      return "Failure(index=" + this.index + ", exception=" + this.exception + ")";
+    }
+  }
+
+  /**
+   * Internal: collects the failures of a batch. The failure list is only allocated once the first operation fails.
+   *
+   * @since 1.4
+   */
+  static final class Collector {
+
+    @Nullable
+    private List<Failure> failures;
+
+    /**
+     * Checks that the given output array can hold the results for all given inputs.
+     *
+     * @param inputs  the number of inputs of the batch.
+     * @param outputs the length of the output array.
+     * @throws IllegalArgumentException if the output array is shorter than the input array.
+     */
+    static void checkLength(int inputs, int outputs) {
+      if (outputs < inputs) {
+        throw new IllegalArgumentException("Output array length " + outputs + " is less than input length " + inputs);
+      }
+    }
+
+    /**
+     * Records that the operation for the element at the given index failed.
+     *
+     * @param index     the index of the element for which the operation failed.
+     * @param exception the exception thrown by the operation.
+     */
+    void fail(int index, @NonNull Throwable exception) {
+      if (this.failures == null) {
+        this.failures = new ArrayList<>();
+      }
+      this.failures.add(new Failure(index, exception));
+    }
+
+    /**
+     * Records that the operation failed for all elements of a batch with the given size.
+     *
+     * @param size      the size of the batch.
+     * @param exception the exception thrown by the operation.
+     */
+    void failAll(int size, @NonNull Throwable exception) {
+      for (int i = 0; i < size; i++) {
+        this.fail(i, exception);
+      }
+    }
+
+    /**
+     * Creates the result of the batch from the collected failures.
+     *
+     * @return the result of the batch.
+     */
+    @NonNull BatchResult finish() {
+      return this.failures == null ? SUCCESS : new BatchResult(Collections.unmodifiableList(this.failures));
+    }
+  }
+}
@@ -0,0 +1,271 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.lang.invoke.MethodHandle;
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: a view of a shared field accessor which uses the binding of a bound reflexion instance for all operations
+ * that are not given an explicit instance. Creating a view does not require any work from the accessor factory.
+ *
+ * @since 1.4
+ */
+final class BoundFieldAccessor implements FieldAccessor {
+
+  private final Reflexion reflexion;
+  private final FieldAccessor delegate;
+
+  /**
+   * Constructs a new bound field accessor view.
+   *
+   * @param reflexion the bound reflexion instance which requested the accessor.
+   * @param delegate  the shared accessor to delegate all calls to.
+   */
+  public BoundFieldAccessor(@NonNull Reflexion reflexion, @NonNull FieldAccessor delegate) {
+    this.reflexion = reflexion;
+    this.delegate = delegate;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull Field getMember() {
+    return this.delegate.getMember();
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull Reflexion getReflexion() {
+    return this.reflexion;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull <T> Result<T> getValue() {
+    return this.delegate.getValue(this.binding());
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull <T> Result<T> getValue(@Nullable Object instance) {
+    return this.delegate.getValue(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull Result<Void> setValue(@Nullable Object value) {
+    return this.delegate.setValue(this.binding(), value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull Result<Void> setValue(@Nullable Object instance, @Nullable Object value) {
+    return this.delegate.setValue(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public <T> T getValueDirect(@Nullable Object instance) {
+    return this.delegate.getValueDirect(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public void setValueDirect(@Nullable Object instance, @Nullable Object value) {
+    this.delegate.setValueDirect(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public int getInt(@Nullable Object instance) {
+    return this.delegate.getInt(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public void setInt(@Nullable Object instance, int value) {
+    this.delegate.setInt(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public long getLong(@Nullable Object instance) {
+    return this.delegate.getLong(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public void setLong(@Nullable Object instance, long value) {
+    this.delegate.setLong(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public double getDouble(@Nullable Object instance) {
+    return this.delegate.getDouble(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public void setDouble(@Nullable Object instance, double value) {
+    this.delegate.setDouble(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public float getFloat(@Nullable Object instance) {
+    return this.delegate.getFloat(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public void setFloat(@Nullable Object instance, float value) {
+    this.delegate.setFloat(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public boolean getBoolean(@Nullable Object instance) {
+    return this.delegate.getBoolean(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public void setBoolean(@Nullable Object instance, boolean value) {
+    this.delegate.setBoolean(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public byte getByte(@Nullable Object instance) {
+    return this.delegate.getByte(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public void setByte(@Nullable Object instance, byte value) {
+    this.delegate.setByte(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public short getShort(@Nullable Object instance) {
+    return this.delegate.getShort(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public void setShort(@Nullable Object instance, short value) {
+    this.delegate.setShort(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public char getChar(@Nullable Object instance) {
+    return this.delegate.getChar(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public void setChar(@Nullable Object instance, char value) {
+    this.delegate.setChar(instance, value);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull MethodHandle getterHandle() {
+    return this.delegate.getterHandle();
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull MethodHandle setterHandle() {
+    return this.delegate.setterHandle();
+  }
+
+  /**
+   * Get the instance to use for operations which were not given an explicit instance.
+   *
+   * @return the binding of the reflexion instance, null if the field is static.
+   */
+  private @Nullable Object binding() {
+    return Modifier.isStatic(this.delegate.getMember().getModifiers()) ? null : this.reflexion.getBinding();
+  }
+}
@@ -0,0 +1,199 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.lang.invoke.MethodHandle;
+import java.lang.reflect.Executable;
+import java.lang.reflect.Modifier;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: a view of a shared method or constructor accessor which uses the binding of a bound reflexion instance for
+ * all invocations that are not given an explicit instance. Creating a view does not require any work from the accessor
+ * factory.
+ *
+ * @param <T> the type of the underlying executable, either a method or constructor.
+ * @since 1.4
+ */
+final class BoundMethodAccessor<T extends Executable> implements MethodAccessor<T> {
+
+  private final Reflexion reflexion;
+  private final MethodAccessor<T> delegate;
+
+  /**
+   * Constructs a new bound method accessor view.
+   *
+   * @param reflexion the bound reflexion instance which requested the accessor.
+   * @param delegate  the shared accessor to delegate all calls to.
+   */
+  public BoundMethodAccessor(@NonNull Reflexion reflexion, @NonNull MethodAccessor<T> delegate) {
+    this.reflexion = reflexion;
+    this.delegate = delegate;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull T getMember() {
+    return this.delegate.getMember();
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull Reflexion getReflexion() {
+    return this.reflexion;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull <V> Result<V> invoke() {
+    return this.delegate.invoke(this.binding());
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull <V> Result<V> invoke(@Nullable Object instance) {
+    return this.delegate.invoke(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull <V> Result<V> invokeWithArgs(@NonNull Object... args) {
+    return this.delegate.invoke(this.binding(), args);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull <V> Result<V> invoke(@Nullable Object instance, @NonNull Object... args) {
+    return this.delegate.invoke(instance, args);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public <V> V invokeDirect(@Nullable Object instance) {
+    return this.delegate.invokeDirect(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
+    return this.delegate.invokeDirect(instance, args);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public <V> V invoke0(@Nullable Object instance) {
+    return this.delegate.invoke0(instance);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public <V> V invoke1(@Nullable Object instance, @Nullable Object arg1) {
+    return this.delegate.invoke1(instance, arg1);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public <V> V invoke2(@Nullable Object instance, @Nullable Object arg1, @Nullable Object arg2) {
+    return this.delegate.invoke2(instance, arg1, arg2);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public <V> V invoke3(@Nullable Object instance, @Nullable Object arg1, @Nullable Object arg2, @Nullable Object arg3) {
+    return this.delegate.invoke3(instance, arg1, arg2, arg3);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public <V> V invoke4(
+    @Nullable Object instance,
+    @Nullable Object arg1,
+    @Nullable Object arg2,
+    @Nullable Object arg3,
+    @Nullable Object arg4
+  ) {
+    return this.delegate.invoke4(instance, arg1, arg2, arg3, arg4);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public <V> V invoke5(
+    @Nullable Object instance,
+    @Nullable Object arg1,
+    @Nullable Object arg2,
+    @Nullable Object arg3,
+    @Nullable Object arg4,
+    @Nullable Object arg5
+  ) {
+    return this.delegate.invoke5(instance, arg1, arg2, arg3, arg4, arg5);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull MethodHandle asMethodHandle() {
+    return this.delegate.asMethodHandle();
+  }
+
+  /**
+   * Get the instance to use for invocations which were not given an explicit instance. Constructor accessors ignore
+   * the instance anyway.
+   *
+   * @return the binding of the reflexion instance, null if the method is static.
+   */
+  private @Nullable Object binding() {
+    return Modifier.isStatic(this.delegate.getMember().getModifiers()) ? null : this.reflexion.getBinding();
+  }
+}
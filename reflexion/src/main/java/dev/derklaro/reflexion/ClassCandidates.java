@@ -0,0 +1,140 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.List;
+import java.util.Optional;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+import org.jetbrains.annotations.Unmodifiable;
+
+/**
+ * A reusable set of candidate names for a class, for example the names of a class in different versions of a
+ * dependency. Resolving the candidates works like {@link Reflexion#findAny(ClassLoader, String...)}, but the candidate
+ * which matched last is tried first on the next lookup, so that repeated lookups usually resolve the class with a
+ * single attempt. Instances of this class should therefore be created once and stored, for example in a static field.
+ * <p>
+ * Instances of this class are thread-safe and can be shared freely between threads.
+ *
+ * @see Reflexion#findAny(ClassLoader, String...)
+ * @since 1.4
+ */
+public final class ClassCandidates {
+
+  private final String[] names;
+
+  // the index of the name which matched last, tried first on the next lookup
+  private volatile int lastMatch;
+
+  /**
+   * Constructs new class candidates.
+   *
+   * @param names the candidate names, in search order.
+   */
+  private ClassCandidates(@NonNull String[] names) {
+    this.names = names;
+  }
+
+  /**
+   * Constructs new class candidates from the given names. The order of the given names is the search order used until
+   * the first candidate matched.
+   *
+   * @param names the candidate names of the class.
+   * @return new class candidates for the given names.
+   * @throws NullPointerException if the given name array or an element of it is null.
+   */
+  public static @NonNull ClassCandidates of(@NonNull String @NonNull ... names) {
+    String[] copy = names.clone();
+    for (String name : copy) {
+      if (name == null) {
+        throw new NullPointerException("names contains a null element");
+      }
+    }
+    return new ClassCandidates(copy);
+  }
+
+  /**
+   * Get the candidate names of the class, in their initial search order.
+   *
+   * @return the candidate names of the class.
+   */
+  public @Unmodifiable @NonNull List<String> getNames() {
+    return Collections.unmodifiableList(Arrays.asList(this.names));
+  }
+
+  /**
+   * Tries to find and wrap a class with one of the candidate names, using the first available class loader in the
+   * context. See {@link Reflexion#find(String)} for the loader search order.
+   *
+   * @return an optional reflexion instance wrapping the first class which can be resolved from the candidate names.
+   */
+  public @NonNull Optional<Reflexion> find() {
+    return this.find(null);
+  }
+
+  /**
+   * Tries to find and wrap a class with one of the candidate names. The candidate which matched last is tried first,
+   * the remaining candidates are tried in their initial order afterwards.
+   *
+   * @param loader the loader to search the class in, null to use the first available contextual loader.
+   * @return an optional reflexion instance wrapping the first class which can be resolved from the candidate names.
+   */
+  public @NonNull Optional<Reflexion> find(@Nullable ClassLoader loader) {
+    if (this.names.length == 0) {
+      return Optional.empty();
+    }
+
+    // try the candidate which matched last first
+    int last = this.lastMatch;
+    Optional<Reflexion> reflexion = Reflexion.find(this.names[last], loader);
+    if (reflexion.isPresent()) {
+      return reflexion;
+    }
+
+    // search the remaining candidates and remember the one which matched
+    for (int index = 0; index < this.names.length; index++) {
+      if (index != last) {
+        reflexion = Reflexion.find(this.names[index], loader);
+        if (reflexion.isPresent()) {
+          this.lastMatch = index;
+          return reflexion;
+        }
+      }
+    }
+
+    // found none
+    return Optional.empty();
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull String toString() {
+    return "ClassCandidates(names=" + Arrays.toString(this.names) + ")";
+  }
+}
@@ -0,0 +1,177 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.lang.ref.WeakReference;
+import java.util.Collections;
+import java.util.Iterator;
+import java.util.LinkedHashSet;
+import java.util.Map;
+import java.util.Set;
+import java.util.WeakHashMap;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: the process-wide cache for resolving classes by name. Each class loader gets its own cache of the classes
+ * which were resolved through it and of the names which could not be resolved, so that repeated lookups neither walk
+ * the delegation chain of the loader again nor throw and catch a class not found exception for each known miss.
+ * <p>
+ * The class loaders are held weakly, the resolved classes are held through weak references as they strongly reference
+ * their defining class loader, which might be the loader used as the key. Entries are therefore released together with
+ * the class loader once it becomes unreachable. The entries of the loader which was used last are remembered, so that
+ * repeated lookups through the same loader do not need to lock the map of all loaders.
+ *
+ * @since 1.4
+ */
+final class ClassResolutionCache {
+
+  // the maximum amount of unresolvable names which are remembered per class loader
+  private static final int MAX_CACHED_MISSES = 1024;
+
+  private static final Map<ClassLoader, LoaderEntries> LOADERS = Collections.synchronizedMap(new WeakHashMap<>());
+  // the entries of the loader which was used last, for lookups without locking the map of all loaders
+  private static volatile LoaderEntries lastEntries;
+
+  private ClassResolutionCache() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Resolves the class with the given name using the given class loader, without initializing it. If the name was
+   * resolved or known to be unresolvable before through the given loader, the cached result is returned.
+   *
+   * @param name   the name of the class to resolve.
+   * @param loader the loader to resolve the class through.
+   * @return the class with the given name, null if the class can't be resolved through the given loader.
+   * @throws NullPointerException if the given name or loader is null.
+   */
+  public static @Nullable Class<?> resolve(@NonNull String name, @NonNull ClassLoader loader) {
+    LoaderEntries entries = entries(loader);
+
+    // check if the class was resolved before and is still reachable
+    WeakReference<Class<?>> known = entries.classes.get(name);
+    if (known != null) {
+      Class<?> clazz = known.get();
+      if (clazz != null) {
+        return clazz;
+      }
+    }
+
+    // check if the class is known to be unresolvable
+    if (entries.misses.contains(name)) {
+      return null;
+    }
+
+    try {
+      Class<?> clazz = Class.forName(name, false, loader);
+      entries.classes.put(name, new WeakReference<>(clazz));
+      return clazz;
+    } catch (ClassNotFoundException exception) {
+      // only remember a limited amount of misses as names might be built dynamically, evict the eldest misses first
+      if (entries.misses.add(name)) {
+        synchronized (entries.missOrder) {
+          entries.missOrder.add(name);
+          Iterator<String> iterator = entries.missOrder.iterator();
+          while (entries.misses.size() > MAX_CACHED_MISSES && iterator.hasNext()) {
+            entries.misses.remove(iterator.next());
+            iterator.remove();
+          }
+        }
+      }
+      return null;
+    }
+  }
+
+  /**
+   * Get the cached resolution results of the given class loader, creating them if needed.
+   *
+   * @param loader the loader to get the entries of.
+   * @return the cached resolution results of the given loader.
+   */
+  private static @NonNull LoaderEntries entries(@NonNull ClassLoader loader) {
+    LoaderEntries entries = lastEntries;
+    if (entries == null || entries.invalidated || entries.loader.get() != loader) {
+      entries = LOADERS.computeIfAbsent(loader, LoaderEntries::new);
+      lastEntries = entries;
+    }
+    return entries;
+  }
+
+  /**
+   * Drops the cached resolution results of the given class loader. This is required if a class which was previously
+   * unresolvable became available through the loader, for example because it was defined at runtime.
+   *
+   * @param loader the loader to drop the cached results of.
+   * @throws NullPointerException if the given loader is null.
+   */
+  public static void invalidate(@NonNull ClassLoader loader) {
+    LoaderEntries entries = LOADERS.remove(loader);
+    if (entries != null) {
+      // the entries might still be remembered as the last used entries
+      entries.invalidated = true;
+    }
+  }
+
+  /**
+   * Drops the cached resolution results of all class loaders.
+   */
+  public static void invalidateAll() {
+    synchronized (LOADERS) {
+      LOADERS.values().forEach(entries -> entries.invalidated = true);
+      LOADERS.clear();
+    }
+  }
+
+  /**
+   * The cached resolution results of a single class loader.
+   *
+   * @since 1.4
+   */
+  private static final class LoaderEntries {
+
+    // the loader of the entries, held weakly as the entries are the values of the weakly keyed map of all loaders
+    private final WeakReference<ClassLoader> loader;
+    // the classes which were resolved through the loader, held weakly as they reference their defining loader
+    private final ConcurrentMap<String, WeakReference<Class<?>>> classes = new ConcurrentHashMap<>();
+    // the names which could not be resolved through the loader
+    private final Set<String> misses = ConcurrentHashMap.newKeySet();
+    // the insertion order of the misses, guarded by itself
+    private final Set<String> missOrder = new LinkedHashSet<>();
+    // if the entries were dropped from the map of all loaders and must no longer be used
+    private volatile boolean invalidated;
+
+    /**
+     * Constructs new empty resolution results for the given class loader.
+     *
+     * @param loader the loader the results belong to.
+     */
+    private LoaderEntries(@NonNull ClassLoader loader) {
+      this.loader = new WeakReference<>(loader);
+    }
+  }
+}
@@ -24,12 +24,26 @@
 
 package dev.derklaro.reflexion;
 
+import dev.derklaro.reflexion.internal.atomic.AtomicAccessors;
+import dev.derklaro.reflexion.internal.handles.AccessorHandles;
+import dev.derklaro.reflexion.internal.handles.LambdaBinder;
+import dev.derklaro.reflexion.internal.util.Primitives;
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.invoke.MethodHandle;
 import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import java.util.Arrays;
 import lombok.NonNull;
 import org.jetbrains.annotations.Nullable;
+import org.jetbrains.annotations.UnknownNullability;
 
 /**
  * An accessor which wraps a java.lang.reflect Field and makes it much easier to read/write from/to it.
+ * <p>
+ * The direct and primitive accessor methods have default implementations which delegate to the result based methods
+ * (boxing the value if needed), the accessors created by the accessor factories of reflexion override them to access
+ * the field without allocating a result or boxing. The default getter and setter handles unreflect the field, falling
+ * back to a handle which calls the direct accessor methods if the field is not accessible.
  *
  * @since 1.0
  */
@@ -78,4 +92,702 @@ public interface FieldAccessor extends BaseAccessor<Field> {
    * @return the result of the set operation, either successful or holding the set exception.
    */
   @NonNull Result<Void> setValue(@Nullable Object instance, @Nullable Object value);
+
+  /**
+   * Gets the value of the wrapped field using the instance the reflexion object which created this instance is bound to
+   * (but only if the field is not static). Unlike {@link #getValue()} this method does not allocate a result instance,
+   * but rethrows all exceptions unchecked.
+   *
+   * @param <T> the type of the data returned from the field.
+   * @return the value of the field.
+   * @see #getValueDirect(Object)
+   */
+  default @UnknownNullability <T> T getValueDirect() {
+    return this.getValueDirect(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field using the given instance. Unlike {@link #getValue(Object)} this method does not
+   * allocate a result instance, but rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @param <T>      the type of the data returned from the field.
+   * @return the value of the field.
+   */
+  default @UnknownNullability <T> T getValueDirect(@Nullable Object instance) {
+    return this.<T>getValue(instance).getOrThrow();
+  }
+
+  /**
+   * Sets the value of the wrapped field using the instance the reflexion object which created this instance is bound to
+   * (but only if the field is not static). Unlike {@link #setValue(Object)} this method does not allocate a result
+   * instance, but rethrows all exceptions unchecked.
+   *
+   * @param value the new value of the field.
+   * @see #setValueDirect(Object, Object)
+   */
+  default void setValueDirect(@Nullable Object value) {
+    this.setValueDirect(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field in the given object instance. Unlike {@link #setValue(Object, Object)} this
+   * method does not allocate a result instance, but rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  default void setValueDirect(@Nullable Object instance, @Nullable Object value) {
+    this.setValue(instance, value).getOrThrow();
+  }
+
+  /**
+   * Gets the value of the wrapped field as an int without boxing, using the instance the reflexion object which created
+   * this instance is bound to (but only if the field is not static). Unlike {@link #getValue()} this method rethrows
+   * all exceptions unchecked.
+   *
+   * @return the value of the field.
+   * @see #getInt(Object)
+   */
+  default int getInt() {
+    return this.getInt(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field as an int without boxing, using the given instance. The field type must be
+   * convertible to int by an identity or widening primitive conversion. Unlike {@link #getValue(Object)} this method
+   * rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @return the value of the field.
+   */
+  default int getInt(@Nullable Object instance) {
+    return Primitives.toInt(this.getValue(instance).getOrThrow());
+  }
+
+  /**
+   * Sets the value of the wrapped field to the given int without boxing, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static). Unlike {@link #setValue(Object)} this
+   * method rethrows all exceptions unchecked.
+   *
+   * @param value the new value of the field.
+   * @see #setInt(Object, int)
+   */
+  default void setInt(int value) {
+    this.setInt(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field in the given object instance to the given int without boxing. The given value
+   * must be convertible to the field type by an identity or widening primitive conversion. Unlike
+   * {@link #setValue(Object, Object)} this method rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  default void setInt(@Nullable Object instance, int value) {
+    this.setValue(instance, value).getOrThrow();
+  }
+
+  /**
+   * Gets the value of the wrapped field as a long without boxing, using the instance the reflexion object which created
+   * this instance is bound to (but only if the field is not static). Unlike {@link #getValue()} this method rethrows
+   * all exceptions unchecked.
+   *
+   * @return the value of the field.
+   * @see #getLong(Object)
+   */
+  default long getLong() {
+    return this.getLong(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field as a long without boxing, using the given instance. The field type must be
+   * convertible to long by an identity or widening primitive conversion. Unlike {@link #getValue(Object)} this method
+   * rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @return the value of the field.
+   */
+  default long getLong(@Nullable Object instance) {
+    return Primitives.toLong(this.getValue(instance).getOrThrow());
+  }
+
+  /**
+   * Sets the value of the wrapped field to the given long without boxing, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static). Unlike {@link #setValue(Object)} this
+   * method rethrows all exceptions unchecked.
+   *
+   * @param value the new value of the field.
+   * @see #setLong(Object, long)
+   */
+  default void setLong(long value) {
+    this.setLong(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field in the given object instance to the given long without boxing. The given value
+   * must be convertible to the field type by an identity or widening primitive conversion. Unlike
+   * {@link #setValue(Object, Object)} this method rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  default void setLong(@Nullable Object instance, long value) {
+    this.setValue(instance, value).getOrThrow();
+  }
+
+  /**
+   * Gets the value of the wrapped field as a double without boxing, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static). Unlike {@link #getValue()} this method
+   * rethrows all exceptions unchecked.
+   *
+   * @return the value of the field.
+   * @see #getDouble(Object)
+   */
+  default double getDouble() {
+    return this.getDouble(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field as a double without boxing, using the given instance. The field type must be
+   * convertible to double by an identity or widening primitive conversion. Unlike {@link #getValue(Object)} this method
+   * rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @return the value of the field.
+   */
+  default double getDouble(@Nullable Object instance) {
+    return Primitives.toDouble(this.getValue(instance).getOrThrow());
+  }
+
+  /**
+   * Sets the value of the wrapped field to the given double without boxing, using the instance the reflexion object
+   * which created this instance is bound to (but only if the field is not static). Unlike {@link #setValue(Object)}
+   * this method rethrows all exceptions unchecked.
+   *
+   * @param value the new value of the field.
+   * @see #setDouble(Object, double)
+   */
+  default void setDouble(double value) {
+    this.setDouble(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field in the given object instance to the given double without boxing. The given
+   * value must be convertible to the field type by an identity or widening primitive conversion. Unlike
+   * {@link #setValue(Object, Object)} this method rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  default void setDouble(@Nullable Object instance, double value) {
+    this.setValue(instance, value).getOrThrow();
+  }
+
+  /**
+   * Gets the value of the wrapped field as a float without boxing, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static). Unlike {@link #getValue()} this method
+   * rethrows all exceptions unchecked.
+   *
+   * @return the value of the field.
+   * @see #getFloat(Object)
+   */
+  default float getFloat() {
+    return this.getFloat(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field as a float without boxing, using the given instance. The field type must be
+   * convertible to float by an identity or widening primitive conversion. Unlike {@link #getValue(Object)} this method
+   * rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @return the value of the field.
+   */
+  default float getFloat(@Nullable Object instance) {
+    return Primitives.toFloat(this.getValue(instance).getOrThrow());
+  }
+
+  /**
+   * Sets the value of the wrapped field to the given float without boxing, using the instance the reflexion object
+   * which created this instance is bound to (but only if the field is not static). Unlike {@link #setValue(Object)}
+   * this method rethrows all exceptions unchecked.
+   *
+   * @param value the new value of the field.
+   * @see #setFloat(Object, float)
+   */
+  default void setFloat(float value) {
+    this.setFloat(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field in the given object instance to the given float without boxing. The given value
+   * must be convertible to the field type by an identity or widening primitive conversion. Unlike
+   * {@link #setValue(Object, Object)} this method rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  default void setFloat(@Nullable Object instance, float value) {
+    this.setValue(instance, value).getOrThrow();
+  }
+
+  /**
+   * Gets the value of the wrapped field as a boolean without boxing, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static). Unlike {@link #getValue()} this method
+   * rethrows all exceptions unchecked.
+   *
+   * @return the value of the field.
+   * @see #getBoolean(Object)
+   */
+  default boolean getBoolean() {
+    return this.getBoolean(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field as a boolean without boxing, using the given instance. The field type must be
+   * convertible to boolean by an identity or widening primitive conversion. Unlike {@link #getValue(Object)} this
+   * method rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @return the value of the field.
+   */
+  default boolean getBoolean(@Nullable Object instance) {
+    return Primitives.toBoolean(this.getValue(instance).getOrThrow());
+  }
+
+  /**
+   * Sets the value of the wrapped field to the given boolean without boxing, using the instance the reflexion object
+   * which created this instance is bound to (but only if the field is not static). Unlike {@link #setValue(Object)}
+   * this method rethrows all exceptions unchecked.
+   *
+   * @param value the new value of the field.
+   * @see #setBoolean(Object, boolean)
+   */
+  default void setBoolean(boolean value) {
+    this.setBoolean(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field in the given object instance to the given boolean without boxing. The given
+   * value must be convertible to the field type by an identity or widening primitive conversion. Unlike
+   * {@link #setValue(Object, Object)} this method rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  default void setBoolean(@Nullable Object instance, boolean value) {
+    this.setValue(instance, value).getOrThrow();
+  }
+
+  /**
+   * Gets the value of the wrapped field as a byte without boxing, using the instance the reflexion object which created
+   * this instance is bound to (but only if the field is not static). Unlike {@link #getValue()} this method rethrows
+   * all exceptions unchecked.
+   *
+   * @return the value of the field.
+   * @see #getByte(Object)
+   */
+  default byte getByte() {
+    return this.getByte(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field as a byte without boxing, using the given instance. The field type must be
+   * convertible to byte by an identity or widening primitive conversion. Unlike {@link #getValue(Object)} this method
+   * rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @return the value of the field.
+   */
+  default byte getByte(@Nullable Object instance) {
+    return Primitives.toByte(this.getValue(instance).getOrThrow());
+  }
+
+  /**
+   * Sets the value of the wrapped field to the given byte without boxing, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static). Unlike {@link #setValue(Object)} this
+   * method rethrows all exceptions unchecked.
+   *
+   * @param value the new value of the field.
+   * @see #setByte(Object, byte)
+   */
+  default void setByte(byte value) {
+    this.setByte(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field in the given object instance to the given byte without boxing. The given value
+   * must be convertible to the field type by an identity or widening primitive conversion. Unlike
+   * {@link #setValue(Object, Object)} this method rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  default void setByte(@Nullable Object instance, byte value) {
+    this.setValue(instance, value).getOrThrow();
+  }
+
+  /**
+   * Gets the value of the wrapped field as a short without boxing, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static). Unlike {@link #getValue()} this method
+   * rethrows all exceptions unchecked.
+   *
+   * @return the value of the field.
+   * @see #getShort(Object)
+   */
+  default short getShort() {
+    return this.getShort(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field as a short without boxing, using the given instance. The field type must be
+   * convertible to short by an identity or widening primitive conversion. Unlike {@link #getValue(Object)} this method
+   * rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @return the value of the field.
+   */
+  default short getShort(@Nullable Object instance) {
+    return Primitives.toShort(this.getValue(instance).getOrThrow());
+  }
+
+  /**
+   * Sets the value of the wrapped field to the given short without boxing, using the instance the reflexion object
+   * which created this instance is bound to (but only if the field is not static). Unlike {@link #setValue(Object)}
+   * this method rethrows all exceptions unchecked.
+   *
+   * @param value the new value of the field.
+   * @see #setShort(Object, short)
+   */
+  default void setShort(short value) {
+    this.setShort(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field in the given object instance to the given short without boxing. The given value
+   * must be convertible to the field type by an identity or widening primitive conversion. Unlike
+   * {@link #setValue(Object, Object)} this method rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  default void setShort(@Nullable Object instance, short value) {
+    this.setValue(instance, value).getOrThrow();
+  }
+
+  /**
+   * Gets the value of the wrapped field as a char without boxing, using the instance the reflexion object which created
+   * this instance is bound to (but only if the field is not static). Unlike {@link #getValue()} this method rethrows
+   * all exceptions unchecked.
+   *
+   * @return the value of the field.
+   * @see #getChar(Object)
+   */
+  default char getChar() {
+    return this.getChar(Util.implicitInstance(this));
+  }
+
+  /**
+   * Gets the value of the wrapped field as a char without boxing, using the given instance. The field type must be
+   * convertible to char by an identity or widening primitive conversion. Unlike {@link #getValue(Object)} this method
+   * rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance to use when getting the field value.
+   * @return the value of the field.
+   */
+  default char getChar(@Nullable Object instance) {
+    return Primitives.toChar(this.getValue(instance).getOrThrow());
+  }
+
+  /**
+   * Sets the value of the wrapped field to the given char without boxing, using the instance the reflexion object which
+   * created this instance is bound to (but only if the field is not static). Unlike {@link #setValue(Object)} this
+   * method rethrows all exceptions unchecked.
+   *
+   * @param value the new value of the field.
+   * @see #setChar(Object, char)
+   */
+  default void setChar(char value) {
+    this.setChar(Util.implicitInstance(this), value);
+  }
+
+  /**
+   * Sets the value of the wrapped field in the given object instance to the given char without boxing. The given value
+   * must be convertible to the field type by an identity or widening primitive conversion. Unlike
+   * {@link #setValue(Object, Object)} this method rethrows all exceptions unchecked.
+   * <p>
+   * The given instance should be present in case the field is not static, null otherwise.
+   *
+   * @param instance the instance of the object to set the new field value in.
+   * @param value    the new value of the field to set.
+   */
+  default void setChar(@Nullable Object instance, char value) {
+    this.setValue(instance, value).getOrThrow();
+  }
+
+  /**
+   * Reads the value of the wrapped field from each of the given instances into the output array at the same index.
+   * Unlike calling {@link #getValue(Object)} for each instance, no result instance is allocated per read and the
+   * modifiers of the field are only checked once. A static field is read only once and the value is stored at all
+   * indexes of the output array. Reads which fail are reported in the returned batch result, the corresponding index
+   * of the output array is left untouched.
+   *
+   * @param instances the instances to read the field value from, ignored if the field is static.
+   * @param out       the array to store the read values in.
+   * @return the result of the batch, holding the index and exception of all failed reads.
+   * @throws NullPointerException     if the given instance or output array is null.
+   * @throws IllegalArgumentException if the output array is shorter than the instance array.
+   * @since 1.4
+   */
+  default @NonNull BatchResult readAll(@NonNull Object[] instances, @NonNull Object[] out) {
+    BatchResult.Collector collector = new BatchResult.Collector();
+    BatchResult.Collector.checkLength(instances.length, out.length);
+
+    if (Modifier.isStatic(this.getMember().getModifiers())) {
+      try {
+        Arrays.fill(out, 0, instances.length, this.getValueDirect(null));
+      } catch (Throwable throwable) {
+        collector.failAll(instances.length, throwable);
+      }
+    } else {
+      for (int i = 0; i < instances.length; i++) {
+        try {
+          out[i] = this.getValueDirect(instances[i]);
+        } catch (Throwable throwable) {
+          collector.fail(i, throwable);
+        }
+      }
+    }
+    return collector.finish();
+  }
+
+  /**
+   * Reads the int value of the wrapped field from each of the given instances into the output array at the same index.
+   * See {@link #readAll(Object[], Object[])} for details.
+   *
+   * @param instances the instances to read the field value from, ignored if the field is static.
+   * @param out       the array to store the read values in.
+   * @return the result of the batch, holding the index and exception of all failed reads.
+   * @throws NullPointerException     if the given instance or output array is null.
+   * @throws IllegalArgumentException if the output array is shorter than the instance array.
+   * @since 1.4
+   */
+  default @NonNull BatchResult readAllInt(@NonNull Object[] instances, @NonNull int[] out) {
+    BatchResult.Collector collector = new BatchResult.Collector();
+    BatchResult.Collector.checkLength(instances.length, out.length);
+
+    if (Modifier.isStatic(this.getMember().getModifiers())) {
+      try {
+        Arrays.fill(out, 0, instances.length, this.getInt(null));
+      } catch (Throwable throwable) {
+        collector.failAll(instances.length, throwable);
+      }
+    } else {
+      for (int i = 0; i < instances.length; i++) {
+        try {
+          out[i] = this.getInt(instances[i]);
+        } catch (Throwable throwable) {
+          collector.fail(i, throwable);
+        }
+      }
+    }
+    return collector.finish();
+  }
+
+  /**
+   * Reads the long value of the wrapped field from each of the given instances into the output array at the same index.
+   * See {@link #readAll(Object[], Object[])} for details.
+   *
+   * @param instances the instances to read the field value from, ignored if the field is static.
+   * @param out       the array to store the read values in.
+   * @return the result of the batch, holding the index and exception of all failed reads.
+   * @throws NullPointerException     if the given instance or output array is null.
+   * @throws IllegalArgumentException if the output array is shorter than the instance array.
+   * @since 1.4
+   */
+  default @NonNull BatchResult readAllLong(@NonNull Object[] instances, @NonNull long[] out) {
+    BatchResult.Collector collector = new BatchResult.Collector();
+    BatchResult.Collector.checkLength(instances.length, out.length);
+
+    if (Modifier.isStatic(this.getMember().getModifiers())) {
+      try {
+        Arrays.fill(out, 0, instances.length, this.getLong(null));
+      } catch (Throwable throwable) {
+        collector.failAll(instances.length, throwable);
+      }
+    } else {
+      for (int i = 0; i < instances.length; i++) {
+        try {
+          out[i] = this.getLong(instances[i]);
+        } catch (Throwable throwable) {
+          collector.fail(i, throwable);
+        }
+      }
+    }
+    return collector.finish();
+  }
+
+  /**
+   * Reads the double value of the wrapped field from each of the given instances into the output array at the same
+   * index. See {@link #readAll(Object[], Object[])} for details.
+   *
+   * @param instances the instances to read the field value from, ignored if the field is static.
+   * @param out       the array to store the read values in.
+   * @return the result of the batch, holding the index and exception of all failed reads.
+   * @throws NullPointerException     if the given instance or output array is null.
+   * @throws IllegalArgumentException if the output array is shorter than the instance array.
+   * @since 1.4
+   */
+  default @NonNull BatchResult readAllDouble(@NonNull Object[] instances, @NonNull double[] out) {
+    BatchResult.Collector collector = new BatchResult.Collector();
+    BatchResult.Collector.checkLength(instances.length, out.length);
+
+    if (Modifier.isStatic(this.getMember().getModifiers())) {
+      try {
+        Arrays.fill(out, 0, instances.length, this.getDouble(null));
+      } catch (Throwable throwable) {
+        collector.failAll(instances.length, throwable);
+      }
+    } else {
+      for (int i = 0; i < instances.length; i++) {
+        try {
+          out[i] = this.getDouble(instances[i]);
+        } catch (Throwable throwable) {
+          collector.fail(i, throwable);
+        }
+      }
+    }
+    return collector.finish();
+  }
+
+  /**
+   * Get a method handle which reads the value of the wrapped field. The returned handle has the exact original type of
+   * the field getter, which is {@code (DeclaringClass)FieldType} for instance fields and {@code ()FieldType} for static
+   * fields. The handle is created using the trusted lookup if available, which means that it can read every field
+   * regardless of its visibility.
+   * <p>
+   * Callers should store the returned handle in a {@code static final} field and call it using {@code invokeExact},
+   * which allows the jvm to inline the field access completely. This method creates a new handle on each call in some
+   * implementations, it should therefore not be called on a hot path.
+   *
+   * @return a method handle reading the value of the wrapped field.
+   * @throws ReflexionException if the handle cannot be created.
+   * @since 1.4
+   */
+  default @NonNull MethodHandle getterHandle() {
+    return AccessorHandles.getterHandle(this);
+  }
+
+  /**
+   * Get a method handle which writes the value of the wrapped field. The returned handle has the exact original type of
+   * the field setter, which is {@code (DeclaringClass,FieldType)void} for instance fields and {@code (FieldType)void}
+   * for static fields. The handle is created using the trusted lookup if available, which means that it can write every
+   * field regardless of its visibility.
+   * <p>
+   * Callers should store the returned handle in a {@code static final} field and call it using {@code invokeExact},
+   * which allows the jvm to inline the field access completely. This method creates a new handle on each call in some
+   * implementations, it should therefore not be called on a hot path.
+   *
+   * @return a method handle writing the value of the wrapped field.
+   * @throws ReflexionException if the handle cannot be created, for example for final fields without trusted access.
+   * @since 1.4
+   */
+  default @NonNull MethodHandle setterHandle() {
+    return AccessorHandles.setterHandle(this);
+  }
+
+  /**
+   * Get an implementation of the given functional interface which reads the wrapped field. The interface method must
+   * either take no parameters, reading the field using the binding of the reflexion instance of this accessor, or the
+   * instance to read the field from (for example {@code Function} or {@code ToIntFunction}). A primitive return type
+   * of the interface method reads the field without boxing.
+   * <p>
+   * The implementation is spun using the lambda metafactory and calls the matching direct read method of this accessor
+   * without allocating a result. Binding is expensive, callers should create the implementation once and keep it.
+   *
+   * @param samType the functional interface to implement.
+   * @param <F>     the type of the functional interface.
+   * @return an implementation of the given functional interface reading the wrapped field.
+   * @throws NullPointerException     if the given interface type is null.
+   * @throws IllegalArgumentException if the given type is not a functional interface with a getter signature.
+   * @throws ReflexionException       if the interface cannot be bound to the field.
+   * @since 1.4
+   */
+  default @NonNull <F> F getterAsInterface(@NonNull Class<F> samType) {
+    return LambdaBinder.bindGetter(this, samType);
+  }
+
+  /**
+   * Get an implementation of the given functional interface which writes the wrapped field. The interface method must
+   * return void and either take the value to write, writing the field using the binding of the reflexion instance of
+   * this accessor, or the instance to write to followed by the value (for example {@code BiConsumer} or
+   * {@code ObjIntConsumer}). A primitive value parameter of the interface method writes the field without boxing.
+   * <p>
+   * The implementation is spun using the lambda metafactory and calls the matching direct write method of this
+   * accessor. Binding is expensive, callers should create the implementation once and keep it.
+   *
+   * @param samType the functional interface to implement.
+   * @param <F>     the type of the functional interface.
+   * @return an implementation of the given functional interface writing the wrapped field.
+   * @throws NullPointerException     if the given interface type is null.
+   * @throws IllegalArgumentException if the given type is not a functional interface with a setter signature.
+   * @throws ReflexionException       if the interface cannot be bound to the field.
+   * @since 1.4
+   */
+  default @NonNull <F> F setterAsInterface(@NonNull Class<F> samType) {
+    return LambdaBinder.bindSetter(this, samType);
+  }
+
+  /**
+   * Get an accessor for the wrapped field which supports memory ordering and atomic update operations. The returned
+   * accessor is based on var handles created using the trusted lookup if available, which means that private fields of
+   * other classes can be updated atomically as well. Operations of the returned accessor which were not given an
+   * explicit instance use the binding of the reflexion instance of this accessor.
+   * <p>
+   * Creating the accessor is not cheap, callers should keep the returned accessor rather than calling this method for
+   * each operation.
+   *
+   * @return an atomic accessor for the wrapped field.
+   * @throws ReflexionException if atomic field access is not possible, for example when running on java 8.
+   * @since 1.4
+   */
+  default @NonNull AtomicFieldAccessor atomic() {
+    return AtomicAccessors.wrapField(this.getReflexion(), this.getMember());
+  }
 }
@@ -0,0 +1,177 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.lang.reflect.Executable;
+import java.lang.reflect.Member;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collection;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Objects;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+import org.jetbrains.annotations.Unmodifiable;
+
+/**
+ * Internal: a hash index over the members of a class, allowing lookups by name and by name and erased parameter types
+ * without testing every member of the class. The members are kept in the order of the source collection, meaning that
+ * members which are declared closer to the indexed class are returned first.
+ *
+ * @param <T> the type of members in the index.
+ * @since 1.4
+ */
+final class MemberIndex<T extends Member> {
+
+  private final Map<String, List<T>> byName;
+  private final Map<Signature, T> bySignature;
+
+  /**
+   * Constructs a new member index.
+   *
+   * @param byName      the members of the class grouped by their name.
+   * @param bySignature the members of the class by their signature, empty for fields.
+   */
+  private MemberIndex(@NonNull Map<String, List<T>> byName, @NonNull Map<Signature, T> bySignature) {
+    this.byName = byName;
+    this.bySignature = bySignature;
+  }
+
+  /**
+   * Builds a new index for the given members. If the members are executables they are indexed by their signature as
+   * well, constructors are indexed without a name.
+   *
+   * @param members the members to index.
+   * @param ctor    if the given members are constructors.
+   * @param <T>     the type of members to index.
+   * @return a new index for the given members.
+   * @throws NullPointerException if the given member collection is null.
+   */
+  public static @NonNull <T extends Member> MemberIndex<T> build(@NonNull Collection<T> members, boolean ctor) {
+    Map<String, List<T>> byName = new HashMap<>();
+    Map<Signature, T> bySignature = new HashMap<>();
+
+    for (T member : members) {
+      byName.computeIfAbsent(member.getName(), $ -> new ArrayList<>(1)).add(member);
+      if (member instanceof Executable) {
+        // the first member with a signature is the one declared closest to the indexed class
+        Class<?>[] paramTypes = ((Executable) member).getParameterTypes();
+        bySignature.putIfAbsent(new Signature(ctor ? null : member.getName(), paramTypes), member);
+      }
+    }
+
+    // make the grouped members unmodifiable
+    byName.replaceAll(($, value) -> Collections.unmodifiableList(value));
+    return new MemberIndex<>(byName, bySignature.isEmpty() ? Collections.emptyMap() : bySignature);
+  }
+
+  /**
+   * Get all members with the given name.
+   *
+   * @param name the name of the members to get.
+   * @return all members with the given name, an empty list if no member has the given name.
+   * @throws NullPointerException if the given name is null.
+   */
+  public @Unmodifiable @NonNull List<T> byName(@NonNull String name) {
+    return this.byName.getOrDefault(name, Collections.emptyList());
+  }
+
+  /**
+   * Get the first member with the given name.
+   *
+   * @param name the name of the member to get.
+   * @return the first member with the given name, null if no member has the given name.
+   * @throws NullPointerException if the given name is null.
+   */
+  public @Nullable T firstByName(@NonNull String name) {
+    List<T> members = this.byName.get(name);
+    return members == null ? null : members.get(0);
+  }
+
+  /**
+   * Get the first member with the given name and exact parameter types.
+   *
+   * @param name       the name of the member, null if constructors are indexed.
+   * @param paramTypes the exact parameter types of the member.
+   * @return the first member with the given signature, null if no such member exists.
+   * @throws NullPointerException if the given parameter type array is null.
+   */
+  public @Nullable T bySignature(@Nullable String name, @NonNull Class<?>[] paramTypes) {
+    return this.bySignature.get(new Signature(name, paramTypes));
+  }
+
+  /**
+   * The key of an executable in the signature index, consisting of the name and erased parameter types.
+   *
+   * @since 1.4
+   */
+  private static final class Signature {
+
+    private final String name;
+    private final Class<?>[] paramTypes;
+    private final int hash;
+
+    /**
+     * Constructs a new signature.
+     *
+     * @param name       the name of the executable, null for constructors.
+     * @param paramTypes the erased parameter types of the executable.
+     */
+    public Signature(@Nullable String name, @NonNull Class<?>[] paramTypes) {
+      this.name = name;
+      this.paramTypes = paramTypes;
+      this.hash = 31 * Objects.hashCode(name) + Arrays.hashCode(paramTypes);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean equals(Object o) {
+      if (this == o) {
+        return true;
+      }
+      if (!(o instanceof Signature)) {
+        return false;
+      }
+
+      Signature that = (Signature) o;
+      return this.hash == that.hash
+        && Objects.equals(this.name, that.name)
+        && Arrays.equals(this.paramTypes, that.paramTypes);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int hashCode() {
+      return this.hash;
+    }
+  }
+}
@@ -24,12 +24,23 @@
 
 package dev.derklaro.reflexion;
 
+import dev.derklaro.reflexion.internal.handles.AccessorHandles;
+import dev.derklaro.reflexion.internal.handles.LambdaBinder;
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.invoke.MethodHandle;
 import java.lang.reflect.Executable;
+import java.lang.reflect.Modifier;
 import lombok.NonNull;
 import org.jetbrains.annotations.Nullable;
+import org.jetbrains.annotations.UnknownNullability;
 
 /**
  * An accessor which wraps a java.lang.reflect Method and makes it much easier to invoke it.
+ * <p>
+ * The direct invocation methods have default implementations which delegate to the result based methods, the
+ * accessors created by the accessor factories of reflexion override them to invoke the method without allocating a
+ * result. The default method handle unreflects the member, falling back to a handle which calls the direct invocation
+ * methods if the member is not accessible.
  *
  * @param <T> the type of the underlying executable, either a method or constructor.
  * @since 1.0
@@ -84,4 +95,272 @@
    * @return the result instance of the invocation, either holding the result of the method or any exception thrown.
    */
   @NonNull <V> Result<V> invoke(@Nullable Object instance, @NonNull Object... args);
+
+  /**
+   * Invokes the underlying method using the instance the reflexion object used to create this accessor is bound to (if
+   * the method is not static). Unlike {@link #invoke()} this method does not allocate a result instance, but rethrows
+   * all exceptions thrown by the method (or during the invocation) unchecked.
+   * <p>
+   * This method invokes the wrapped method without any arguments.
+   *
+   * @param <V> the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   * @see #invokeDirect(Object)
+   */
+  default @UnknownNullability <V> V invokeDirect() {
+    return this.invokeDirect(Util.implicitInstance(this));
+  }
+
+  /**
+   * Invokes the underlying method using the given instance. Unlike {@link #invoke(Object)} this method does not
+   * allocate a result instance, but rethrows all exceptions thrown by the method (or during the invocation) unchecked.
+   * <p>
+   * This method invokes the wrapped method without any arguments. The given instance should be null when invoking a
+   * static method.
+   *
+   * @param instance the instance to invoke the wrapped method on.
+   * @param <V>      the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   */
+  default @UnknownNullability <V> V invokeDirect(@Nullable Object instance) {
+    return this.<V>invoke(instance).getOrThrow();
+  }
+
+  /**
+   * Invokes the underlying method using the instance the reflexion object used to create this accessor is bound to (if
+   * the method is not static). Unlike {@link #invokeWithArgs(Object...)} this method does not allocate a result
+   * instance, but rethrows all exceptions thrown by the method (or during the invocation) unchecked.
+   *
+   * @param args the arguments to use on when invoking the wrapped method.
+   * @param <V>  the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   * @see #invokeDirect(Object, Object...)
+   */
+  default @UnknownNullability <V> V invokeWithArgsDirect(@NonNull Object... args) {
+    return this.invokeDirect(Util.implicitInstance(this), args);
+  }
+
+  /**
+   * Invokes the underlying method using the given instance. Unlike {@link #invoke(Object, Object...)} this method does
+   * not allocate a result instance, but rethrows all exceptions thrown by the method (or during the invocation)
+   * unchecked.
+   * <p>
+   * The given instance should be null when invoking a static method.
+   *
+   * @param instance the instance to invoke the wrapped method on.
+   * @param args     the arguments to use on when invoking the wrapped method.
+   * @param <V>      the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   */
+  default @UnknownNullability <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
+    return this.<V>invoke(instance, args).getOrThrow();
+  }
+
+  /**
+   * Invokes the underlying method with no arguments using the given instance. Like
+   * {@link #invokeDirect(Object, Object...)} this method rethrows all exceptions unchecked, but accessor factories can
+   * implement it without allocating an argument array for the invocation.
+   *
+   * @param instance the instance to invoke the wrapped method on, ignored for static methods and constructors.
+   * @param <V>      the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   */
+  default @UnknownNullability <V> V invoke0(@Nullable Object instance) {
+    return this.invokeDirect(instance);
+  }
+
+  /**
+   * Invokes the underlying method with exactly 1 argument using the given instance. Like
+   * {@link #invokeDirect(Object, Object...)} this method rethrows all exceptions unchecked, but accessor factories can
+   * implement it without allocating an argument array for the invocation.
+   *
+   * @param instance the instance to invoke the wrapped method on, ignored for static methods and constructors.
+   * @param arg1     the first argument to pass to the method.
+   * @param <V>      the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   */
+  default @UnknownNullability <V> V invoke1(@Nullable Object instance, @Nullable Object arg1) {
+    return this.invokeDirect(instance, arg1);
+  }
+
+  /**
+   * Invokes the underlying method with exactly 2 arguments using the given instance. Like
+   * {@link #invokeDirect(Object, Object...)} this method rethrows all exceptions unchecked, but accessor factories can
+   * implement it without allocating an argument array for the invocation.
+   *
+   * @param instance the instance to invoke the wrapped method on, ignored for static methods and constructors.
+   * @param arg1     the first argument to pass to the method.
+   * @param arg2     the second argument to pass to the method.
+   * @param <V>      the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   */
+  default @UnknownNullability <V> V invoke2(@Nullable Object instance, @Nullable Object arg1, @Nullable Object arg2) {
+    return this.invokeDirect(instance, arg1, arg2);
+  }
+
+  /**
+   * Invokes the underlying method with exactly 3 arguments using the given instance. Like
+   * {@link #invokeDirect(Object, Object...)} this method rethrows all exceptions unchecked, but accessor factories can
+   * implement it without allocating an argument array for the invocation.
+   *
+   * @param instance the instance to invoke the wrapped method on, ignored for static methods and constructors.
+   * @param arg1     the first argument to pass to the method.
+   * @param arg2     the second argument to pass to the method.
+   * @param arg3     the third argument to pass to the method.
+   * @param <V>      the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   */
+  default @UnknownNullability <V> V invoke3(
+    @Nullable Object instance,
+    @Nullable Object arg1,
+    @Nullable Object arg2,
+    @Nullable Object arg3
+  ) {
+    return this.invokeDirect(instance, arg1, arg2, arg3);
+  }
+
+  /**
+   * Invokes the underlying method with exactly 4 arguments using the given instance. Like
+   * {@link #invokeDirect(Object, Object...)} this method rethrows all exceptions unchecked, but accessor factories can
+   * implement it without allocating an argument array for the invocation.
+   *
+   * @param instance the instance to invoke the wrapped method on, ignored for static methods and constructors.
+   * @param arg1     the first argument to pass to the method.
+   * @param arg2     the second argument to pass to the method.
+   * @param arg3     the third argument to pass to the method.
+   * @param arg4     the fourth argument to pass to the method.
+   * @param <V>      the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   */
+  default @UnknownNullability <V> V invoke4(
+    @Nullable Object instance,
+    @Nullable Object arg1,
+    @Nullable Object arg2,
+    @Nullable Object arg3,
+    @Nullable Object arg4
+  ) {
+    return this.invokeDirect(instance, arg1, arg2, arg3, arg4);
+  }
+
+  /**
+   * Invokes the underlying method with exactly 5 arguments using the given instance. Like
+   * {@link #invokeDirect(Object, Object...)} this method rethrows all exceptions unchecked, but accessor factories can
+   * implement it without allocating an argument array for the invocation.
+   *
+   * @param instance the instance to invoke the wrapped method on, ignored for static methods and constructors.
+   * @param arg1     the first argument to pass to the method.
+   * @param arg2     the second argument to pass to the method.
+   * @param arg3     the third argument to pass to the method.
+   * @param arg4     the fourth argument to pass to the method.
+   * @param arg5     the fifth argument to pass to the method.
+   * @param <V>      the type of values returned by the wrapped method.
+   * @return the return value of the method invocation.
+   */
+  default @UnknownNullability <V> V invoke5(
+    @Nullable Object instance,
+    @Nullable Object arg1,
+    @Nullable Object arg2,
+    @Nullable Object arg3,
+    @Nullable Object arg4,
+    @Nullable Object arg5
+  ) {
+    return this.invokeDirect(instance, arg1, arg2, arg3, arg4, arg5);
+  }
+
+  /**
+   * Invokes the wrapped method on each of the given instances, using the arguments at the same index of the given
+   * argument array and storing the return value at the same index of the given result array. Unlike calling
+   * {@link #invoke(Object, Object...)} for each instance, no result instance is allocated per invocation and the
+   * modifiers of the member are only checked once. Invocations which fail are reported in the returned batch result,
+   * the corresponding index of the result array is left untouched.
+   * <p>
+   * For static methods and constructors the instances are ignored, the length of the instance array only determines
+   * the number of invocations.
+   *
+   * @param instances the instances to invoke the wrapped method on.
+   * @param args      the arguments for each invocation, null to invoke the method without arguments each time.
+   * @param results   the array to store the return values in, null if the return values are not needed.
+   * @return the result of the batch, holding the index and exception of all failed invocations.
+   * @throws NullPointerException     if the given instance array is null.
+   * @throws IllegalArgumentException if the argument or result array is shorter than the instance array.
+   * @since 1.4
+   */
+  default @NonNull BatchResult invokeAll(
+    @NonNull Object[] instances,
+    @Nullable Object[][] args,
+    @Nullable Object[] results
+  ) {
+    BatchResult.Collector collector = new BatchResult.Collector();
+    if (args != null) {
+      BatchResult.Collector.checkLength(instances.length, args.length);
+    }
+    if (results != null) {
+      BatchResult.Collector.checkLength(instances.length, results.length);
+    }
+
+    boolean isStatic = Modifier.isStatic(this.getMember().getModifiers());
+    for (int i = 0; i < instances.length; i++) {
+      try {
+        Object instance = isStatic ? null : instances[i];
+        Object result = args == null || args[i] == null
+          ? this.invokeDirect(instance)
+          : this.invokeDirect(instance, args[i]);
+        if (results != null) {
+          results[i] = result;
+        }
+      } catch (Throwable throwable) {
+        collector.fail(i, throwable);
+      }
+    }
+    return collector.finish();
+  }
+
+  /**
+   * Get an implementation of the given functional interface which directly invokes the wrapped method or constructor.
+   * The implementation is spun using the lambda metafactory and calls the member without a method handle, result or
+   * argument array in between, which makes calls through the interface almost as fast as direct calls once inlined.
+   * <p>
+   * The interface method must take the same parameters as the member, preceded by the receiver for instance methods.
+   * If the receiver is omitted, the implementation is bound to the binding of the reflexion instance of this accessor.
+   * Parameter and return types are adapted (boxing, unboxing and casting) as in a method reference, for example:
+   * <pre>
+   * {@code
+   *  Function<HelloWorld, String> greet = Reflexion.on(HelloWorld.class)
+   *    .findMethod("greet")
+   *    .map(accessor -> accessor.asInterface(Function.class))
+   *    .orElseThrow(IllegalStateException::new);
+   * }
+   * </pre>
+   * Binding is expensive, callers should create the implementation once and keep it.
+   *
+   * @param samType the functional interface to implement.
+   * @param <F>     the type of the functional interface.
+   * @return an implementation of the given functional interface invoking the wrapped member.
+   * @throws NullPointerException     if the given interface type is null.
+   * @throws IllegalArgumentException if the given type is not a functional interface matching the member.
+   * @throws ReflexionException       if the interface cannot be bound to the member.
+   * @since 1.4
+   */
+  default @NonNull <F> F asInterface(@NonNull Class<F> samType) {
+    return LambdaBinder.bindMember(this, samType);
+  }
+
+  /**
+   * Get a method handle which invokes the wrapped method or constructor. The returned handle has the exact original
+   * type of the member, which is {@code (DeclaringClass,Params...)ReturnType} for instance methods,
+   * {@code (Params...)ReturnType} for static methods and {@code (Params...)DeclaringClass} for constructors. The handle
+   * is created using the trusted lookup if available, which means that it can invoke every member regardless of its
+   * visibility.
+   * <p>
+   * Callers should store the returned handle in a {@code static final} field and call it using {@code invokeExact},
+   * which allows the jvm to inline the call completely. This method creates a new handle on each call in some
+   * implementations, it should therefore not be called on a hot path.
+   *
+   * @return a method handle invoking the wrapped member.
+   * @throws ReflexionException if the handle cannot be created.
+   * @since 1.4
+   */
+  default @NonNull MethodHandle asMethodHandle() {
+    return AccessorHandles.invokerHandle(this);
+  }
 }
@@ -0,0 +1,276 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.reflect.Field;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.function.Function;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+import org.jetbrains.annotations.Unmodifiable;
+
+/**
+ * A fixed projection of some fields of a class, compiled into a dense array of field accessors. Each field of the shape
+ * is assigned a slot index, the fields are ordered by their declaring class (super classes first) and by their name
+ * in the same declaring class. As the order does only depend on the class hierarchy, it stays the same between
+ * different runs of the same application.
+ * <p>
+ * A shape allows to read or write all fields of an instance in a single loop over a slot array, without any map
+ * lookups or iterator allocation, which makes it suitable as a base for serializers and mappers:
+ * <pre>
+ * {@code
+ *  ObjectShape shape = Reflexion.on(HelloWorld.class).shape(FieldMatcher.newMatcher().denyModifier(Modifier.STATIC));
+ *  Object[] slots = shape.newSlots();
+ *  shape.readInto(helloWorld, slots);
+ *  Object world = slots[shape.slotOf("world")];
+ * }
+ * </pre>
+ * Shapes are immutable and can be shared between threads. Creating a shape is not cheap, callers should create the
+ * shape once and keep it.
+ *
+ * @since 1.4
+ */
+public final class ObjectShape {
+
+  // sorts by the depth of the declaring class in the hierarchy first, then by the field name
+  private static final Comparator<Field> FIELD_ORDER = Comparator
+    .<Field>comparingInt(field -> hierarchyDepth(field.getDeclaringClass()))
+    .thenComparing(Field::getName);
+
+  private final ReflexionRegistry.ClassMembers members;
+  private final FieldAccessor[] accessors;
+  private final List<String> fieldNames;
+  private final Map<String, Integer> slotIndexes;
+
+  /**
+   * Constructs a new object shape.
+   *
+   * @param members     the shared members of the type the shape was created for.
+   * @param accessors   the accessors of the fields in the shape, in slot order.
+   * @param fieldNames  the names of the fields in the shape, in slot order.
+   * @param slotIndexes the slot index of each field name.
+   */
+  private ObjectShape(
+    @NonNull ReflexionRegistry.ClassMembers members,
+    @NonNull FieldAccessor[] accessors,
+    @NonNull @Unmodifiable List<String> fieldNames,
+    @NonNull Map<String, Integer> slotIndexes
+  ) {
+    this.members = members;
+    this.accessors = accessors;
+    this.fieldNames = fieldNames;
+    this.slotIndexes = slotIndexes;
+  }
+
+  /**
+   * Compiles a new shape for the given fields. The given fields are ordered into their slots before wrapping them.
+   *
+   * @param members the shared members of the type the shape is created for.
+   * @param fields  the fields to include in the shape.
+   * @param wrapper the function to wrap each field into an accessor.
+   * @return a new shape for the given fields.
+   * @throws NullPointerException if the given members, field list or wrapper is null.
+   */
+  static @NonNull ObjectShape compile(
+    @NonNull ReflexionRegistry.ClassMembers members,
+    @NonNull List<Field> fields,
+    @NonNull Function<Field, FieldAccessor> wrapper
+  ) {
+    List<Field> ordered = new ArrayList<>(fields);
+    ordered.sort(FIELD_ORDER);
+
+    FieldAccessor[] accessors = new FieldAccessor[ordered.size()];
+    List<String> fieldNames = new ArrayList<>(ordered.size());
+    Map<String, Integer> slotIndexes = new HashMap<>();
+    for (int i = 0; i < accessors.length; i++) {
+      Field field = ordered.get(i);
+      accessors[i] = wrapper.apply(field);
+      fieldNames.add(field.getName());
+      // a field hiding a field of a super class wins, as super class fields are ordered first
+      slotIndexes.put(field.getName(), i);
+    }
+
+    return new ObjectShape(members, accessors, Collections.unmodifiableList(fieldNames), slotIndexes);
+  }
+
+  /**
+   * Get the depth of the given class in its hierarchy, zero for classes without a super class.
+   *
+   * @param type the class to get the depth of.
+   * @return the depth of the given class in its hierarchy.
+   */
+  private static int hierarchyDepth(@NonNull Class<?> type) {
+    int depth = 0;
+    for (Class<?> current = type.getSuperclass(); current != null; current = current.getSuperclass()) {
+      depth++;
+    }
+    return depth;
+  }
+
+  /**
+   * Get the type this shape was created for.
+   *
+   * @return the type this shape was created for.
+   */
+  public @NonNull Class<?> getType() {
+    return this.members.getType();
+  }
+
+  /**
+   * Get the amount of fields (and therefore slots) in this shape.
+   *
+   * @return the amount of fields in this shape.
+   */
+  public int getFieldCount() {
+    return this.accessors.length;
+  }
+
+  /**
+   * Get the names of all fields in this shape, the index of each name in the list is the slot of the field.
+   *
+   * @return the names of all fields in this shape, in slot order.
+   */
+  public @NonNull @Unmodifiable List<String> getFieldNames() {
+    return this.fieldNames;
+  }
+
+  /**
+   * Get the accessor of the field in the given slot.
+   *
+   * @param slot the slot of the field to get the accessor of.
+   * @return the accessor of the field in the given slot.
+   * @throws IndexOutOfBoundsException if the given slot does not exist in this shape.
+   */
+  public @NonNull FieldAccessor getAccessor(int slot) {
+    return this.accessors[slot];
+  }
+
+  /**
+   * Get the slot of the field with the given name. If this shape contains multiple fields with the given name (because
+   * a field in a subclass hides a field of a super class), the slot of the field declared in the subclass is returned.
+   *
+   * @param fieldName the name of the field to get the slot of.
+   * @return the slot of the field with the given name, -1 if no field with the given name is part of this shape.
+   * @throws NullPointerException if the given field name is null.
+   */
+  public int slotOf(@NonNull String fieldName) {
+    Integer slot = this.slotIndexes.get(fieldName);
+    return slot == null ? -1 : slot;
+  }
+
+  /**
+   * Creates a new slot array which can hold the values of all fields in this shape.
+   *
+   * @return a new slot array for this shape.
+   */
+  public @NonNull Object[] newSlots() {
+    return new Object[this.accessors.length];
+  }
+
+  /**
+   * Reads the values of all fields in this shape from the given instance into their slot in the given array.
+   * Exceptions thrown while reading a field are rethrown unchecked.
+   *
+   * @param instance the instance to read the field values from, ignored for static fields.
+   * @param slots    the array to store the field values in.
+   * @throws NullPointerException     if the given slot array is null.
+   * @throws IllegalArgumentException if the given slot array is shorter than the field count of this shape.
+   */
+  public void readInto(@Nullable Object instance, @NonNull Object[] slots) {
+    this.checkSlots(slots);
+    FieldAccessor[] accessors = this.accessors;
+    for (int i = 0; i < accessors.length; i++) {
+      slots[i] = accessors[i].getValueDirect(instance);
+    }
+  }
+
+  /**
+   * Writes the values in the slots of the given array into the corresponding fields of the given instance. Exceptions
+   * thrown while writing a field are rethrown unchecked.
+   *
+   * @param slots    the array holding the values to write.
+   * @param instance the instance to write the field values into, ignored for static fields.
+   * @throws NullPointerException     if the given slot array is null.
+   * @throws IllegalArgumentException if the given slot array is shorter than the field count of this shape.
+   */
+  public void writeFrom(@NonNull Object[] slots, @Nullable Object instance) {
+    this.checkSlots(slots);
+    FieldAccessor[] accessors = this.accessors;
+    for (int i = 0; i < accessors.length; i++) {
+      accessors[i].setValueDirect(instance, slots[i]);
+    }
+  }
+
+  /**
+   * Allocates a new instance of the type of this shape without running any of its constructors and writes the values
+   * in the slots of the given array into it, see {@link Reflexion#allocateInstance()}. The instance is built with a
+   * single allocation, fields which are not part of this shape hold their default values. Exceptions thrown while
+   * writing a field are rethrown unchecked.
+   *
+   * @param slots the array holding the values to write.
+   * @param <T>   the type of the allocated instance.
+   * @return a new instance of the type of this shape, populated with the given values.
+   * @throws NullPointerException     if the given slot array is null.
+   * @throws IllegalArgumentException if the slot array is too short or the type cannot be allocated.
+   * @throws ReflexionException       if instances cannot be allocated without a constructor in the current jvm.
+   */
+  @SuppressWarnings("unchecked")
+  public @NonNull <T> T allocate(@NonNull Object[] slots) {
+    this.checkSlots(slots);
+    try {
+      Object instance = this.members.getAllocator().invokeExact();
+      this.writeFrom(slots, instance);
+      return (T) instance;
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Checks that the given slot array can hold the values of all fields in this shape.
+   *
+   * @param slots the slot array to check.
+   * @throws IllegalArgumentException if the given slot array is shorter than the field count of this shape.
+   */
+  private void checkSlots(@NonNull Object[] slots) {
+    if (slots.length < this.accessors.length) {
+      throw new IllegalArgumentException("Slot array length " + slots.length + " is less than " + this.getFieldCount());
+    }
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull String toString() {
+    return "ObjectShape(type=" + this.getType().getName() + ", fields=" + this.fieldNames + ")";
+  }
+}
@@ -25,16 +25,29 @@
 package dev.derklaro.reflexion;
 
 import dev.derklaro.reflexion.internal.AccessorFactoryLoader;
+import dev.derklaro.reflexion.internal.util.FlightEvents;
+import dev.derklaro.reflexion.internal.util.Stats;
 import dev.derklaro.reflexion.internal.util.Util;
 import dev.derklaro.reflexion.matcher.ConstructorMatcher;
 import dev.derklaro.reflexion.matcher.FieldMatcher;
+import dev.derklaro.reflexion.matcher.MatcherPlan;
 import dev.derklaro.reflexion.matcher.MethodMatcher;
 import java.lang.reflect.Constructor;
 import java.lang.reflect.Field;
+import java.lang.reflect.Member;
 import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
 import java.util.Collection;
+import java.util.Collections;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
 import java.util.Optional;
 import java.util.Set;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.Executor;
+import java.util.concurrent.ForkJoinPool;
 import lombok.NonNull;
 import org.jetbrains.annotations.Contract;
 import org.jetbrains.annotations.Nullable;
@@ -109,25 +122,33 @@
  * <p>
  * As probably seen by the methods shown above using reflexion over normal java.lang reflection is much more convenient.
  * Furthermore, reflexion does everything for you as safe as possible while also providing the best performance to
- * access class members. To archive that you should cache your obtained reflexion instances, as each of them will
- * maintain a non-shared cache over all members in a class. A good practice is something like:
+ * access class members. The members of a class are cached process-wide and shared between all reflexion instances
+ * targeting the same class, therefore creating a new reflexion instance for a class is cheap. It is still good
+ * practice to keep the reflexion instances around, for example like:
  * <pre>
  * {@code
  *  public static final Reflexion HELLO_WORLD_REFLEXION = Reflexion.on(HelloWorld.class);
  * }
  * </pre>
  * Note that the member caches are only populated when they are actually needed, meaning that if you only query fields
- * from a reflexion instance no methods or constructors from the class will get fetched and vise-versa.
+ * for a class no methods or constructors from the class will get fetched and vise-versa.
+ * <p>
+ * Reflexion instances are immutable and thread-safe, they can be shared freely between threads. The shared member
+ * caches of a class are populated at most once, even if multiple threads request them concurrently, and reading them
+ * afterwards does not require any locking.
  *
  * @since 1.0
  */
 public final class Reflexion {
 
+  // the report of the selection of the default accessor factory
+  private static final AccessorFactorySelection FACTORY_SELECTION = AccessorFactoryLoader.selectFactory();
+
   /**
    * The current used accessor factory to wrap fields, methods and constructors. Initialized once when the class is
    * first used.
    */
-  public static final AccessorFactory ACCESSOR_FACTORY = AccessorFactoryLoader.doLoadFactory();
+  public static final AccessorFactory ACCESSOR_FACTORY = FACTORY_SELECTION.getSelectedFactory();
 
   // the class wrapped by this reflexion instance
   private final Class<?> wrappedClass;
@@ -137,25 +158,111 @@ public final class Reflexion {
   // this is null when the reflexion is not bound to anything
   @Nullable
   private final Object binding;
-
-  // class member caches, created lazily when needed
-  private Set<Field> fields;
-  private Set<Method> methods;
-  private Set<Constructor<?>> constructors;
+  // the shared member caches of the wrapped class
+  private final ReflexionRegistry.ClassMembers members;
+  // the shared unbound instance targeting the same class with the same factory, this instance if unbound
+  private final Reflexion unbound;
 
   /**
-   * Constructs a new reflexion instance. Do not use this constructor directly refer to the static factory methods in
-   * this class (see the top-level documentation comment for more details).
+   * Constructs a new unbound reflexion instance. Do not use this constructor directly refer to the static factory
+   * methods in this class (see the top-level documentation comment for more details).
    *
    * @param wrappedClass the class wrapped by the constructed reflexion instance.
-   * @param binding      the instance to which the reflection instance is bound, null for no binding.
+   * @param members      the shared member caches of the wrapped class.
    * @param factory      the accessor factory to use when wrapping reflection objects.
-   * @throws NullPointerException if the given wrapped class is null.
    */
-  private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @NonNull AccessorFactory factory) {
+  private Reflexion(
+    @NonNull Class<?> wrappedClass,
+    @NonNull ReflexionRegistry.ClassMembers members,
+    @NonNull AccessorFactory factory
+  ) {
     this.wrappedClass = wrappedClass;
-    this.binding = binding;
+    this.binding = null;
     this.accFactory = factory;
+    this.members = members;
+    this.unbound = this;
+  }
+
+  /**
+   * Constructs a new bound view of the given unbound reflexion instance. The view shares all caches and accessors with
+   * the given instance, therefore constructing it requires no lookups.
+   *
+   * @param unbound the shared unbound instance to create the view of.
+   * @param binding the instance to which the view is bound.
+   */
+  private Reflexion(@NonNull Reflexion unbound, @NonNull Object binding) {
+    this.wrappedClass = unbound.wrappedClass;
+    this.binding = binding;
+    this.accFactory = unbound.accFactory;
+    this.members = unbound.members;
+    this.unbound = unbound;
+  }
+
+  /**
+   * Get the report of the selection of the default accessor factory ({@link #ACCESSOR_FACTORY}). The report contains
+   * all factories which were probed during the selection and the time each probe took.
+   *
+   * @return the report of the default accessor factory selection.
+   * @since 1.4
+   */
+  public static @NonNull AccessorFactorySelection getFactorySelection() {
+    return FACTORY_SELECTION;
+  }
+
+  /**
+   * Takes a snapshot of the process-wide runtime statistics of reflexion. Collecting statistics is disabled by default
+   * and can be enabled by setting the {@code dev.derklaro.reflexion.stats} system property to true, if disabled all
+   * counters of the returned snapshot are zero. See {@link ReflexionStats} for the collected statistics.
+   *
+   * @return a snapshot of the current runtime statistics.
+   * @since 1.4
+   */
+  public static @NonNull ReflexionStats stats() {
+    return Stats.snapshot();
+  }
+
+  /**
+   * Resets all runtime statistics of reflexion to zero. This method has no effect if collecting statistics is disabled.
+   *
+   * @since 1.4
+   */
+  public static void resetStats() {
+    Stats.reset();
+  }
+
+  /**
+   * Get a snapshot of the current usage of the shared member and accessor caches. The caches hold classes weakly, the
+   * entries of a class are released once the class is unloaded.
+   *
+   * @return a snapshot of the current cache usage.
+   * @since 1.4
+   */
+  public static @NonNull ReflexionCacheUsage cacheUsage() {
+    return ReflexionRegistry.usage();
+  }
+
+  /**
+   * Drops all entries of the shared member, accessor and class resolution caches. Existing reflexion instances and
+   * accessors stay usable, the caches are populated again when classes, members or accessors are requested.
+   *
+   * @since 1.4
+   */
+  public static void clearCaches() {
+    ReflexionRegistry.invalidateAll();
+    ClassResolutionCache.invalidateAll();
+  }
+
+  /**
+   * Drops the cached class resolution results of the given class loader. This is required if a class which could not
+   * be found previously using one of the find methods (for example {@link #find(String, ClassLoader)}) became available
+   * through the given class loader, for example because it was defined at runtime.
+   *
+   * @param loader the loader to drop the cached class resolution results of.
+   * @throws NullPointerException if the given loader is null.
+   * @since 1.4
+   */
+  public static void invalidateClassResolution(@NonNull ClassLoader loader) {
+    ClassResolutionCache.invalidate(loader);
   }
 
   // ------------------
@@ -229,7 +336,13 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
     @Nullable Object binding,
     @NonNull AccessorFactory factory
   ) {
-    return new Reflexion(clazz, binding, factory);
+    // the unbound instance is shared per class and factory, bound instances are lightweight views over it
+    ReflexionRegistry.ClassMembers members = ReflexionRegistry.lookup(clazz);
+    Reflexion unbound = members.getReflexion(factory);
+    if (unbound == null) {
+      unbound = members.putReflexion(factory, new Reflexion(clazz, members, factory));
+    }
+    return binding == null ? unbound : new Reflexion(unbound, binding);
   }
 
   /**
@@ -260,7 +373,10 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    *   <li>the system class loader.
    * </ol>
    * <p>
-   * This method will not initialize the class when wrapping it.
+   * This method will not initialize the class when wrapping it. The result of the resolution is cached per class
+   * loader, including the names which could not be resolved. If a class becomes available at runtime after it was
+   * looked up unsuccessfully, the cache of the loader must be invalidated using
+   * {@link #invalidateClassResolution(ClassLoader)}.
    *
    * @param name   the name of the class to find.
    * @param loader the loader to search the class in, null to use the first available contextual loader.
@@ -268,22 +384,19 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given class name is null.
    */
   public static @NonNull Optional<Reflexion> find(@NonNull String name, @Nullable ClassLoader loader) {
-    try {
-      // no loader, try the context loader
-      // if the context loader is null we try this class loader in order someone tried something weird
-      // if this class has no loader either we fall back to the system class loader (should never happen)
-      ClassLoader classLoader = Util.firstNonNull(
-        loader,
-        Thread.currentThread().getContextClassLoader(),
-        Reflexion.class.getClassLoader(),
-        ClassLoader.getSystemClassLoader());
-      Class<?> wrappedClass = Class.forName(name, false, classLoader);
-      // found the class, wrap it
-      return Optional.of(on(wrappedClass));
-    } catch (ClassNotFoundException exception) {
-      // class not found, nothing to wrap
-      return Optional.empty();
-    }
+    Object event = FlightEvents.beginClassResolution();
+    // no loader, try the context loader
+    // if the context loader is null we try this class loader in order someone tried something weird
+    // if this class has no loader either we fall back to the system class loader (should never happen)
+    ClassLoader classLoader = Util.firstNonNull(
+      loader,
+      Thread.currentThread().getContextClassLoader(),
+      Reflexion.class.getClassLoader(),
+      ClassLoader.getSystemClassLoader());
+    Class<?> wrappedClass = ClassResolutionCache.resolve(name, classLoader);
+    FlightEvents.endClassResolution(event, name, wrappedClass != null);
+    // wrap the class if it was found
+    return wrappedClass == null ? Optional.empty() : Optional.of(on(wrappedClass));
   }
 
   /**
@@ -325,7 +438,8 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    *   <li>the system class loader.
    * </ol>
    * <p>
-   * This method will not initialize the class when wrapping it.
+   * This method will not initialize the class when wrapping it. If the same names are searched repeatedly, consider
+   * using {@link ClassCandidates} which tries the name that matched last first.
    *
    * @param loader the loader to search the class in, null to use the first available contextual loader.
    * @param names  the names of the class to search for.
@@ -380,7 +494,8 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    *   <li>the system class loader.
    * </ol>
    * <p>
-   * This method will not initialize the class when wrapping it.
+   * This method will not initialize the class when wrapping it. If the same names are searched repeatedly, consider
+   * using {@link ClassCandidates} which tries the name that matched last first.
    *
    * @param loader the loader to search the class in, null to use the first available contextual loader.
    * @param names  the names of the class to search for.
@@ -395,6 +510,96 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
     });
   }
 
+  // ------------------
+  // preloading
+  // ------------------
+
+  /**
+   * Preloads the given targets in parallel on the common fork join pool. See
+   * {@link #preload(ClassLoader, Collection, Executor)} for details.
+   *
+   * @param loader  the loader to resolve the target classes with, null to use the first available contextual loader.
+   * @param targets the targets to preload.
+   * @return a future completed with the reflexion instances of all resolved targets, keyed by their class name.
+   * @throws NullPointerException if the given target collection is null.
+   * @since 1.4
+   */
+  public static @NonNull CompletableFuture<Map<String, Reflexion>> preload(
+    @Nullable ClassLoader loader,
+    @NonNull Collection<TargetSpec> targets
+  ) {
+    return preload(loader, targets, ForkJoinPool.commonPool());
+  }
+
+  /**
+   * Preloads the given targets in parallel using the given executor. For each target the class is resolved (see
+   * {@link #find(String, ClassLoader)}), the shared member caches of the class are populated and accessors for the
+   * declared members are created using the default accessor factory. As all created accessors are put into the shared
+   * caches, later lookups of the preloaded members are cache hits.
+   * <p>
+   * Targets of which the class cannot be found and members which do not exist are skipped. The returned future is
+   * completed exceptionally if preloading one of the targets failed unexpectedly.
+   *
+   * @param loader   the loader to resolve the target classes with, null to use the first available contextual loader.
+   * @param targets  the targets to preload.
+   * @param executor the executor to preload the targets on.
+   * @return a future completed with the reflexion instances of all resolved targets, keyed by their class name.
+   * @throws NullPointerException if the given target collection or executor is null.
+   * @since 1.4
+   */
+  public static @NonNull CompletableFuture<Map<String, Reflexion>> preload(
+    @Nullable ClassLoader loader,
+    @NonNull Collection<TargetSpec> targets,
+    @NonNull Executor executor
+  ) {
+    // resolve the contextual loader on the calling thread, the context loader of the executor threads might differ
+    ClassLoader classLoader = Util.firstNonNull(
+      loader,
+      Thread.currentThread().getContextClassLoader(),
+      Reflexion.class.getClassLoader(),
+      ClassLoader.getSystemClassLoader());
+
+    List<CompletableFuture<Optional<Reflexion>>> futures = new ArrayList<>(targets.size());
+    for (TargetSpec target : targets) {
+      futures.add(CompletableFuture.supplyAsync(() -> preloadTarget(classLoader, target), executor));
+    }
+
+    return CompletableFuture.allOf(futures.toArray(new CompletableFuture[0])).thenApply(ignored -> {
+      Map<String, Reflexion> preloaded = new LinkedHashMap<>();
+      for (CompletableFuture<Optional<Reflexion>> future : futures) {
+        future.join().ifPresent(reflexion -> preloaded.put(reflexion.getWrappedClass().getName(), reflexion));
+      }
+      return Collections.unmodifiableMap(preloaded);
+    });
+  }
+
+  /**
+   * Internal: resolves the class of the given target, populates its member caches and wraps the declared members.
+   *
+   * @param loader the loader to resolve the target class with.
+   * @param target the target to preload.
+   * @return the reflexion instance of the target class, empty if the class cannot be found.
+   */
+  private static @NonNull Optional<Reflexion> preloadTarget(@NonNull ClassLoader loader, @NonNull TargetSpec target) {
+    return find(target.getClassName(), loader).map(reflexion -> {
+      // populate all member caches of the class
+      reflexion.getFieldCache();
+      reflexion.getMethodCache();
+      reflexion.getConstructorCache();
+
+      for (String fieldName : target.getFieldNames()) {
+        reflexion.findField(fieldName);
+      }
+      for (String methodName : target.getMethodNames()) {
+        reflexion.findMethods(MethodMatcher.newMatcher().hasName(methodName));
+      }
+      if (target.isConstructors()) {
+        reflexion.findConstructors(ConstructorMatcher.newMatcher());
+      }
+      return reflexion;
+    });
+  }
+
   // ------------------
   // instance methods
   // ------------------
@@ -424,16 +629,18 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * }
    * </pre>
    * <p>
-   * Note: this method always returns a new reflexion instance and not the instance the method was called on. Re-using
-   * the instance from before the method call is still possible without any changes to the bindings. Changes to the
-   * returned reflexion instance will not reflect into this instance as vice-versa.
+   * Note: this method never returns the instance the method was called on (unless it is unbound and the binding is
+   * released). Re-using the instance from before the method call is still possible without any changes to the bindings.
+   * Bound instances are lightweight views over the unbound instance shared by all reflexion instances targeting the
+   * same class with the same accessor factory, binding an instance therefore only costs a single small allocation and
+   * shares all cached members and accessors. Releasing the binding returns the shared unbound instance.
    *
    * @param binding the object instance to bind the reflexion instance to, null to release the binding.
    * @return a new reflexion instance targeting the same class as the current one but with the given binding set.
    */
-  @Contract(value = "_ -> new", pure = true)
+  @Contract(pure = true)
   public @NonNull Reflexion bind(@Nullable Object binding) {
-    return new Reflexion(this.wrappedClass, binding, this.accFactory);
+    return binding == null ? this.unbound : new Reflexion(this.unbound, binding);
   }
 
   /**
@@ -469,8 +676,11 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
 
   /**
    * Finds a field with the given name in the wrapped class and creates a field accessor wrapper for it. Internally this
-   * method uses a cache for all fields in the class, meaning that each call to the method will not result in duplicate
-   * lookups in the wrapped class.
+   * method uses a hash index over all fields in the class, meaning that each call to the method will neither result in
+   * duplicate lookups in the wrapped class nor in testing every field of it. If multiple fields with the given name
+   * exist in the class hierarchy, the field declared closest to the wrapped class is returned. If the fields of the
+   * class were not cached before, the class hierarchy is travelled lazily beginning at the wrapped class and stops at
+   * the first match.
    * <p>
    * Example usage:
    * <pre>
@@ -489,12 +699,15 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given field name is null.
    */
   public @NonNull Optional<FieldAccessor> findField(@NonNull String name) {
-    return this.findField(FieldMatcher.newMatcher().hasName(name));
+    Field field = this.members.findField(name);
+    return field == null ? Optional.empty() : Optional.of(this.wrapField(field));
   }
 
   /**
    * Finds the first field which matches the given matcher. Internally this method uses a cache for all fields in the
-   * class, meaning that each call to the method will not result in duplicate lookups in the wrapped class.
+   * class, meaning that each call to the method will not result in duplicate lookups in the wrapped class. If the
+   * fields of the class were not cached before, the class hierarchy is travelled lazily beginning at the wrapped class
+   * and stops at the first match.
    * <p>
    * Example usage:
    * <pre>
@@ -513,12 +726,8 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given matcher is null.
    */
   public @NonNull Optional<FieldAccessor> findField(@NonNull FieldMatcher matcher) {
-    for (Field field : this.getFieldCache()) {
-      if (matcher.test(field)) {
-        return Optional.of(this.accFactory.wrapField(this, field));
-      }
-    }
-    return Optional.empty();
+    Field field = this.members.findField(matcher.compile());
+    return field == null ? Optional.empty() : Optional.of(this.wrapField(field));
   }
 
   /**
@@ -540,7 +749,9 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given matcher is null.
    */
   public @NonNull Collection<FieldAccessor> findFields(@NonNull FieldMatcher matcher) {
-    return Util.filterAndMap(this.getFieldCache(), matcher, field -> this.accFactory.wrapField(this, field));
+    MatcherPlan<Field> plan = matcher.compile();
+    List<Field> fields = this.members.findMatching(plan, this.getFieldCache(), this.members.getFieldIndex());
+    return Util.map(fields, this::wrapField);
   }
 
   // ------------------
@@ -549,9 +760,11 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
 
   /**
    * Finds a method with the given name and parameter types in the wrapped class and creates a method accessor wrapper
-   * for it. The given parameter types must match exactly and aren't derived types. Internally this method uses a cache
-   * for all methods in the class, meaning that each call to the method will not result in duplicate lookups in the
-   * wrapped class.
+   * for it. The given parameter types must match exactly and aren't derived types. Internally this method uses a hash
+   * index over all methods in the class, meaning that each call to the method will neither result in duplicate lookups
+   * in the wrapped class nor in testing every method of it. If multiple methods with the given signature exist in the
+   * class hierarchy, the method declared closest to the wrapped class is returned. If the methods of the class were not
+   * cached before, the class hierarchy is travelled lazily beginning at the wrapped class and stops at the first match.
    * <p>
    * Example usage:
    * <pre>
@@ -571,13 +784,15 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given method name or parameter array is null.
    */
   public @NonNull Optional<MethodAccessor<Method>> findMethod(@NonNull String name, @NonNull Class<?>... paramTypes) {
-    return this.findMethod(MethodMatcher.newMatcher().hasName(name).exactTypes(Method::getParameterTypes, paramTypes));
+    Method method = this.members.findMethod(name, paramTypes);
+    return method == null ? Optional.empty() : Optional.of(this.wrapMethod(method));
   }
 
   /**
    * Finds the first method which matches the given matcher in the wrapped class and creates a method accessor wrapper
    * for it. Internally this method uses a cache for all methods in the class, meaning that each call to the method will
-   * not result in duplicate lookups in the wrapped class.
+   * not result in duplicate lookups in the wrapped class. If the methods of the class were not cached before, the class
+   * hierarchy is travelled lazily beginning at the wrapped class and stops at the first match.
    * <p>
    * Example usage:
    * <pre>
@@ -596,12 +811,8 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given matcher is null.
    */
   public @NonNull Optional<MethodAccessor<Method>> findMethod(@NonNull MethodMatcher matcher) {
-    for (Method method : this.getMethodCache()) {
-      if (matcher.test(method)) {
-        return Optional.of(this.accFactory.wrapMethod(this, method));
-      }
-    }
-    return Optional.empty();
+    Method method = this.members.findMethod(matcher.compile());
+    return method == null ? Optional.empty() : Optional.of(this.wrapMethod(method));
   }
 
   /**
@@ -624,7 +835,9 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given matcher is null.
    */
   public @NonNull Collection<MethodAccessor<Method>> findMethods(@NonNull MethodMatcher matcher) {
-    return Util.filterAndMap(this.getMethodCache(), matcher, method -> this.accFactory.wrapMethod(this, method));
+    MatcherPlan<Method> plan = matcher.compile();
+    List<Method> methods = this.members.findMatching(plan, this.getMethodCache(), this.members.getMethodIndex());
+    return Util.map(methods, this::wrapMethod);
   }
 
   // ------------------
@@ -633,9 +846,12 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
 
   /**
    * Finds a constructor with the given parameter types in the wrapped class and creates a method accessor wrapper for
-   * it. The given parameter types must match exactly and aren't derived types. Internally this method uses a cache for
-   * all constructors in the class, meaning that each call to the method will not result in duplicate lookups in the
-   * wrapped class.
+   * it. The given parameter types must match exactly and aren't derived types. Internally this method uses a hash index
+   * over all constructors in the class, meaning that each call to the method will neither result in duplicate lookups
+   * in the wrapped class nor in testing every constructor of it. If multiple constructors with the given parameter
+   * types exist in the class hierarchy, the constructor declared closest to the wrapped class is returned. If the
+   * constructors of the class were not cached before, the class hierarchy is travelled lazily beginning at the wrapped
+   * class and stops at the first match.
    * <p>
    * Example usage:
    * <pre>
@@ -654,13 +870,15 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given parameter array is null.
    */
   public @NonNull Optional<MethodAccessor<Constructor<?>>> findConstructor(@NonNull Class<?>... paramTypes) {
-    return this.findConstructor(ConstructorMatcher.newMatcher().exactTypes(Constructor::getParameterTypes, paramTypes));
+    Constructor<?> constructor = this.members.findConstructor(paramTypes);
+    return constructor == null ? Optional.empty() : Optional.of(this.wrapConstructor(constructor));
   }
 
   /**
    * Finds the first constructor matching the given matcher in the wrapped class and creates a method accessor wrapper
    * for it. Internally this method uses a cache for all constructors in the class, meaning that each call to the method
-   * will not result in duplicate lookups in the wrapped class.
+   * will not result in duplicate lookups in the wrapped class. If the constructors of the class were not cached before,
+   * the class hierarchy is travelled lazily beginning at the wrapped class and stops at the first match.
    * <p>
    * Example usage:
    * <pre>
@@ -680,12 +898,8 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given matcher is null.
    */
   public @NonNull Optional<MethodAccessor<Constructor<?>>> findConstructor(@NonNull ConstructorMatcher matcher) {
-    for (Constructor<?> constructor : this.getConstructorCache()) {
-      if (matcher.test(constructor)) {
-        return Optional.of(this.accFactory.wrapConstructor(this, constructor));
-      }
-    }
-    return Optional.empty();
+    Constructor<?> ctor = this.members.findConstructor(matcher.compile());
+    return ctor == null ? Optional.empty() : Optional.of(this.wrapConstructor(ctor));
   }
 
   /**
@@ -709,7 +923,176 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
    * @throws NullPointerException if the given matcher is null.
    */
   public @NonNull Collection<MethodAccessor<Constructor<?>>> findConstructors(@NonNull ConstructorMatcher matcher) {
-    return Util.filterAndMap(this.getConstructorCache(), matcher, ctr -> this.accFactory.wrapConstructor(this, ctr));
+    MatcherPlan<Constructor<?>> plan = matcher.compile();
+    MemberIndex<Constructor<?>> index = this.members.getConstructorIndex();
+    List<Constructor<?>> ctors = this.members.findMatching(plan, this.getConstructorCache(), index);
+    return Util.map(ctors, this::wrapConstructor);
+  }
+
+  /**
+   * Allocates a new instance of the wrapped class without running any of its constructors. All fields of the returned
+   * instance hold their default values (null, 0 or false), even if they are initialized in their declaration. This is
+   * useful in combination with {@link ObjectShape#allocate(Object[])} when deserializing classes with expensive or
+   * side effecting constructors, as all fields are overwritten anyway.
+   * <p>
+   * Example usage:
+   * <pre>
+   * {@code
+   *  public static HelloWorld newUninitializedHelloWorld() {
+   *    return Reflexion.on(HelloWorld.class).allocateInstance();
+   *  }
+   * }
+   * </pre>
+   *
+   * @param <T> the type of the wrapped class.
+   * @return a new instance of the wrapped class on which no constructor was run.
+   * @throws IllegalArgumentException if the wrapped class is abstract, an interface, an array or a primitive type.
+   * @throws ReflexionException       if instances cannot be allocated without a constructor in the current jvm.
+   * @since 1.4
+   */
+  @SuppressWarnings("unchecked")
+  public @NonNull <T> T allocateInstance() {
+    try {
+      return (T) this.members.getAllocator().invokeExact();
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  // ------------------
+  // member wrapping
+  // ------------------
+
+  /**
+   * Wraps the given field into a field accessor using the accessor factory of this instance. The field must be
+   * declared in the wrapped class or one of its super classes. Other than the find methods this method does not look
+   * up the given field in the member caches of the wrapped class, which makes it useful for callers resolving the
+   * members themselves (for example accessors generated at compile time). The created accessor is shared with accessors
+   * returned by the find methods for the same field.
+   *
+   * @param field the field to wrap.
+   * @return an accessor for the given field.
+   * @throws NullPointerException     if the given field is null.
+   * @throws IllegalArgumentException if the given field is not a member of the wrapped class.
+   * @throws ReflexionException       if the accessor factory is unable to wrap the given field.
+   * @since 1.4
+   */
+  public @NonNull FieldAccessor wrap(@NonNull Field field) {
+    this.checkMember(field);
+    return this.wrapField(field);
+  }
+
+  /**
+   * Wraps the given method into a method accessor using the accessor factory of this instance. The method must be
+   * declared in the wrapped class or one of its super types. Other than the find methods this method does not look up
+   * the given method in the member caches of the wrapped class. The created accessor is shared with accessors returned
+   * by the find methods for the same method.
+   *
+   * @param method the method to wrap.
+   * @return an accessor for the given method.
+   * @throws NullPointerException     if the given method is null.
+   * @throws IllegalArgumentException if the given method is not a member of the wrapped class.
+   * @throws ReflexionException       if the accessor factory is unable to wrap the given method.
+   * @since 1.4
+   */
+  public @NonNull MethodAccessor<Method> wrap(@NonNull Method method) {
+    this.checkMember(method);
+    return this.wrapMethod(method);
+  }
+
+  /**
+   * Wraps the given constructor into a method accessor using the accessor factory of this instance. The constructor
+   * must be declared in the wrapped class or one of its super classes. Other than the find methods this method does not
+   * look up the given constructor in the member caches of the wrapped class. The created accessor is shared with
+   * accessors returned by the find methods for the same constructor.
+   *
+   * @param constructor the constructor to wrap.
+   * @return an accessor for the given constructor.
+   * @throws NullPointerException     if the given constructor is null.
+   * @throws IllegalArgumentException if the given constructor is not a member of the wrapped class.
+   * @throws ReflexionException       if the accessor factory is unable to wrap the given constructor.
+   * @since 1.4
+   */
+  public @NonNull MethodAccessor<Constructor<?>> wrap(@NonNull Constructor<?> constructor) {
+    this.checkMember(constructor);
+    return this.wrapConstructor(constructor);
+  }
+
+  // ------------------
+  // copying
+  // ------------------
+
+  /**
+   * Get a compiled copier for instances of the wrapped class. The copier copies the values of all non-static fields in
+   * the wrapped class and its super classes (including private and final ones) from one instance to another, or into a
+   * new instance created using the constructor without parameters of the wrapped class. The copier is compiled once
+   * per class and accessor factory, subsequent calls return the same copier instance.
+   * <p>
+   * Example usage:
+   * <pre>
+   * {@code
+   *  public static HelloWorld copyHelloWorld(HelloWorld source) {
+   *    ReflexionCopier<HelloWorld> copier = Reflexion.on(HelloWorld.class).copier();
+   *    return copier.clone(source);
+   *  }
+   * }
+   * </pre>
+   *
+   * @param <T> the type of the wrapped class.
+   * @return a copier for instances of the wrapped class.
+   * @throws ReflexionException if one of the fields cannot be accessed by the accessor factory of this instance.
+   * @since 1.4
+   */
+  public @NonNull <T> ReflexionCopier<T> copier() {
+    ReflexionCopier<T> copier = this.members.getCopier(this.accFactory);
+    if (copier == null) {
+      // the no-args constructor must be declared in the wrapped class, not in one of its super classes
+      Constructor<?> ctor = this.members.getConstructorIndex().bySignature(null, new Class<?>[0]);
+      boolean canConstruct = ctor != null
+        && ctor.getDeclaringClass() == this.wrappedClass
+        && !Modifier.isAbstract(this.wrappedClass.getModifiers());
+
+      Reflexion unbound = this.unbound();
+      ReflexionCopier<T> created = ReflexionCopier.compile(
+        this.wrappedClass,
+        Util.filterAndMap(this.getFieldCache(), field -> !Modifier.isStatic(field.getModifiers()), unbound::wrapField),
+        canConstruct ? unbound.wrapConstructor(ctor) : null);
+      copier = this.members.putCopier(this.accFactory, created);
+    }
+    return copier;
+  }
+
+  // ------------------
+  // shapes
+  // ------------------
+
+  /**
+   * Compiles a shape of all fields in the wrapped class and its super classes which are matching the given matcher.
+   * Unlike {@link #findFields(FieldMatcher)} the fields of the returned shape have a fixed order and can be read or
+   * written all at once using a slot array, see {@link ObjectShape} for details. The accessors in the shape are never
+   * bound, the instance to operate on must be passed explicitly.
+   * <p>
+   * Example usage:
+   * <pre>
+   * {@code
+   *  public static Object[] snapshotHelloWorld(HelloWorld helloWorld) {
+   *    ObjectShape shape = Reflexion.on(HelloWorld.class).shape(FieldMatcher.newMatcher());
+   *    Object[] slots = shape.newSlots();
+   *    shape.readInto(helloWorld, slots);
+   *    return slots;
+   *  }
+   * }
+   * </pre>
+   *
+   * @param matcher the matcher to match the fields of the shape.
+   * @return a new shape of all fields which are matching the given matcher.
+   * @throws NullPointerException if the given matcher is null.
+   * @since 1.4
+   */
+  public @NonNull ObjectShape shape(@NonNull FieldMatcher matcher) {
+    MatcherPlan<Field> plan = matcher.compile();
+    List<Field> fields = this.members.findMatching(plan, this.getFieldCache(), this.members.getFieldIndex());
+    return ObjectShape.compile(this.members, fields, this.unbound()::wrapField);
   }
 
   // ------------------
@@ -717,41 +1100,117 @@ private Reflexion(@NonNull Class<?> wrappedClass, @Nullable Object binding, @Non
   // ------------------
 
   /**
-   * Internal: gets the field cache for the wrapped class. This method populates the cache before returning it if the
-   * cache isn't initialized yet.
+   * Internal: gets the shared field cache for the wrapped class. This method populates the cache before returning it if
+   * the cache isn't initialized yet.
    *
    * @return the field cache for the wrapped class.
    */
   private @NonNull Set<Field> getFieldCache() {
-    if (this.fields == null) {
-      this.fields = ReflexionPopulator.getAllFields(this.wrappedClass);
-    }
-    return this.fields;
+    return this.members.getFields();
   }
 
   /**
-   * Internal: gets the method cache for the wrapped class. This method populates the cache before returning it if the
-   * cache isn't initialized yet.
+   * Internal: gets the shared method cache for the wrapped class. This method populates the cache before returning it
+   * if the cache isn't initialized yet.
    *
    * @return the method cache for the wrapped class.
    */
   private @NonNull Set<Method> getMethodCache() {
-    if (this.methods == null) {
-      this.methods = ReflexionPopulator.getAllMethods(this.wrappedClass);
-    }
-    return this.methods;
+    return this.members.getMethods();
   }
 
   /**
-   * Internal: gets the constructor cache for the wrapped class. This method populates the cache before returning it if
-   * the cache isn't initialized yet.
+   * Internal: gets the shared constructor cache for the wrapped class. This method populates the cache before
+   * returning it if the cache isn't initialized yet.
    *
    * @return the constructor cache for the wrapped class.
    */
   private @NonNull Set<Constructor<?>> getConstructorCache() {
-    if (this.constructors == null) {
-      this.constructors = ReflexionPopulator.getAllConstructors(this.wrappedClass);
+    return this.members.getConstructors();
+  }
+
+  /**
+   * Internal: gets the shared accessor of the current factory for the given field, wrapping the field if no accessor
+   * was created before. If this reflexion instance is bound the shared accessor is returned as a bound view.
+   *
+   * @param field the field to get the accessor for.
+   * @return an accessor for the given field.
+   */
+  private @NonNull FieldAccessor wrapField(@NonNull Field field) {
+    FieldAccessor accessor = this.members.getAccessor(this.accFactory, field);
+    if (accessor == null) {
+      if (Stats.ENABLED) {
+        Stats.fieldWrapped();
+      }
+      Object event = FlightEvents.beginWrap();
+      FieldAccessor created = this.accFactory.wrapField(this.unbound(), field);
+      FlightEvents.endWrap(event, field, this.accFactory);
+      accessor = this.members.putAccessor(this.accFactory, field, created);
     }
-    return this.constructors;
+    return this.binding == null ? accessor : new BoundFieldAccessor(this, accessor);
+  }
+
+  /**
+   * Internal: gets the shared accessor of the current factory for the given method, wrapping the method if no accessor
+   * was created before. If this reflexion instance is bound the shared accessor is returned as a bound view.
+   *
+   * @param method the method to get the accessor for.
+   * @return an accessor for the given method.
+   */
+  private @NonNull MethodAccessor<Method> wrapMethod(@NonNull Method method) {
+    MethodAccessor<Method> accessor = this.members.getAccessor(this.accFactory, method);
+    if (accessor == null) {
+      if (Stats.ENABLED) {
+        Stats.methodWrapped();
+      }
+      Object event = FlightEvents.beginWrap();
+      MethodAccessor<Method> created = this.accFactory.wrapMethod(this.unbound(), method);
+      FlightEvents.endWrap(event, method, this.accFactory);
+      accessor = this.members.putAccessor(this.accFactory, method, created);
+    }
+    return this.binding == null ? accessor : new BoundMethodAccessor<>(this, accessor);
+  }
+
+  /**
+   * Internal: gets the shared accessor of the current factory for the given constructor, wrapping the constructor if no
+   * accessor was created before. If this reflexion instance is bound the shared accessor is returned as a bound view.
+   *
+   * @param constructor the constructor to get the accessor for.
+   * @return an accessor for the given constructor.
+   */
+  private @NonNull MethodAccessor<Constructor<?>> wrapConstructor(@NonNull Constructor<?> constructor) {
+    MethodAccessor<Constructor<?>> accessor = this.members.getAccessor(this.accFactory, constructor);
+    if (accessor == null) {
+      if (Stats.ENABLED) {
+        Stats.constructorWrapped();
+      }
+      Object event = FlightEvents.beginWrap();
+      MethodAccessor<Constructor<?>> created = this.accFactory.wrapConstructor(this.unbound(), constructor);
+      FlightEvents.endWrap(event, constructor, this.accFactory);
+      accessor = this.members.putAccessor(this.accFactory, constructor, created);
+    }
+    return this.binding == null ? accessor : new BoundMethodAccessor<>(this, accessor);
+  }
+
+  /**
+   * Internal: checks that the given member is declared in the wrapped class or one of its super types.
+   *
+   * @param member the member to check.
+   * @throws IllegalArgumentException if the given member is not a member of the wrapped class.
+   */
+  private void checkMember(@NonNull Member member) {
+    if (!member.getDeclaringClass().isAssignableFrom(this.wrappedClass)) {
+      throw new IllegalArgumentException("Member " + member + " is not a member of " + this.wrappedClass);
+    }
+  }
+
+  /**
+   * Internal: get an unbound version of this reflexion instance, used to create the shared accessors as they must not
+   * capture the binding of this instance.
+   *
+   * @return an unbound reflexion instance targeting the same class with the same accessor factory.
+   */
+  private @NonNull Reflexion unbound() {
+    return this.unbound;
   }
 }
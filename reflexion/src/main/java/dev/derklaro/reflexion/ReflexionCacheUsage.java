@@ -0,0 +1,153 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import lombok.NonNull;
+
+/**
+ * A snapshot of the usage of the shared caches of reflexion. The shared caches hold the members, accessors, copiers and
+ * matcher results of each class. Classes are held weakly by the caches and their entries are released when the class
+ * is unloaded, for example when the class loader of a plugin is closed and no longer referenced.
+ * <p>
+ * The amount of accessors cached per class can be limited by setting the
+ * {@code dev.derklaro.reflexion.maxCachedAccessors} system property, the accessors can be held softly by setting
+ * {@code dev.derklaro.reflexion.softAccessors} to true.
+ *
+ * @see Reflexion#cacheUsage()
+ * @since 1.4
+ */
+public final class ReflexionCacheUsage {
+
+  // rough estimations of the retained size of a single cache entry, in bytes
+  private static final long CLASS_ENTRY_SIZE = 256;
+  private static final long MEMBER_ENTRY_SIZE = 48;
+  private static final long ACCESSOR_ENTRY_SIZE = 512;
+  private static final long MATCH_ENTRY_SIZE = 128;
+  private static final long COPIER_ENTRY_SIZE = 1024;
+
+  private final int cachedClasses;
+  private final long cachedMembers;
+  private final long cachedAccessors;
+  private final long cachedMatches;
+  private final long cachedCopiers;
+
+  /**
+   * Constructs a new cache usage snapshot. Internal use only, a snapshot of the current cache usage can be obtained
+   * from {@link Reflexion#cacheUsage()}.
+   *
+   * @param cachedClasses   the amount of classes which have cached data.
+   * @param cachedMembers   the amount of cached members.
+   * @param cachedAccessors the amount of cached accessors.
+   * @param cachedMatches   the amount of cached matcher results.
+   * @param cachedCopiers   the amount of cached copiers.
+   */
+  public ReflexionCacheUsage(
+    int cachedClasses,
+    long cachedMembers,
+    long cachedAccessors,
+    long cachedMatches,
+    long cachedCopiers
+  ) {
+    this.cachedClasses = cachedClasses;
+    this.cachedMembers = cachedMembers;
+    this.cachedAccessors = cachedAccessors;
+    this.cachedMatches = cachedMatches;
+    this.cachedCopiers = cachedCopiers;
+  }
+
+  /**
+   * Get the amount of classes which currently have cached data.
+   *
+   * @return the amount of classes which have cached data.
+   */
+  public int getCachedClasses() {
+    return this.cachedClasses;
+  }
+
+  /**
+   * Get the amount of fields, methods and constructors which are currently cached.
+   *
+   * @return the amount of cached members.
+   */
+  public long getCachedMembers() {
+    return this.cachedMembers;
+  }
+
+  /**
+   * Get the amount of accessors which are currently cached. If accessors are held softly this count includes accessors
+   * which were already cleared by the garbage collector but not yet removed from the cache.
+   *
+   * @return the amount of cached accessors.
+   */
+  public long getCachedAccessors() {
+    return this.cachedAccessors;
+  }
+
+  /**
+   * Get the amount of matcher results which are currently cached.
+   *
+   * @return the amount of cached matcher results.
+   */
+  public long getCachedMatches() {
+    return this.cachedMatches;
+  }
+
+  /**
+   * Get the amount of copiers which are currently cached.
+   *
+   * @return the amount of cached copiers.
+   */
+  public long getCachedCopiers() {
+    return this.cachedCopiers;
+  }
+
+  /**
+   * Get a rough estimation of the memory retained by the shared caches, in bytes. The estimation is based on the
+   * average size of each entry type and should only be used to compare the cache usage over time, not as an exact
+   * measurement.
+   *
+   * @return a rough estimation of the memory retained by the shared caches, in bytes.
+   */
+  public long getEstimatedSize() {
+    return this.cachedClasses * CLASS_ENTRY_SIZE
+      + this.cachedMembers * MEMBER_ENTRY_SIZE
+      + this.cachedAccessors * ACCESSOR_ENTRY_SIZE
+      + this.cachedMatches * MATCH_ENTRY_SIZE
+      + this.cachedCopiers * COPIER_ENTRY_SIZE;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull String toString() {
+    return "ReflexionCacheUsage(classes=" + this.cachedClasses
+      + ", members=" + this.cachedMembers
+      + ", accessors=" + this.cachedAccessors
+      + ", matches=" + this.cachedMatches
+      + ", copiers=" + this.cachedCopiers
+      + ", estimatedSize=" + this.getEstimatedSize() + ")";
+  }
+}
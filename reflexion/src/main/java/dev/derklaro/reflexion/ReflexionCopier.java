@@ -0,0 +1,200 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Constructor;
+import java.util.Collection;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * A compiled shallow copy routine for instances of a class. The copier is created once for a class and copies the
+ * values of all non-static fields in the class and its super classes (regardless of their visibility or if they are
+ * final) from one instance to another, or into a new instance of the class. Fields which are only declared in
+ * subclasses of the class are not copied.
+ * <p>
+ * All field copy operations are composed into a single method handle chain when the copier is created, therefore
+ * copying an instance does neither allocate per field nor box primitive values. A copier can be obtained by calling
+ * {@link Reflexion#copier()}, copiers are cached and can be shared between threads.
+ *
+ * @param <T> the type of instances the copier can copy.
+ * @since 1.4
+ */
+public final class ReflexionCopier<T> {
+
+  private static final MethodType COPY_TYPE = MethodType.methodType(void.class, Object.class, Object.class);
+  private static final MethodType FACTORY_TYPE = MethodType.methodType(Object.class);
+
+  private final Class<?> type;
+  private final int fieldCount;
+  private final @Nullable MethodHandle copyHandle;
+  private final @Nullable MethodHandle factoryHandle;
+
+  /**
+   * Constructs a new copier instance.
+   *
+   * @param type          the type of instances the copier can copy.
+   * @param fieldCount    the amount of fields copied by the copier.
+   * @param copyHandle    the composed copy handle of type {@code (Object,Object)void}, null if no fields are copied.
+   * @param factoryHandle the handle of type {@code ()Object} creating new instances, null if not possible.
+   */
+  private ReflexionCopier(
+    @NonNull Class<?> type,
+    int fieldCount,
+    @Nullable MethodHandle copyHandle,
+    @Nullable MethodHandle factoryHandle
+  ) {
+    this.type = type;
+    this.fieldCount = fieldCount;
+    this.copyHandle = copyHandle;
+    this.factoryHandle = factoryHandle;
+  }
+
+  /**
+   * Compiles a new copier which copies the values of the fields wrapped by the given accessors.
+   *
+   * @param type   the type of instances the copier can copy.
+   * @param fields the accessors of all non-static fields to copy.
+   * @param ctor   the accessor of the no-args constructor of the type, null if the type has no such constructor.
+   * @param <T>    the type of instances the copier can copy.
+   * @return a new copier for the given type and fields.
+   * @throws NullPointerException if the given type or field collection is null.
+   * @throws ReflexionException   if a handle to read or write one of the given fields cannot be created.
+   */
+  static @NonNull <T> ReflexionCopier<T> compile(
+    @NonNull Class<?> type,
+    @NonNull Collection<FieldAccessor> fields,
+    @Nullable MethodAccessor<Constructor<?>> ctor
+  ) {
+    MethodHandle copyHandle = null;
+    for (FieldAccessor field : fields) {
+      MethodHandle fieldCopy = compileFieldCopy(field);
+      // fold the previous copy operations into the new one, all operations share the (source, target) arguments
+      copyHandle = copyHandle == null ? fieldCopy : MethodHandles.foldArguments(fieldCopy, copyHandle);
+    }
+
+    MethodHandle factoryHandle = ctor == null ? null : ctor.asMethodHandle().asType(FACTORY_TYPE);
+    return new ReflexionCopier<>(type, fields.size(), copyHandle, factoryHandle);
+  }
+
+  /**
+   * Compiles the copy operation of a single field into a handle of type {@code (Object,Object)void} which reads the
+   * value of the field from the source (first argument) and writes it into the target (second argument).
+   *
+   * @param field the accessor of the field to compile the copy operation for.
+   * @return the compiled copy operation for the given field.
+   * @throws NullPointerException if the given field accessor is null.
+   */
+  private static @NonNull MethodHandle compileFieldCopy(@NonNull FieldAccessor field) {
+    // (Declaring,Type)void & (Declaring)Type
+    MethodHandle setter = field.setterHandle();
+    MethodHandle getter = field.getterHandle();
+
+    // (target, source) -> setter(target, getter(source))
+    MethodHandle targetSource = MethodHandles.filterArguments(setter, 1, getter);
+    // swap the arguments to (source, target), both are of the declaring type of the field
+    MethodHandle sourceTarget = MethodHandles.permuteArguments(targetSource, targetSource.type(), 1, 0);
+    return sourceTarget.asType(COPY_TYPE);
+  }
+
+  /**
+   * Get the type of instances this copier can copy.
+   *
+   * @return the type of instances this copier can copy.
+   */
+  public @NonNull Class<?> getType() {
+    return this.type;
+  }
+
+  /**
+   * Get the amount of fields which are copied by this copier.
+   *
+   * @return the amount of fields which are copied by this copier.
+   */
+  public int getFieldCount() {
+    return this.fieldCount;
+  }
+
+  /**
+   * Get if this copier is able to create new instances of the type, which is only possible if the type declares a
+   * constructor without any parameters.
+   *
+   * @return true if {@link #clone(Object)} is supported by this copier, false otherwise.
+   */
+  public boolean canClone() {
+    return this.factoryHandle != null;
+  }
+
+  /**
+   * Copies the values of all fields from the given source instance into the given target instance. Exceptions thrown
+   * during the copy operation are rethrown unchecked.
+   *
+   * @param source the instance to copy the field values from.
+   * @param target the instance to copy the field values into.
+   * @throws NullPointerException if the given source or target is null.
+   * @throws ClassCastException   if the given source or target is not an instance of the type of this copier.
+   */
+  public void copy(@NonNull T source, @NonNull T target) {
+    MethodHandle copyHandle = this.copyHandle;
+    if (copyHandle != null) {
+      try {
+        copyHandle.invokeExact(source, target);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+  }
+
+  /**
+   * Creates a new instance of the type using the constructor without parameters and copies the values of all fields
+   * from the given source instance into it. Exceptions thrown during the construction or copy operation are rethrown
+   * unchecked.
+   *
+   * @param source the instance to copy the field values from.
+   * @return a new instance holding the field values of the given source instance.
+   * @throws NullPointerException  if the given source is null.
+   * @throws IllegalStateException if the type has no constructor without parameters.
+   * @see #canClone()
+   */
+  @SuppressWarnings("unchecked")
+  public @NonNull T clone(@NonNull T source) {
+    MethodHandle factoryHandle = this.factoryHandle;
+    if (factoryHandle == null) {
+      throw new IllegalStateException("Type " + this.type.getName() + " has no constructor without parameters");
+    }
+
+    try {
+      T target = (T) factoryHandle.invokeExact();
+      this.copy(source, target);
+      return target;
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+}
@@ -29,6 +29,11 @@
 /**
  * Represents a custom runtime exception which is exclusively thrown by methods in this library to make it easier to
  * catch them rather than having general exception types.
+ * <p>
+ * Filling in the stack trace is the most expensive part of constructing an exception. If reflexion exceptions are
+ * expected to be thrown often, for example by probing lookups using {@link Reflexion#get(String)}, the stack trace can
+ * be omitted by setting the {@code dev.derklaro.reflexion.stacklessExceptions} system property to true. The stack trace
+ * of the cause, if any, is retained.
  *
  * @since 1.0
  */
@@ -36,6 +41,10 @@ public final class ReflexionException extends RuntimeException {
 
   private static final long serialVersionUID = -1675093482858418144L;
 
+  // if the stack trace of reflexion exceptions should be filled in
+  private static final boolean WRITABLE_STACK_TRACE = !Boolean.getBoolean(
+    ReflexionException.class.getPackage().getName() + ".stacklessExceptions");
+
   /**
    * Constructs a new reflexion exception instance.
    *
@@ -43,7 +52,7 @@ public final class ReflexionException extends RuntimeException {
    * @throws NullPointerException if the given message is null.
    */
   public ReflexionException(@NonNull String message) {
-    super(message);
+    super(message, null, true, WRITABLE_STACK_TRACE);
   }
 
   /**
@@ -53,6 +62,16 @@ public ReflexionException(@NonNull String message) {
    * @throws NullPointerException if the given cause is null.
    */
   public ReflexionException(@NonNull Throwable cause) {
-    super(cause);
+    super(cause.toString(), cause, true, WRITABLE_STACK_TRACE);
+  }
+
+  /**
+   * Get if reflexion exceptions are constructed without filling in their stack trace.
+   *
+   * @return true if reflexion exceptions are constructed without a stack trace, false otherwise.
+   * @since 1.4
+   */
+  public static boolean isStackless() {
+    return !WRITABLE_STACK_TRACE;
   }
 }
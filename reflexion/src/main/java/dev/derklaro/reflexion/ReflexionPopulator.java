@@ -24,15 +24,18 @@
 
 package dev.derklaro.reflexion;
 
+import dev.derklaro.reflexion.internal.util.FlightEvents;
 import java.lang.reflect.Constructor;
 import java.lang.reflect.Field;
 import java.lang.reflect.Member;
 import java.lang.reflect.Method;
 import java.util.Arrays;
-import java.util.HashSet;
+import java.util.LinkedHashSet;
 import java.util.Set;
 import java.util.function.Function;
+import java.util.function.Predicate;
 import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
 
 /**
  * Internal utility class to read all java.lang.reflect members from a class and it's super classes.
@@ -53,7 +56,7 @@ private ReflexionPopulator() {
    * @throws NullPointerException if the given topmost class is null.
    */
   public static @NonNull Set<Field> getAllFields(@NonNull Class<?> declaringClass) {
-    return mappingHierarchyTravel(declaringClass, Class::getDeclaredFields, Class::getFields);
+    return mappingHierarchyTravel(declaringClass, "field", Class::getDeclaredFields, Class::getFields);
   }
 
   /**
@@ -64,7 +67,7 @@ private ReflexionPopulator() {
    * @throws NullPointerException if the given topmost class is null.
    */
   public static @NonNull Set<Method> getAllMethods(@NonNull Class<?> declaringClass) {
-    return mappingHierarchyTravel(declaringClass, Class::getDeclaredMethods, Class::getMethods);
+    return mappingHierarchyTravel(declaringClass, "method", Class::getDeclaredMethods, Class::getMethods);
   }
 
   /**
@@ -75,14 +78,101 @@ private ReflexionPopulator() {
    * @throws NullPointerException if the given topmost class is null.
    */
   public static @NonNull Set<Constructor<?>> getAllConstructors(@NonNull Class<?> declaringClass) {
-    return mappingHierarchyTravel(declaringClass, Class::getDeclaredConstructors, Class::getConstructors);
+    return mappingHierarchyTravel(
+      declaringClass,
+      "constructor",
+      Class::getDeclaredConstructors,
+      Class::getConstructors);
   }
 
   /**
-   * Travels down the class tree beginning from the given topmost class, extracting all public and declared members from
-   * each visited class (using the given extractor functions) and collects them into a set. This method is not cached.
+   * Get the first (declared) field in the given class, and it's super classes, which matches the given filter.
+   *
+   * @param declaringClass the class to start the search from.
+   * @param filter         the filter the field must match.
+   * @return the first field matching the given filter, null if no field matches.
+   * @throws NullPointerException if the given topmost class or filter is null.
+   */
+  public static @Nullable Field findFirstField(@NonNull Class<?> declaringClass, @NonNull Predicate<Field> filter) {
+    return findFirst(declaringClass, Class::getDeclaredFields, Class::getFields, filter);
+  }
+
+  /**
+   * Get the first (declared) method in the given class, and it's super classes, which matches the given filter.
+   *
+   * @param declaringClass the class to start the search from.
+   * @param filter         the filter the method must match.
+   * @return the first method matching the given filter, null if no method matches.
+   * @throws NullPointerException if the given topmost class or filter is null.
+   */
+  public static @Nullable Method findFirstMethod(@NonNull Class<?> declaringClass, @NonNull Predicate<Method> filter) {
+    return findFirst(declaringClass, Class::getDeclaredMethods, Class::getMethods, filter);
+  }
+
+  /**
+   * Get the first (declared) constructor in the given class, and it's super classes, which matches the given filter.
+   *
+   * @param declaringClass the class to start the search from.
+   * @param filter         the filter the constructor must match.
+   * @return the first constructor matching the given filter, null if no constructor matches.
+   * @throws NullPointerException if the given topmost class or filter is null.
+   */
+  public static @Nullable Constructor<?> findFirstConstructor(
+    @NonNull Class<?> declaringClass,
+    @NonNull Predicate<Constructor<?>> filter
+  ) {
+    return findFirst(declaringClass, Class::getDeclaredConstructors, Class::getConstructors, filter);
+  }
+
+  /**
+   * Travels down the class tree beginning from the given topmost class in the same order as
+   * {@link #mappingHierarchyTravel(Class, String, Function, Function)}, but tests each member while travelling and
+   * stops at the first member which matches the given filter. The members of a class are only requested if none of the
+   * members of the classes visited before matched, and no intermediate collection is created. This method is not
+   * cached.
+   *
+   * @param top             the topmost class to start the search from.
+   * @param extractor       the extractor function for declared members.
+   * @param publicExtractor the extractor function for public members.
+   * @param filter          the filter the member must match.
+   * @param <T>             the type of member which gets extracted from the class tree.
+   * @return the first member matching the given filter, null if no member matches.
+   * @throws NullPointerException if the given topmost class, one of the extractor functions or the filter is null.
+   */
+  private static @Nullable <T extends Member> T findFirst(
+    @NonNull Class<?> top,
+    @NonNull Function<Class<?>, T[]> extractor,
+    @NonNull Function<Class<?>, T[]> publicExtractor,
+    @NonNull Predicate<T> filter
+  ) {
+    // all private members, beginning at the topmost class
+    Class<?> current = top;
+    do {
+      for (T member : extractor.apply(current)) {
+        if (filter.test(member)) {
+          return member;
+        }
+      }
+    } while ((current = current.getSuperclass()) != null);
+
+    // all public members
+    for (T member : publicExtractor.apply(top)) {
+      if (filter.test(member)) {
+        return member;
+      }
+    }
+    return null;
+  }
+
+  /**
+   * Travels down the class tree beginning from the given topmost class, extracting all declared and public members from
+   * each visited class (using the given extractor functions) and collects them into a set. The declared members are
+   * collected first, beginning with the topmost class, followed by the public members of the topmost class (which
+   * includes public members inherited from interfaces), therefore members which are declared closer to the given
+   * topmost class come first when iterating over the returned set. This method is not cached.
    *
    * @param top             the topmost class to start the search from.
+   * @param memberType      the name of the type of members which get extracted, used for reporting.
    * @param extractor       the extractor function for declared members.
    * @param publicExtractor the extractor function for public members.
    * @param <T>             the type of member which gets extracted from the class tree.
@@ -91,11 +181,12 @@ private ReflexionPopulator() {
    */
   private static @NonNull <T extends Member> Set<T> mappingHierarchyTravel(
     @NonNull Class<?> top,
+    @NonNull String memberType,
     @NonNull Function<Class<?>, T[]> extractor,
     @NonNull Function<Class<?>, T[]> publicExtractor
   ) {
-    // all public members + init
-    Set<T> target = new HashSet<>(Arrays.asList(publicExtractor.apply(top)));
+    Object event = FlightEvents.beginPopulation();
+    Set<T> target = new LinkedHashSet<>();
 
     // all private members
     Class<?> current = top;
@@ -116,6 +207,9 @@ private ReflexionPopulator() {
       target.addAll(Arrays.asList(privateValues));
     } while ((current = current.getSuperclass()) != null);
 
+    // all public members
+    target.addAll(Arrays.asList(publicExtractor.apply(top)));
+    FlightEvents.endPopulation(event, top, memberType, target.size());
     return target;
   }
 }
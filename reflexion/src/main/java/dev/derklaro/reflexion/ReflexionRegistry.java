@@ -0,0 +1,834 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.handles.InstanceAllocator;
+import dev.derklaro.reflexion.internal.util.Stats;
+import dev.derklaro.reflexion.matcher.MatcherPlan;
+import java.lang.invoke.MethodHandle;
+import java.lang.ref.SoftReference;
+import java.lang.ref.WeakReference;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Executable;
+import java.lang.reflect.Field;
+import java.lang.reflect.Member;
+import java.lang.reflect.Method;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collection;
+import java.util.Collections;
+import java.util.Iterator;
+import java.util.LinkedHashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.WeakHashMap;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: the process-wide registry for class member metadata. Each class gets exactly one member holder which is
+ * shared between all reflexion instances (bound or unbound) and all accessor factories targeting that class, meaning
+ * that the class hierarchy of a class is only travelled once per member type. The holder furthermore caches the
+ * accessors created by each accessor factory for the members of the class, so that wrapping a member (which can be
+ * expensive, for example when method handles need to be adapted) is only done once per factory.
+ * <p>
+ * The holders are attached to the class they describe using a class value, therefore they are released together with
+ * the class once it becomes unreachable. The registry and the holders are thread-safe and can be shared freely between
+ * threads.
+ *
+ * @since 1.4
+ */
+final class ReflexionRegistry {
+
+  // the maximum amount of accessors cached per class, 0 (the default) for no limit
+  private static final int MAX_CACHED_ACCESSORS = Math.max(
+    0,
+    Integer.getInteger(BaseAccessor.class.getPackage().getName() + ".maxCachedAccessors", 0));
+  // if cached accessors should be held softly, allowing the garbage collector to evict them under memory pressure
+  private static final boolean SOFT_ACCESSORS = Boolean.getBoolean(
+    BaseAccessor.class.getPackage().getName() + ".softAccessors");
+
+  // the member holders of all classes which currently have one, both held weakly so that they don't prevent class
+  // unloading (the holder references its class), the holders are strongly held by the class value
+  private static final Map<Class<?>, WeakReference<ClassMembers>> KNOWN_CLASSES = Collections.synchronizedMap(
+    new WeakHashMap<>());
+  private static final ClassValue<ClassMembers> CLASS_MEMBERS = new ClassValue<ClassMembers>() {
+    @Override
+    protected ClassMembers computeValue(Class<?> type) {
+      ClassMembers holder = new ClassMembers(type);
+      KNOWN_CLASSES.put(type, new WeakReference<>(holder));
+      return holder;
+    }
+  };
+
+  private ReflexionRegistry() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Get the shared member holder of the given class, creating it if the class was never requested before. Creating the
+   * holder does not populate any of the member caches.
+   *
+   * @param clazz the class to get the member holder of.
+   * @return the shared member holder of the given class.
+   * @throws NullPointerException if the given class is null.
+   */
+  public static @NonNull ClassMembers lookup(@NonNull Class<?> clazz) {
+    return CLASS_MEMBERS.get(clazz);
+  }
+
+  /**
+   * Drops the shared member holder of the given class, the next lookup of the class will start with empty caches
+   * again. Reflexion instances which already obtained the holder of the class will continue to use the old one.
+   *
+   * @param clazz the class to drop the member holder of.
+   * @throws NullPointerException if the given class is null.
+   */
+  public static void invalidate(@NonNull Class<?> clazz) {
+    KNOWN_CLASSES.remove(clazz);
+    CLASS_MEMBERS.remove(clazz);
+  }
+
+  /**
+   * Drops the shared member holders of all classes, see {@link #invalidate(Class)}.
+   */
+  public static void invalidateAll() {
+    for (Class<?> clazz : knownClasses()) {
+      invalidate(clazz);
+    }
+  }
+
+  /**
+   * Computes the current usage of the shared caches of all classes.
+   *
+   * @return the current usage of the shared caches.
+   */
+  public static @NonNull ReflexionCacheUsage usage() {
+    // only read the existing holders, requesting them from the class value would recreate invalidated holders
+    List<ClassMembers> holders = knownHolders();
+    long members = 0;
+    long accessors = 0;
+    long matches = 0;
+    long copiers = 0;
+    for (ClassMembers holder : holders) {
+      members += holder.cachedMemberCount();
+      accessors += holder.accessors.size();
+      matches += holder.matches.size();
+      copiers += holder.copiers.size();
+    }
+    return new ReflexionCacheUsage(holders.size(), members, accessors, matches, copiers);
+  }
+
+  /**
+   * Get a snapshot of all classes which currently have a member holder.
+   *
+   * @return a snapshot of all classes with a member holder.
+   */
+  private static @NonNull List<Class<?>> knownClasses() {
+    synchronized (KNOWN_CLASSES) {
+      return new ArrayList<>(KNOWN_CLASSES.keySet());
+    }
+  }
+
+  /**
+   * Get a snapshot of the member holders of all classes which currently have one.
+   *
+   * @return a snapshot of all existing member holders.
+   */
+  private static @NonNull List<ClassMembers> knownHolders() {
+    synchronized (KNOWN_CLASSES) {
+      List<ClassMembers> holders = new ArrayList<>(KNOWN_CLASSES.size());
+      for (WeakReference<ClassMembers> reference : KNOWN_CLASSES.values()) {
+        ClassMembers holder = reference.get();
+        if (holder != null) {
+          holders.add(holder);
+        }
+      }
+      return holders;
+    }
+  }
+
+  /**
+   * Holds the lazily populated member caches of a single class. The caches are unmodifiable once populated.
+   * <p>
+   * This class is thread-safe. Each member cache and index is computed at most once, guarded by a lock per member
+   * type, and published through a volatile field, meaning that reads after the first population never lock. Accessors,
+   * copiers and matcher results are published using putIfAbsent: under contention they might be created more than once,
+   * but all threads will see and use the same published instance. The instance allocator is stateless and published
+   * through a volatile field without locking, it might be created more than once as well.
+   * <p>
+   * The accessor cache is unbounded by default. The amount of accessors cached per class can be limited by setting the
+   * {@code dev.derklaro.reflexion.maxCachedAccessors} system property, the accessors cached first are evicted first
+   * when the limit is exceeded. Setting {@code dev.derklaro.reflexion.softAccessors} to true holds all cached accessors
+   * softly, allowing the garbage collector to evict them under memory pressure. Evicted accessors are created again
+   * when requested.
+   *
+   * @since 1.4
+   */
+  static final class ClassMembers {
+
+    // the maximum amount of matcher results which are memoized per class
+    private static final int MAX_CACHED_MATCHES = 128;
+
+    private final Class<?> type;
+
+    // the locks guarding the population of the member caches and indexes, one per member type
+    private final Object fieldLock = new Object();
+    private final Object methodLock = new Object();
+    private final Object constructorLock = new Object();
+
+    // class member caches, created lazily when needed
+    private volatile Set<Field> fields;
+    private volatile Set<Method> methods;
+    private volatile Set<Constructor<?>> constructors;
+
+    // hash indexes over the member caches, created lazily when needed
+    private volatile MemberIndex<Field> fieldIndex;
+    private volatile MemberIndex<Method> methodIndex;
+    private volatile MemberIndex<Constructor<?>> constructorIndex;
+
+    // the accessors which were created for members of the class, by factory
+    // the values are soft references to the accessors if soft accessor caching is enabled
+    private final ConcurrentMap<AccessorKey, Object> accessors = new ConcurrentHashMap<>();
+    // the insertion order of the cached accessors, holding each key once, guarded by itself
+    // only tracked if the accessor cache is bounded
+    private final Set<AccessorKey> accessorOrder = new LinkedHashSet<>();
+    // the shared unbound reflexion instances targeting the class, by factory
+    private final ConcurrentMap<AccessorFactory, Reflexion> reflexions = new ConcurrentHashMap<>();
+    // the copiers which were compiled for the class, by factory
+    private final ConcurrentMap<AccessorFactory, ReflexionCopier<?>> copiers = new ConcurrentHashMap<>();
+    // the members which were matched by cacheable matcher plans
+    private final ConcurrentMap<MatcherPlan<?>, List<? extends Member>> matches = new ConcurrentHashMap<>();
+    // the insertion order of the memoized matches, guarded by itself
+    private final Set<MatcherPlan<?>> matchOrder = new LinkedHashSet<>();
+    // the handle allocating instances of the class without running a constructor, created lazily when needed
+    private volatile MethodHandle allocator;
+
+    /**
+     * Constructs a new member holder for the given class.
+     *
+     * @param type the class to hold the members of.
+     */
+    private ClassMembers(@NonNull Class<?> type) {
+      this.type = type;
+    }
+
+    /**
+     * Get the class of which the members are held by this holder.
+     *
+     * @return the class of which the members are held.
+     */
+    public @NonNull Class<?> getType() {
+      return this.type;
+    }
+
+    /**
+     * Gets the field cache of the class, populating it before if the cache isn't initialized yet.
+     *
+     * @return all fields of the class and its super classes.
+     */
+    public @NonNull Set<Field> getFields() {
+      Set<Field> fields = this.fields;
+      if (Stats.ENABLED) {
+        Stats.memberCacheLookup(this.type, fields != null);
+      }
+      if (fields == null) {
+        synchronized (this.fieldLock) {
+          fields = this.fields;
+          if (fields == null) {
+            fields = Collections.unmodifiableSet(ReflexionPopulator.getAllFields(this.type));
+            this.fields = fields;
+          }
+        }
+      }
+      return fields;
+    }
+
+    /**
+     * Gets the method cache of the class, populating it before if the cache isn't initialized yet.
+     *
+     * @return all methods of the class and its super classes.
+     */
+    public @NonNull Set<Method> getMethods() {
+      Set<Method> methods = this.methods;
+      if (Stats.ENABLED) {
+        Stats.memberCacheLookup(this.type, methods != null);
+      }
+      if (methods == null) {
+        synchronized (this.methodLock) {
+          methods = this.methods;
+          if (methods == null) {
+            methods = Collections.unmodifiableSet(ReflexionPopulator.getAllMethods(this.type));
+            this.methods = methods;
+          }
+        }
+      }
+      return methods;
+    }
+
+    /**
+     * Gets the constructor cache of the class, populating it before if the cache isn't initialized yet.
+     *
+     * @return all constructors of the class and its super classes.
+     */
+    public @NonNull Set<Constructor<?>> getConstructors() {
+      Set<Constructor<?>> constructors = this.constructors;
+      if (Stats.ENABLED) {
+        Stats.memberCacheLookup(this.type, constructors != null);
+      }
+      if (constructors == null) {
+        synchronized (this.constructorLock) {
+          constructors = this.constructors;
+          if (constructors == null) {
+            constructors = Collections.unmodifiableSet(ReflexionPopulator.getAllConstructors(this.type));
+            this.constructors = constructors;
+          }
+        }
+      }
+      return constructors;
+    }
+
+    /**
+     * Gets the hash index over the field cache of the class, building it before if the index isn't initialized yet.
+     *
+     * @return the index over all fields of the class and its super classes.
+     */
+    public @NonNull MemberIndex<Field> getFieldIndex() {
+      MemberIndex<Field> index = this.fieldIndex;
+      if (index == null) {
+        synchronized (this.fieldLock) {
+          index = this.fieldIndex;
+          if (index == null) {
+            index = MemberIndex.build(this.getFields(), false);
+            this.fieldIndex = index;
+          }
+        }
+      }
+      return index;
+    }
+
+    /**
+     * Gets the hash index over the method cache of the class, building it before if the index isn't initialized yet.
+     *
+     * @return the index over all methods of the class and its super classes.
+     */
+    public @NonNull MemberIndex<Method> getMethodIndex() {
+      MemberIndex<Method> index = this.methodIndex;
+      if (index == null) {
+        synchronized (this.methodLock) {
+          index = this.methodIndex;
+          if (index == null) {
+            index = MemberIndex.build(this.getMethods(), false);
+            this.methodIndex = index;
+          }
+        }
+      }
+      return index;
+    }
+
+    /**
+     * Gets the hash index over the constructor cache of the class, building it before if the index isn't initialized
+     * yet.
+     *
+     * @return the index over all constructors of the class and its super classes.
+     */
+    public @NonNull MemberIndex<Constructor<?>> getConstructorIndex() {
+      MemberIndex<Constructor<?>> index = this.constructorIndex;
+      if (index == null) {
+        synchronized (this.constructorLock) {
+          index = this.constructorIndex;
+          if (index == null) {
+            index = MemberIndex.build(this.getConstructors(), true);
+            this.constructorIndex = index;
+          }
+        }
+      }
+      return index;
+    }
+
+    /**
+     * Get the accessor which was created by the given factory for the given member, if one was cached before.
+     *
+     * @param fac    the factory which created the accessor.
+     * @param member the member wrapped by the accessor.
+     * @param <A>    the type of the accessor.
+     * @return the cached accessor for the given member and factory, null if no accessor was cached yet.
+     * @throws NullPointerException if the given factory or member is null.
+     */
+    @SuppressWarnings("unchecked")
+    public @Nullable <A extends BaseAccessor<?>> A getAccessor(@NonNull AccessorFactory fac, @NonNull Member member) {
+      AccessorKey key = new AccessorKey(fac, member);
+      Object cached = this.accessors.get(key);
+      A accessor = (A) unwrapAccessor(cached);
+      if (accessor == null && cached != null) {
+        // the soft reference was cleared, drop the stale entry (and its position if the cache is bounded)
+        if (MAX_CACHED_ACCESSORS > 0) {
+          synchronized (this.accessorOrder) {
+            if (this.accessors.remove(key, cached)) {
+              this.accessorOrder.remove(key);
+            }
+          }
+        } else {
+          this.accessors.remove(key, cached);
+        }
+      }
+      if (Stats.ENABLED) {
+        Stats.accessorCacheLookup(this.type, accessor != null);
+      }
+      return accessor;
+    }
+
+    /**
+     * Caches the given accessor for the given member and factory, unless another accessor was cached concurrently. In
+     * that case the previously cached accessor is returned and the given one should be discarded.
+     *
+     * @param factory  the factory which created the accessor.
+     * @param member   the member wrapped by the accessor.
+     * @param accessor the accessor to cache.
+     * @param <A>      the type of the accessor.
+     * @return the accessor which is now cached for the given member and factory.
+     * @throws NullPointerException if the given factory, member or accessor is null.
+     */
+    @SuppressWarnings("unchecked")
+    public @NonNull <A extends BaseAccessor<?>> A putAccessor(
+      @NonNull AccessorFactory factory,
+      @NonNull Member member,
+      @NonNull A accessor
+    ) {
+      AccessorKey key = new AccessorKey(factory, member);
+      Object value = SOFT_ACCESSORS ? new SoftReference<>(accessor) : accessor;
+      while (true) {
+        Object known = this.accessors.putIfAbsent(key, value);
+        if (known == null) {
+          break;
+        }
+
+        // another accessor was cached concurrently, use it unless its reference was cleared in the meantime
+        A knownAccessor = (A) unwrapAccessor(known);
+        if (knownAccessor != null) {
+          return knownAccessor;
+        }
+        if (this.accessors.replace(key, known, value)) {
+          break;
+        }
+      }
+
+      if (MAX_CACHED_ACCESSORS > 0) {
+        // evict the accessors which were cached first until the cache is within its bounds again
+        // replacing a cleared accessor keeps the position of its key, as the key is already tracked
+        synchronized (this.accessorOrder) {
+          this.accessorOrder.add(key);
+          Iterator<AccessorKey> iterator = this.accessorOrder.iterator();
+          while (this.accessors.size() > MAX_CACHED_ACCESSORS && iterator.hasNext()) {
+            this.accessors.remove(iterator.next());
+            iterator.remove();
+          }
+        }
+      }
+      return accessor;
+    }
+
+    /**
+     * Get the amount of members which are currently held in the member caches of the class.
+     *
+     * @return the amount of cached members of the class.
+     */
+    long cachedMemberCount() {
+      Set<Field> fields = this.fields;
+      Set<Method> methods = this.methods;
+      Set<Constructor<?>> constructors = this.constructors;
+      return (fields == null ? 0 : fields.size())
+        + (methods == null ? 0 : methods.size())
+        + (constructors == null ? 0 : constructors.size());
+    }
+
+    /**
+     * Unwraps a value of the accessor cache, resolving the soft reference if soft accessor caching is enabled.
+     *
+     * @param value the cached value to unwrap.
+     * @return the unwrapped accessor, null if the given value is null or its reference was cleared.
+     */
+    private static @Nullable Object unwrapAccessor(@Nullable Object value) {
+      return value instanceof SoftReference<?> ? ((SoftReference<?>) value).get() : value;
+    }
+
+    /**
+     * Get the shared unbound reflexion instance targeting the class with the given factory, if one was cached before.
+     *
+     * @param factory the accessor factory used by the reflexion instance.
+     * @return the cached reflexion instance for the given factory, null if no instance was cached yet.
+     * @throws NullPointerException if the given factory is null.
+     */
+    public @Nullable Reflexion getReflexion(@NonNull AccessorFactory factory) {
+      return this.reflexions.get(factory);
+    }
+
+    /**
+     * Caches the given unbound reflexion instance for the given factory. If another thread cached an instance for the
+     * same factory in the meantime, the instance cached first is returned instead.
+     *
+     * @param factory   the accessor factory used by the reflexion instance.
+     * @param reflexion the unbound reflexion instance to cache.
+     * @return the reflexion instance cached for the given factory.
+     * @throws NullPointerException if the given factory or reflexion instance is null.
+     */
+    public @NonNull Reflexion putReflexion(@NonNull AccessorFactory factory, @NonNull Reflexion reflexion) {
+      Reflexion known = this.reflexions.putIfAbsent(factory, reflexion);
+      return known == null ? reflexion : known;
+    }
+
+    /**
+     * Get the copier which was compiled for the class using the given factory, if one was cached before.
+     *
+     * @param factory the factory which was used to compile the copier.
+     * @param <T>     the type of instances the copier can copy.
+     * @return the cached copier for the given factory, null if no copier was cached yet.
+     * @throws NullPointerException if the given factory is null.
+     */
+    @SuppressWarnings("unchecked")
+    public @Nullable <T> ReflexionCopier<T> getCopier(@NonNull AccessorFactory factory) {
+      return (ReflexionCopier<T>) this.copiers.get(factory);
+    }
+
+    /**
+     * Caches the given copier for the given factory, unless another copier was cached concurrently. In that case the
+     * previously cached copier is returned and the given one should be discarded.
+     *
+     * @param factory the factory which was used to compile the copier.
+     * @param copier  the copier to cache.
+     * @param <T>     the type of instances the copier can copy.
+     * @return the copier which is now cached for the given factory.
+     * @throws NullPointerException if the given factory or copier is null.
+     */
+    @SuppressWarnings("unchecked")
+    public @NonNull <T> ReflexionCopier<T> putCopier(
+      @NonNull AccessorFactory factory,
+      @NonNull ReflexionCopier<T> copier
+    ) {
+      ReflexionCopier<?> known = this.copiers.putIfAbsent(factory, copier);
+      return known == null ? copier : (ReflexionCopier<T>) known;
+    }
+
+    /**
+     * Get the handle of type {@code ()Object} which allocates instances of the class without running a constructor,
+     * creating it if needed.
+     *
+     * @return the handle allocating instances of the class.
+     * @throws IllegalArgumentException if instances of the class cannot be allocated, for example for abstract classes.
+     * @throws ReflexionException       if no allocation strategy is available in the current jvm.
+     */
+    public @NonNull MethodHandle getAllocator() {
+      MethodHandle allocator = this.allocator;
+      if (allocator == null) {
+        allocator = InstanceAllocator.allocatorFor(this.type);
+        this.allocator = allocator;
+      }
+      return allocator;
+    }
+
+    /**
+     * Get all members which are matched by the given plan. If the plan requires an exact name, only the members with
+     * that name are tested. The results of cacheable plans are memoized, up to a fixed amount of plans per class. The
+     * results which were memoized first are evicted when the limit is exceeded.
+     *
+     * @param plan    the plan to match the members with.
+     * @param members all members of the class of the type matched by the plan.
+     * @param index   the index over the given members.
+     * @param <T>     the type of members to match.
+     * @return all members matched by the given plan, in the order of the given member collection.
+     * @throws NullPointerException if the given plan, member collection or index is null.
+     */
+    @SuppressWarnings("unchecked")
+    public @NonNull <T extends Member> List<T> findMatching(
+      @NonNull MatcherPlan<T> plan,
+      @NonNull Collection<T> members,
+      @NonNull MemberIndex<T> index
+    ) {
+      if (plan.isCacheable()) {
+        List<T> known = (List<T>) this.matches.get(plan);
+        if (known != null) {
+          return known;
+        }
+      }
+
+      List<T> matched = new ArrayList<>();
+      for (T member : candidates(plan, members, index)) {
+        if (plan.test(member)) {
+          matched.add(member);
+        }
+      }
+
+      // memoize the result if the plan allows it
+      List<T> result = matched.isEmpty() ? Collections.emptyList() : Collections.unmodifiableList(matched);
+      if (plan.isCacheable()) {
+        List<T> known = (List<T>) this.matches.putIfAbsent(plan, result);
+        if (known != null) {
+          return known;
+        }
+
+        // evict the results which were memoized first until the cache is within its bounds again
+        synchronized (this.matchOrder) {
+          this.matchOrder.add(plan);
+          Iterator<MatcherPlan<?>> iterator = this.matchOrder.iterator();
+          while (this.matches.size() > MAX_CACHED_MATCHES && iterator.hasNext()) {
+            this.matches.remove(iterator.next());
+            iterator.remove();
+          }
+        }
+      }
+      return result;
+    }
+
+    /**
+     * Get the first member which is matched by the given plan. If the result of the plan was memoized before it is
+     * used, else the candidates are tested until the first match is found.
+     *
+     * @param plan    the plan to match the members with.
+     * @param members all members of the class of the type matched by the plan.
+     * @param index   the index over the given members.
+     * @param <T>     the type of members to match.
+     * @return the first member matched by the given plan, null if no member matches.
+     * @throws NullPointerException if the given plan, member collection or index is null.
+     */
+    @SuppressWarnings("unchecked")
+    public @Nullable <T extends Member> T findFirstMatching(
+      @NonNull MatcherPlan<T> plan,
+      @NonNull Collection<T> members,
+      @NonNull MemberIndex<T> index
+    ) {
+      if (plan.isCacheable()) {
+        List<T> known = (List<T>) this.matches.get(plan);
+        if (known != null) {
+          return known.isEmpty() ? null : known.get(0);
+        }
+      }
+
+      for (T member : candidates(plan, members, index)) {
+        if (plan.test(member)) {
+          return member;
+        }
+      }
+      return null;
+    }
+
+    /**
+     * Get the first field of the class which has the given name. If the field cache is not populated yet the class
+     * hierarchy is travelled lazily, beginning at the class itself, and stops at the first field with the given name.
+     * The field cache is only populated if no field has the given name.
+     *
+     * @param name the name of the field to find.
+     * @return the first field with the given name, null if no field has the given name.
+     * @throws NullPointerException if the given name is null.
+     */
+    public @Nullable Field findField(@NonNull String name) {
+      if (this.fields == null) {
+        Field field = ReflexionPopulator.findFirstField(this.type, candidate -> candidate.getName().equals(name));
+        if (field != null) {
+          return field;
+        }
+      }
+      return this.getFieldIndex().firstByName(name);
+    }
+
+    /**
+     * Get the first field of the class which is matched by the given plan. If the field cache is not populated yet the
+     * class hierarchy is travelled lazily, beginning at the class itself, and stops at the first matching field. The
+     * field cache is only populated if no field matches.
+     *
+     * @param plan the plan to match the fields with.
+     * @return the first field matched by the given plan, null if no field matches.
+     * @throws NullPointerException if the given plan is null.
+     */
+    public @Nullable Field findField(@NonNull MatcherPlan<Field> plan) {
+      if (this.fields == null) {
+        Field field = ReflexionPopulator.findFirstField(this.type, plan);
+        if (field != null) {
+          return field;
+        }
+      }
+      return this.findFirstMatching(plan, this.getFields(), this.getFieldIndex());
+    }
+
+    /**
+     * Get the first method of the class which has the given name and exact parameter types. If the method cache is not
+     * populated yet the class hierarchy is travelled lazily, beginning at the class itself, and stops at the first
+     * method with the given signature. The method cache is only populated if no method has the given signature.
+     *
+     * @param name       the name of the method to find.
+     * @param paramTypes the exact parameter types of the method to find.
+     * @return the first method with the given signature, null if no method has the given signature.
+     * @throws NullPointerException if the given name or parameter type array is null.
+     */
+    public @Nullable Method findMethod(@NonNull String name, @NonNull Class<?>[] paramTypes) {
+      if (this.methods == null) {
+        Method method = ReflexionPopulator.findFirstMethod(
+          this.type,
+          candidate -> candidate.getName().equals(name) && hasParameterTypes(candidate, paramTypes));
+        if (method != null) {
+          return method;
+        }
+      }
+      return this.getMethodIndex().bySignature(name, paramTypes);
+    }
+
+    /**
+     * Get the first method of the class which is matched by the given plan. If the method cache is not populated yet
+     * the class hierarchy is travelled lazily, beginning at the class itself, and stops at the first matching method.
+     * The method cache is only populated if no method matches.
+     *
+     * @param plan the plan to match the methods with.
+     * @return the first method matched by the given plan, null if no method matches.
+     * @throws NullPointerException if the given plan is null.
+     */
+    public @Nullable Method findMethod(@NonNull MatcherPlan<Method> plan) {
+      if (this.methods == null) {
+        Method method = ReflexionPopulator.findFirstMethod(this.type, plan);
+        if (method != null) {
+          return method;
+        }
+      }
+      return this.findFirstMatching(plan, this.getMethods(), this.getMethodIndex());
+    }
+
+    /**
+     * Get the first constructor of the class which has the given exact parameter types. If the constructor cache is not
+     * populated yet the class hierarchy is travelled lazily, beginning at the class itself, and stops at the first
+     * constructor with the given parameter types. The constructor cache is only populated if no constructor matches.
+     *
+     * @param paramTypes the exact parameter types of the constructor to find.
+     * @return the first constructor with the given parameter types, null if no constructor matches.
+     * @throws NullPointerException if the given parameter type array is null.
+     */
+    public @Nullable Constructor<?> findConstructor(@NonNull Class<?>[] paramTypes) {
+      if (this.constructors == null) {
+        Constructor<?> ctor = ReflexionPopulator.findFirstConstructor(
+          this.type,
+          candidate -> hasParameterTypes(candidate, paramTypes));
+        if (ctor != null) {
+          return ctor;
+        }
+      }
+      return this.getConstructorIndex().bySignature(null, paramTypes);
+    }
+
+    /**
+     * Get the first constructor of the class which is matched by the given plan. If the constructor cache is not
+     * populated yet the class hierarchy is travelled lazily, beginning at the class itself, and stops at the first
+     * matching constructor. The constructor cache is only populated if no constructor matches.
+     *
+     * @param plan the plan to match the constructors with.
+     * @return the first constructor matched by the given plan, null if no constructor matches.
+     * @throws NullPointerException if the given plan is null.
+     */
+    public @Nullable Constructor<?> findConstructor(@NonNull MatcherPlan<Constructor<?>> plan) {
+      if (this.constructors == null) {
+        Constructor<?> ctor = ReflexionPopulator.findFirstConstructor(this.type, plan);
+        if (ctor != null) {
+          return ctor;
+        }
+      }
+      return this.findFirstMatching(plan, this.getConstructors(), this.getConstructorIndex());
+    }
+
+    /**
+     * Checks if the given executable has exactly the given parameter types.
+     *
+     * @param executable the executable to check.
+     * @param paramTypes the expected parameter types.
+     * @return true if the executable has exactly the given parameter types, false otherwise.
+     */
+    private static boolean hasParameterTypes(@NonNull Executable executable, @NonNull Class<?>[] paramTypes) {
+      return executable.getParameterCount() == paramTypes.length
+        && Arrays.equals(executable.getParameterTypes(), paramTypes);
+    }
+
+    /**
+     * Get the members which need to be tested against the given plan.
+     *
+     * @param plan    the plan to get the candidates for.
+     * @param members all members of the class of the type matched by the plan.
+     * @param index   the index over the given members.
+     * @param <T>     the type of members to match.
+     * @return the members with the name required by the plan, all given members if the plan requires no name.
+     */
+    private static @NonNull <T extends Member> Collection<T> candidates(
+      @NonNull MatcherPlan<T> plan,
+      @NonNull Collection<T> members,
+      @NonNull MemberIndex<T> index
+    ) {
+      String requiredName = plan.getRequiredName();
+      return requiredName == null ? members : index.byName(requiredName);
+    }
+  }
+
+  /**
+   * The key of a cached accessor, consisting of the factory which created the accessor and the member it wraps.
+   *
+   * @since 1.4
+   */
+  private static final class AccessorKey {
+
+    private final AccessorFactory factory;
+    private final Member member;
+
+    /**
+     * Constructs a new accessor key.
+     *
+     * @param factory the factory which created the accessor.
+     * @param member  the member wrapped by the accessor.
+     */
+    public AccessorKey(@NonNull AccessorFactory factory, @NonNull Member member) {
+      this.factory = factory;
+      this.member = member;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean equals(Object o) {
+      if (this == o) {
+        return true;
+      }
+      if (!(o instanceof AccessorKey)) {
+        return false;
+      }
+
+      AccessorKey that = (AccessorKey) o;
+      return this.factory.equals(that.factory) && this.member.equals(that.member);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int hashCode() {
+      return 31 * this.factory.hashCode() + this.member.hashCode();
+    }
+  }
+}
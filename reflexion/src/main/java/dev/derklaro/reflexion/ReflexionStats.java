@@ -0,0 +1,272 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.time.Duration;
+import java.util.Collections;
+import java.util.Map;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+import org.jetbrains.annotations.Unmodifiable;
+
+/**
+ * A snapshot of the runtime statistics of reflexion. Collecting statistics is disabled by default, as it adds a small
+ * overhead to each lookup, and can be enabled by setting the {@code dev.derklaro.reflexion.stats} system property to
+ * true. If collecting is disabled all counters of the snapshot are zero.
+ * <p>
+ * The statistics are process-wide and include:
+ * <ul>
+ *   <li>the hits and misses of the shared member and accessor caches, per class.
+ *   <li>the amount of members which were wrapped by an accessor factory, per member type.
+ *   <li>the total time spent building method handles in the method handle based accessor factories.
+ *   <li>the amount of members for which no accessor class could be generated by the bytecode accessor factory.
+ *   <li>the amount of exceptional results which were created.
+ * </ul>
+ * <p>
+ * A high amount of accessor cache misses for a class usually indicates that the class is invalidated repeatedly, or
+ * that accessors are requested from different accessor factories.
+ *
+ * @see Reflexion#stats()
+ * @since 1.4
+ */
+public final class ReflexionStats {
+
+  private final boolean enabled;
+  private final long fieldWraps;
+  private final long methodWraps;
+  private final long constructorWraps;
+  private final long handleBuildNanos;
+  private final long generationFallbacks;
+  private final long exceptionalResults;
+  private final Map<Class<?>, ClassStats> classStats;
+
+  /**
+   * Constructs a new statistics snapshot. Internal use only, a snapshot of the current statistics can be obtained from
+   * {@link Reflexion#stats()}.
+   *
+   * @param enabled             if collecting statistics is enabled.
+   * @param fieldWraps          the amount of fields wrapped by an accessor factory.
+   * @param methodWraps         the amount of methods wrapped by an accessor factory.
+   * @param constructorWraps    the amount of constructors wrapped by an accessor factory.
+   * @param handleBuildNanos    the total time spent building method handles, in nanoseconds.
+   * @param generationFallbacks the amount of members for which no accessor class could be generated.
+   * @param exceptionalResults  the amount of exceptional results which were created.
+   * @param classStats          the statistics of each class.
+   * @throws NullPointerException if the given class statistics map is null.
+   */
+  public ReflexionStats(
+    boolean enabled,
+    long fieldWraps,
+    long methodWraps,
+    long constructorWraps,
+    long handleBuildNanos,
+    long generationFallbacks,
+    long exceptionalResults,
+    @NonNull Map<Class<?>, ClassStats> classStats
+  ) {
+    this.enabled = enabled;
+    this.fieldWraps = fieldWraps;
+    this.methodWraps = methodWraps;
+    this.constructorWraps = constructorWraps;
+    this.handleBuildNanos = handleBuildNanos;
+    this.generationFallbacks = generationFallbacks;
+    this.exceptionalResults = exceptionalResults;
+    this.classStats = Collections.unmodifiableMap(classStats);
+  }
+
+  /**
+   * Get if collecting statistics is enabled. If not all counters of this snapshot are zero.
+   *
+   * @return true if collecting statistics is enabled, false otherwise.
+   */
+  public boolean isEnabled() {
+    return this.enabled;
+  }
+
+  /**
+   * Get the amount of fields which were wrapped by an accessor factory.
+   *
+   * @return the amount of fields which were wrapped by an accessor factory.
+   */
+  public long getFieldWraps() {
+    return this.fieldWraps;
+  }
+
+  /**
+   * Get the amount of methods which were wrapped by an accessor factory.
+   *
+   * @return the amount of methods which were wrapped by an accessor factory.
+   */
+  public long getMethodWraps() {
+    return this.methodWraps;
+  }
+
+  /**
+   * Get the amount of constructors which were wrapped by an accessor factory.
+   *
+   * @return the amount of constructors which were wrapped by an accessor factory.
+   */
+  public long getConstructorWraps() {
+    return this.constructorWraps;
+  }
+
+  /**
+   * Get the total time spent building method handles in the method handle based accessor factories.
+   *
+   * @return the total time spent building method handles.
+   */
+  public @NonNull Duration getHandleBuildTime() {
+    return Duration.ofNanos(this.handleBuildNanos);
+  }
+
+  /**
+   * Get the amount of members for which no accessor class could be generated by the bytecode accessor factory, these
+   * members are wrapped using method handles instead.
+   *
+   * @return the amount of members for which the accessor generation fell back to method handles.
+   */
+  public long getGenerationFallbacks() {
+    return this.generationFallbacks;
+  }
+
+  /**
+   * Get the amount of exceptional results which were created, for example by failed accessor calls.
+   *
+   * @return the amount of exceptional results which were created.
+   */
+  public long getExceptionalResults() {
+    return this.exceptionalResults;
+  }
+
+  /**
+   * Get the statistics of all classes which were looked up since collecting was enabled or the statistics were reset.
+   *
+   * @return the statistics of each class.
+   */
+  public @Unmodifiable @NonNull Map<Class<?>, ClassStats> getClassStats() {
+    return this.classStats;
+  }
+
+  /**
+   * Get the statistics of the given class.
+   *
+   * @param type the class to get the statistics of.
+   * @return the statistics of the given class, null if no statistics were collected for the class.
+   * @throws NullPointerException if the given class is null.
+   */
+  public @Nullable ClassStats getClassStats(@NonNull Class<?> type) {
+    return this.classStats.get(type);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull String toString() {
+    return "ReflexionStats(enabled=" + this.enabled
+      + ", fieldWraps=" + this.fieldWraps
+      + ", methodWraps=" + this.methodWraps
+      + ", constructorWraps=" + this.constructorWraps
+      + ", handleBuildTime=" + this.getHandleBuildTime()
+      + ", generationFallbacks=" + this.generationFallbacks
+      + ", exceptionalResults=" + this.exceptionalResults
+      + ", classes=" + this.classStats.size() + ")";
+  }
+
+  /**
+   * The cache statistics of a single class.
+   *
+   * @since 1.4
+   */
+  public static final class ClassStats {
+
+    private final long memberCacheHits;
+    private final long memberCacheMisses;
+    private final long accessorCacheHits;
+    private final long accessorCacheMisses;
+
+    /**
+     * Constructs new class statistics. Internal use only.
+     *
+     * @param memberCacheHits     the amount of member cache lookups which used a populated cache.
+     * @param memberCacheMisses   the amount of member cache lookups which populated the cache.
+     * @param accessorCacheHits   the amount of accessor lookups which returned a cached accessor.
+     * @param accessorCacheMisses the amount of accessor lookups which had to wrap the member.
+     */
+    public ClassStats(long memberCacheHits, long memberCacheMisses, long accessorCacheHits, long accessorCacheMisses) {
+      this.memberCacheHits = memberCacheHits;
+      this.memberCacheMisses = memberCacheMisses;
+      this.accessorCacheHits = accessorCacheHits;
+      this.accessorCacheMisses = accessorCacheMisses;
+    }
+
+    /**
+     * Get the amount of member cache lookups which used a populated cache.
+     *
+     * @return the amount of member cache hits.
+     */
+    public long getMemberCacheHits() {
+      return this.memberCacheHits;
+    }
+
+    /**
+     * Get the amount of member cache lookups which populated the cache.
+     *
+     * @return the amount of member cache misses.
+     */
+    public long getMemberCacheMisses() {
+      return this.memberCacheMisses;
+    }
+
+    /**
+     * Get the amount of accessor lookups which returned a cached accessor.
+     *
+     * @return the amount of accessor cache hits.
+     */
+    public long getAccessorCacheHits() {
+      return this.accessorCacheHits;
+    }
+
+    /**
+     * Get the amount of accessor lookups which had to wrap the member.
+     *
+     * @return the amount of accessor cache misses.
+     */
+    public long getAccessorCacheMisses() {
+      return this.accessorCacheMisses;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull String toString() {
+      return "ClassStats(memberCacheHits=" + this.memberCacheHits
+        + ", memberCacheMisses=" + this.memberCacheMisses
+        + ", accessorCacheHits=" + this.accessorCacheHits
+        + ", accessorCacheMisses=" + this.accessorCacheMisses + ")";
+    }
+  }
+}
@@ -24,6 +24,7 @@
 
 package dev.derklaro.reflexion;
 
+import dev.derklaro.reflexion.internal.util.Stats;
 import dev.derklaro.reflexion.internal.util.Util;
 import java.util.NoSuchElementException;
 import java.util.Optional;
@@ -45,6 +46,9 @@
  */
 public final class Result<S> implements Supplier<S> {
 
+  // the shared successful result without a value
+  private static final Result<?> EMPTY_SUCCESS = new Result<>(null, null);
+
   private final S result;
   private final Throwable exception;
 
@@ -83,14 +87,16 @@ public static <T> Result<T> tryExecute(@NonNull ExceptionalSupplier<T> supplier)
   }
 
   /**
-   * Constructs a new result instance holding the given object as its successful result.
+   * Constructs a new result instance holding the given object as its successful result. Successful results without a
+   * value (for example returned by field setters or void methods) are shared and do not allocate.
    *
    * @param result the successful result of the action.
    * @param <T>    the type of the result.
-   * @return a new result instance which succeeded and holds the given object as it's result value.
+   * @return a result instance which succeeded and holds the given object as it's result value.
    */
+  @SuppressWarnings("unchecked")
   public static @NonNull <T> Result<T> success(@Nullable T result) {
-    return new Result<>(result, null);
+    return result == null ? (Result<T>) EMPTY_SUCCESS : new Result<>(result, null);
   }
 
   /**
@@ -102,6 +108,9 @@ public static <T> Result<T> tryExecute(@NonNull ExceptionalSupplier<T> supplier)
    * @throws NullPointerException if the given exception is null.
    */
   public static @NonNull <T> Result<T> exceptional(@NonNull Throwable exception) {
+    if (Stats.ENABLED) {
+      Stats.exceptionalResult();
+    }
     return new Result<>(null, exception);
   }
 
@@ -0,0 +1,184 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.Collections;
+import java.util.List;
+import java.util.Objects;
+import lombok.NonNull;
+import org.jetbrains.annotations.Unmodifiable;
+
+/**
+ * Describes a class and some of its members which should be resolved and wrapped ahead of time using
+ * {@link Reflexion#preload(ClassLoader, Collection)}. Target specs are immutable, each {@code with} method returns a
+ * new spec which additionally contains the given members.
+ * <p>
+ * Example usage:
+ * <pre>
+ * {@code
+ *  TargetSpec spec = TargetSpec.of("x.y.HelloWorld")
+ *    .withFields("world")
+ *    .withMethods("helloWorld", "greet")
+ *    .withConstructors();
+ * }
+ * </pre>
+ *
+ * @since 1.4
+ */
+public final class TargetSpec {
+
+  private final String className;
+  private final List<String> fieldNames;
+  private final List<String> methodNames;
+  private final boolean constructors;
+
+  /**
+   * Constructs a new target spec.
+   *
+   * @param className    the name of the target class.
+   * @param fieldNames   the names of the fields to wrap.
+   * @param methodNames  the names of the methods to wrap.
+   * @param constructors if all constructors of the target class should be wrapped.
+   */
+  private TargetSpec(
+    @NonNull String className,
+    @NonNull List<String> fieldNames,
+    @NonNull List<String> methodNames,
+    boolean constructors
+  ) {
+    this.className = className;
+    this.fieldNames = fieldNames;
+    this.methodNames = methodNames;
+    this.constructors = constructors;
+  }
+
+  /**
+   * Creates a new target spec for the class with the given name. Preloading the returned spec resolves the class and
+   * populates its member caches, but does not wrap any members.
+   *
+   * @param className the binary name of the class to preload.
+   * @return a new target spec for the given class.
+   * @throws NullPointerException if the given class name is null.
+   */
+  public static @NonNull TargetSpec of(@NonNull String className) {
+    return new TargetSpec(className, Collections.emptyList(), Collections.emptyList(), false);
+  }
+
+  /**
+   * Get a copy of this spec which additionally wraps the fields with the given names.
+   *
+   * @param names the names of the fields to wrap.
+   * @return a copy of this spec which additionally wraps the given fields.
+   * @throws NullPointerException if the given name array or an element of it is null.
+   */
+  public @NonNull TargetSpec withFields(@NonNull String @NonNull ... names) {
+    return new TargetSpec(this.className, append(this.fieldNames, names), this.methodNames, this.constructors);
+  }
+
+  /**
+   * Get a copy of this spec which additionally wraps all methods with one of the given names.
+   *
+   * @param names the names of the methods to wrap.
+   * @return a copy of this spec which additionally wraps the given methods.
+   * @throws NullPointerException if the given name array or an element of it is null.
+   */
+  public @NonNull TargetSpec withMethods(@NonNull String @NonNull ... names) {
+    return new TargetSpec(this.className, this.fieldNames, append(this.methodNames, names), this.constructors);
+  }
+
+  /**
+   * Get a copy of this spec which additionally wraps all constructors of the target class.
+   *
+   * @return a copy of this spec which additionally wraps all constructors.
+   */
+  public @NonNull TargetSpec withConstructors() {
+    return new TargetSpec(this.className, this.fieldNames, this.methodNames, true);
+  }
+
+  /**
+   * Get the binary name of the class to preload.
+   *
+   * @return the binary name of the class to preload.
+   */
+  public @NonNull String getClassName() {
+    return this.className;
+  }
+
+  /**
+   * Get the names of the fields to wrap.
+   *
+   * @return the names of the fields to wrap.
+   */
+  public @NonNull @Unmodifiable List<String> getFieldNames() {
+    return this.fieldNames;
+  }
+
+  /**
+   * Get the names of the methods of which all overloads should be wrapped.
+   *
+   * @return the names of the methods to wrap.
+   */
+  public @NonNull @Unmodifiable List<String> getMethodNames() {
+    return this.methodNames;
+  }
+
+  /**
+   * Get if all constructors of the target class should be wrapped.
+   *
+   * @return true if all constructors of the target class should be wrapped, false otherwise.
+   */
+  public boolean isConstructors() {
+    return this.constructors;
+  }
+
+  /**
+   * Internal: creates a new unmodifiable list containing the elements of the given list followed by the given names.
+   *
+   * @param current the current names.
+   * @param names   the names to append.
+   * @return a new unmodifiable list containing all given names.
+   */
+  private static @NonNull @Unmodifiable List<String> append(@NonNull List<String> current, @NonNull String[] names) {
+    List<String> result = new ArrayList<>(current.size() + names.length);
+    result.addAll(current);
+    for (String name : names) {
+      result.add(Objects.requireNonNull(name, "name"));
+    }
+    return Collections.unmodifiableList(result);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull String toString() {
+    return "TargetSpec(className=" + this.className
+      + ", fields=" + this.fieldNames
+      + ", methods=" + this.methodNames
+      + ", constructors=" + this.constructors + ")";
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.annotation;
+
+import java.lang.annotation.Documented;
+import java.lang.annotation.ElementType;
+import java.lang.annotation.Repeatable;
+import java.lang.annotation.Retention;
+import java.lang.annotation.RetentionPolicy;
+import java.lang.annotation.Target;
+
+/**
+ * Declares a class whose members should be accessible through accessors generated at compile time by the reflexion
+ * annotation processor ({@code dev.derklaro.reflexion:reflexion-processor}). For each annotation the processor
+ * generates a class in the package of the annotated element, which holds a {@code public static final} accessor
+ * constant for each declared member. The members are resolved once when the generated class is initialized, without
+ * travelling the class hierarchy or evaluating matchers at runtime.
+ * <p>
+ * Example usage:
+ * <pre>
+ * {@code
+ *  @ReflexionTarget(
+ *    clazz = "x.y.HelloWorld",
+ *    fields = "world",
+ *    methods = {"helloWorld", "greet(java.lang.String, int[])"},
+ *    constructors = "()")
+ *  final class Targets {
+ *  }
+ *
+ *  // generated: HelloWorldAccessors.WORLD, HelloWorldAccessors.HELLO_WORLD, HelloWorldAccessors.GREET_STRING_INT_ARRAY
+ *  // and HelloWorldAccessors.CONSTRUCTOR
+ * }
+ * </pre>
+ * The members are looked up in the target class and its super classes (and super interfaces for methods), the member
+ * declared closest to the target class is used. The processor additionally writes a native-image reflection
+ * configuration for all declared members, which makes the generated accessors usable in GraalVM native images.
+ *
+ * @since 1.4
+ */
+@Documented
+@Repeatable(ReflexionTargets.class)
+@Retention(RetentionPolicy.SOURCE)
+@Target({ElementType.TYPE, ElementType.PACKAGE})
+public @interface ReflexionTarget {
+
+  /**
+   * Get the canonical name of the class to generate the accessors for. The class must be on the compile classpath.
+   *
+   * @return the canonical name of the target class.
+   */
+  String clazz();
+
+  /**
+   * Get the simple name of the generated class. Defaults to the simple name of the target class suffixed with
+   * {@code Accessors}.
+   *
+   * @return the simple name of the generated class, an empty string to use the default name.
+   */
+  String name() default "";
+
+  /**
+   * Get the names of the fields to generate accessors for.
+   *
+   * @return the names of the fields to generate accessors for.
+   */
+  String[] fields() default {};
+
+  /**
+   * Get the methods to generate accessors for. A method is either declared by its name only, if there is exactly one
+   * method with that name, or by its name followed by the canonical names of its parameter types in parentheses, for
+   * example {@code greet(java.lang.String, int[])}.
+   *
+   * @return the methods to generate accessors for.
+   */
+  String[] methods() default {};
+
+  /**
+   * Get the constructors to generate accessors for. A constructor is declared by the canonical names of its parameter
+   * types in parentheses, for example {@code ()} or {@code (java.lang.String, int)}.
+   *
+   * @return the constructors to generate accessors for.
+   */
+  String[] constructors() default {};
+}
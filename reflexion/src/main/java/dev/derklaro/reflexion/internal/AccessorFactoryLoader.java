@@ -25,13 +25,20 @@
 package dev.derklaro.reflexion.internal;
 
 import dev.derklaro.reflexion.AccessorFactory;
+import dev.derklaro.reflexion.AccessorFactorySelection;
 import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.bytecode.BytecodeAccessorFactory;
 import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.JniAccessorFactory;
 import dev.derklaro.reflexion.internal.natives.NativeAccessorFactory;
+import dev.derklaro.reflexion.internal.unsafe.UnsafeAccessorFactory;
+import java.time.Duration;
 import java.util.ArrayList;
 import java.util.Collections;
+import java.util.Iterator;
 import java.util.List;
 import java.util.ServiceLoader;
+import java.util.function.Supplier;
 import lombok.NonNull;
 
 /**
@@ -41,14 +48,34 @@
  */
 public final class AccessorFactoryLoader {
 
-  private static final AccessorFactory[] DEFAULT_FACTORIES = new AccessorFactory[]{
-    new NativeAccessorFactory(), new MethodHandleAccessorFactory(), new BareAccessorFactory()
-  };
+  // the default factories, ordered by their static priority (the first available factory is the best one)
+  // the factories are only constructed when needed as probing them can be expensive (e.g. loading the native library)
+  private static final List<Supplier<AccessorFactory>> DEFAULT_FACTORIES = defaultFactories();
 
   private AccessorFactoryLoader() {
     throw new UnsupportedOperationException();
   }
 
+  /**
+   * Get the default factories, ordered by their static priority in the current jvm.
+   *
+   * @return the default factories for the current jvm.
+   */
+  private static @NonNull List<Supplier<AccessorFactory>> defaultFactories() {
+    List<Supplier<AccessorFactory>> factories = new ArrayList<>();
+    factories.add(BytecodeAccessorFactory::new);
+    // field offsets are only cheaper than the method handle based factories on older jvms, and never cheaper than the
+    // generated accessors: the unsafe factory is only selected by default if bytecode generation is not available
+    if (UnsafeAccessorFactory.isPreferredJvm()) {
+      factories.add(UnsafeAccessorFactory::new);
+    }
+    factories.add(NativeAccessorFactory::new);
+    factories.add(MethodHandleAccessorFactory::new);
+    factories.add(JniAccessorFactory::new);
+    factories.add(BareAccessorFactory::new);
+    return Collections.unmodifiableList(factories);
+  }
+
   /**
    * Loads the best factory for the current environment, also making use of the service loader to allow other libraries
    * to opt in and offer their own implementation of an accessor factory. The factories are sorted based on their
@@ -56,24 +83,41 @@ private AccessorFactoryLoader() {
    *
    * @return the best accessor factory for the current jvm environment.
    * @throws IllegalStateException if no accessor factories are available.
+   * @see #selectFactory()
    */
   public static @NonNull AccessorFactory doLoadFactory() {
-    // load all other factories, maybe brought in by external libs
-    ClassLoader cl = AccessorFactoryLoader.class.getClassLoader();
-    ServiceLoader<AccessorFactory> loader = ServiceLoader.load(AccessorFactory.class, cl);
+    return selectFactory().getSelectedFactory();
+  }
 
-    // find all factories which are available from the external ones
+  /**
+   * Selects the best factory for the current environment, also making use of the service loader to allow other
+   * libraries to opt in and offer their own implementation of an accessor factory. The default factories are probed in
+   * the order of their static priority, stopping at the first available one. The available factories provided as a
+   * service and the best default factory are then sorted based on their implementation of comparable and the best
+   * matching one will be used in the environment.
+   *
+   * @return a report of the factory selection, containing the best accessor factory for the current environment.
+   * @throws IllegalStateException if no accessor factories are available.
+   * @since 1.4
+   */
+  public static @NonNull AccessorFactorySelection selectFactory() {
+    long start = System.nanoTime();
+    List<AccessorFactorySelection.Probe> probes = new ArrayList<>();
     List<AccessorFactory> availableFactories = new ArrayList<>();
-    for (AccessorFactory factory : loader) {
-      if (factory.isAvailable()) {
-        availableFactories.add(factory);
-      }
+
+    // load all other factories, maybe brought in by external libs
+    ClassLoader cl = AccessorFactoryLoader.class.getClassLoader();
+    Iterator<AccessorFactory> services = ServiceLoader.load(AccessorFactory.class, cl).iterator();
+    while (services.hasNext()) {
+      long probeStart = System.nanoTime();
+      probe(services.next(), probeStart, true, probes, availableFactories);
     }
 
-    // add all factories which are available from the default ones
-    for (AccessorFactory factory : DEFAULT_FACTORIES) {
-      if (factory.isAvailable()) {
-        availableFactories.add(factory);
+    // find the best available default factory, all factories with a lower priority can be skipped
+    for (Supplier<AccessorFactory> factory : DEFAULT_FACTORIES) {
+      long probeStart = System.nanoTime();
+      if (probe(factory.get(), probeStart, false, probes, availableFactories)) {
+        break;
       }
     }
 
@@ -84,6 +128,37 @@ private AccessorFactoryLoader() {
 
     // sort the list to put the best factory to the top
     Collections.sort(availableFactories);
-    return availableFactories.get(0);
+    return new AccessorFactorySelection(
+      availableFactories.get(0),
+      probes,
+      Duration.ofNanos(System.nanoTime() - start));
+  }
+
+  /**
+   * Checks if the given factory is available and records the result of the check.
+   *
+   * @param factory    the factory to probe.
+   * @param probeStart the nano time at which the probe (including the factory construction) started.
+   * @param service    if the factory was provided as a service.
+   * @param probes     the list to add the probe result to.
+   * @param available  the list to add the factory to if it is available.
+   * @return true if the given factory is available, false otherwise.
+   * @throws NullPointerException if the given factory or one of the lists is null.
+   */
+  private static boolean probe(
+    @NonNull AccessorFactory factory,
+    long probeStart,
+    boolean service,
+    @NonNull List<AccessorFactorySelection.Probe> probes,
+    @NonNull List<AccessorFactory> available
+  ) {
+    boolean factoryAvailable = factory.isAvailable();
+    if (factoryAvailable) {
+      available.add(factory);
+    }
+
+    Duration probeTime = Duration.ofNanos(System.nanoTime() - probeStart);
+    probes.add(new AccessorFactorySelection.Probe(factory.getClass(), service, factoryAvailable, probeTime));
+    return factoryAvailable;
   }
 }
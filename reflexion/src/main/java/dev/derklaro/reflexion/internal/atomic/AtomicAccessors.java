@@ -0,0 +1,58 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.atomic;
+
+import dev.derklaro.reflexion.AtomicFieldAccessor;
+import dev.derklaro.reflexion.Reflexion;
+import dev.derklaro.reflexion.ReflexionException;
+import java.lang.reflect.Field;
+import lombok.NonNull;
+
+/**
+ * Internal: creates atomic accessors for fields. This is the java 8 variant of the class which has no way to access
+ * fields atomically. The multi-release jar ships a java 9 variant of this class in {@code META-INF/versions/9} which is
+ * based on var handles and replaces this implementation on newer jvms.
+ *
+ * @since 1.4
+ */
+public final class AtomicAccessors {
+
+  private AtomicAccessors() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Wraps the given field into an atomic accessor.
+   *
+   * @param reflexion the reflexion instance which requested the accessor.
+   * @param field     the field to wrap.
+   * @return an atomic accessor for the given field.
+   * @throws NullPointerException if the given reflexion instance or field is null.
+   * @throws ReflexionException   if atomic field access is not possible in the current jvm.
+   */
+  public static @NonNull AtomicFieldAccessor wrapField(@NonNull Reflexion reflexion, @NonNull Field field) {
+    throw new ReflexionException("Atomic field access requires java 9 or newer");
+  }
+}
@@ -30,8 +30,12 @@
 import dev.derklaro.reflexion.Reflexion;
 import dev.derklaro.reflexion.ReflexionException;
 import dev.derklaro.reflexion.Result;
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
 import java.lang.reflect.Constructor;
 import java.lang.reflect.Field;
+import java.lang.reflect.InvocationTargetException;
 import java.lang.reflect.Method;
 import java.lang.reflect.Modifier;
 import lombok.NonNull;
@@ -44,6 +48,8 @@
  */
 public final class BareAccessorFactory implements AccessorFactory {
 
+  private static final Object[] NO_ARGS = new Object[0];
+
   /**
    * {@inheritDoc}
    */
@@ -100,6 +106,17 @@ public int compareTo(@NonNull AccessorFactory o) {
     return o instanceof BareAccessorFactory ? 0 : 1;
   }
 
+  /**
+   * Get the exception thrown by the invoked method or constructor.
+   *
+   * @param exception the exception to unwrap.
+   * @return the cause of the given exception, the exception itself if no cause is present.
+   */
+  private static @NonNull Throwable unwrap(@NonNull InvocationTargetException exception) {
+    Throwable cause = exception.getCause();
+    return cause == null ? exception : cause;
+  }
+
   /**
    * A field accessor which invokes the bare java.lang.reflect field.
    *
@@ -172,6 +189,249 @@ public BareFieldAccessor(Field field, Reflexion reflexion) {
         return null;
       });
     }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <T> T getValueDirect(@Nullable Object instance) {
+      try {
+        return (T) this.field.get(instance);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setValueDirect(@Nullable Object instance, @Nullable Object value) {
+      try {
+        this.field.set(instance, value);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int getInt(@Nullable Object instance) {
+      try {
+        return this.field.getInt(instance);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setInt(@Nullable Object instance, int value) {
+      try {
+        this.field.setInt(instance, value);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public long getLong(@Nullable Object instance) {
+      try {
+        return this.field.getLong(instance);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setLong(@Nullable Object instance, long value) {
+      try {
+        this.field.setLong(instance, value);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public double getDouble(@Nullable Object instance) {
+      try {
+        return this.field.getDouble(instance);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setDouble(@Nullable Object instance, double value) {
+      try {
+        this.field.setDouble(instance, value);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public float getFloat(@Nullable Object instance) {
+      try {
+        return this.field.getFloat(instance);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setFloat(@Nullable Object instance, float value) {
+      try {
+        this.field.setFloat(instance, value);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean getBoolean(@Nullable Object instance) {
+      try {
+        return this.field.getBoolean(instance);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setBoolean(@Nullable Object instance, boolean value) {
+      try {
+        this.field.setBoolean(instance, value);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public byte getByte(@Nullable Object instance) {
+      try {
+        return this.field.getByte(instance);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setByte(@Nullable Object instance, byte value) {
+      try {
+        this.field.setByte(instance, value);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public short getShort(@Nullable Object instance) {
+      try {
+        return this.field.getShort(instance);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setShort(@Nullable Object instance, short value) {
+      try {
+        this.field.setShort(instance, value);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public char getChar(@Nullable Object instance) {
+      try {
+        return this.field.getChar(instance);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setChar(@Nullable Object instance, char value) {
+      try {
+        this.field.setChar(instance, value);
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle getterHandle() {
+      try {
+        // the field is accessible, no access checks are done by the lookup
+        return MethodHandles.lookup().unreflectGetter(this.field);
+      } catch (IllegalAccessException exception) {
+        throw new ReflexionException(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle setterHandle() {
+      try {
+        // the field is accessible, no access checks are done by the lookup
+        return MethodHandles.lookup().unreflectSetter(this.field);
+      } catch (IllegalAccessException exception) {
+        throw new ReflexionException(exception);
+      }
+    }
   }
 
   /**
@@ -244,6 +504,43 @@ public BareMethodAccessor(Method method, Reflexion reflexion) {
     public @NonNull <V> Result<V> invoke(@Nullable Object instance, @NonNull Object... args) {
       return Result.tryExecute(() -> (V) this.method.invoke(instance, args));
     }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public <V> V invokeDirect(@Nullable Object instance) {
+      return this.invokeDirect(instance, NO_ARGS);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
+      try {
+        return (V) this.method.invoke(instance, args);
+      } catch (InvocationTargetException exception) {
+        // rethrow the exception thrown by the method
+        throw Util.throwUnchecked(unwrap(exception));
+      } catch (IllegalAccessException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle asMethodHandle() {
+      try {
+        // the method is accessible, no access checks are done by the lookup
+        return MethodHandles.lookup().unreflect(this.method);
+      } catch (IllegalAccessException exception) {
+        throw new ReflexionException(exception);
+      }
+    }
   }
 
   /**
@@ -316,5 +613,42 @@ public BareConstructorAccessor(Reflexion reflexion, Constructor<?> constructor)
     public @NonNull <V> Result<V> invoke(@Nullable Object instance, @NonNull Object... args) {
       return this.invokeWithArgs(args);
     }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public <V> V invokeDirect(@Nullable Object instance) {
+      return this.invokeDirect(null, NO_ARGS);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
+      try {
+        return (V) this.constructor.newInstance(args);
+      } catch (InvocationTargetException exception) {
+        // rethrow the exception thrown by the constructor
+        throw Util.throwUnchecked(unwrap(exception));
+      } catch (ReflectiveOperationException exception) {
+        throw Util.throwUnchecked(exception);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle asMethodHandle() {
+      try {
+        // the constructor is accessible, no access checks are done by the lookup
+        return MethodHandles.lookup().unreflectConstructor(this.constructor);
+      } catch (IllegalAccessException exception) {
+        throw new ReflexionException(exception);
+      }
+    }
   }
 }
@@ -0,0 +1,475 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.bytecode;
+
+import static dev.derklaro.reflexion.internal.bytecode.ClassFileWriter.descriptor;
+import static dev.derklaro.reflexion.internal.bytecode.ClassFileWriter.internalName;
+import static dev.derklaro.reflexion.internal.bytecode.ClassFileWriter.methodDescriptor;
+
+import dev.derklaro.reflexion.internal.bytecode.ClassFileWriter.MethodWriter;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Executable;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
+import java.util.List;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: generates the bytes of classes which directly access a field, method or constructor. The generated classes
+ * only implement functional interfaces of the {@code java.util.function} package, which are visible from every class
+ * loader, and are meant to be defined as a nestmate (or anonymous class) of the class declaring the accessed member.
+ *
+ * @since 1.4
+ */
+final class AccessorGenerator {
+
+  private static final String OBJECT = "java/lang/Object";
+  private static final String FUNCTION = "java/util/function/Function";
+  private static final String BI_FUNCTION = "java/util/function/BiFunction";
+  private static final String BI_CONSUMER = "java/util/function/BiConsumer";
+  private static final String TO_INT_FUNCTION = "java/util/function/ToIntFunction";
+  private static final String TO_LONG_FUNCTION = "java/util/function/ToLongFunction";
+  private static final String TO_DOUBLE_FUNCTION = "java/util/function/ToDoubleFunction";
+  private static final String OBJ_INT_CONSUMER = "java/util/function/ObjIntConsumer";
+  private static final String OBJ_LONG_CONSUMER = "java/util/function/ObjLongConsumer";
+  private static final String OBJ_DOUBLE_CONSUMER = "java/util/function/ObjDoubleConsumer";
+
+  private static final String APPLY_DESC = "(Ljava/lang/Object;)Ljava/lang/Object;";
+  private static final String BI_APPLY_DESC = "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;";
+  private static final String BI_ACCEPT_DESC = "(Ljava/lang/Object;Ljava/lang/Object;)V";
+
+  private static final String ACCESSOR_SUFFIX = "$$ReflexionAccessor";
+
+  private AccessorGenerator() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Checks if an accessor class can be generated for the given field. This is the case when the field type can be
+   * resolved and accessed from the declaring class of the field.
+   *
+   * @param field the field to check.
+   * @return true if an accessor for the field can be generated, false otherwise.
+   * @throws NullPointerException if the given field is null.
+   */
+  public static boolean canGenerate(@NonNull Field field) {
+    Class<?> host = field.getDeclaringClass();
+    return canHost(host) && isAccessibleFrom(host, field.getType());
+  }
+
+  /**
+   * Checks if an accessor class can be generated for the given method or constructor. This is the case when all
+   * parameter types can be resolved and accessed from the declaring class of executable and the executable can be
+   * invoked directly from a class file.
+   *
+   * @param executable the method or constructor to check.
+   * @return true if an accessor for the executable can be generated, false otherwise.
+   * @throws NullPointerException if the given executable is null.
+   */
+  public static boolean canGenerate(@NonNull Executable executable) {
+    Class<?> host = executable.getDeclaringClass();
+    if (!canHost(host)) {
+      return false;
+    }
+
+    int modifiers = executable.getModifiers();
+    if (executable instanceof Constructor<?>) {
+      // abstract classes cannot be instantiated, leave the error reporting to the fallback
+      if (Modifier.isAbstract(host.getModifiers())) {
+        return false;
+      }
+    } else {
+      // private interface methods can only be invoked via invokeinterface since java 11, signature polymorphic
+      // methods (for example MethodHandle.invoke) need special treatment we don't want to care about
+      boolean privateInterfaceMethod = host.isInterface() && Modifier.isPrivate(modifiers);
+      boolean signaturePolymorphic = Modifier.isNative(modifiers) && executable.isVarArgs();
+      if ((privateInterfaceMethod && !Modifier.isStatic(modifiers)) || signaturePolymorphic) {
+        return false;
+      }
+    }
+
+    // all parameter types must be accessible as we need to cast the given arguments to them
+    for (Class<?> paramType : executable.getParameterTypes()) {
+      if (!isAccessibleFrom(host, paramType)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Generates an accessor class for the given field. The accessor class implements {@code Function<Object, Object>}
+   * to get the field value (taking the instance or null) and, if requested, {@code BiConsumer<Object, Object>} to set
+   * the field value (taking the instance or null and the new value).
+   * <p>
+   * Fields of type int, long and double additionally get the matching primitive specialization, for example
+   * {@code ToIntFunction<Object>} and {@code ObjIntConsumer<Object>} for int fields, to access them without boxing.
+   *
+   * @param field      the field to generate the accessor for.
+   * @param withSetter if a setter should be generated, must be false for final fields.
+   * @return the bytes of the generated class.
+   * @throws NullPointerException if the given field is null.
+   */
+  public static byte[] generateFieldAccessor(@NonNull Field field, boolean withSetter) {
+    Class<?> owner = field.getDeclaringClass();
+    Class<?> type = field.getType();
+    boolean staticField = Modifier.isStatic(field.getModifiers());
+
+    String primitiveGetter = primitiveGetterInterface(type);
+    String primitiveSetter = primitiveSetterInterface(type);
+
+    List<String> interfaces = new ArrayList<>();
+    interfaces.add(FUNCTION);
+    if (withSetter) {
+      interfaces.add(BI_CONSUMER);
+    }
+    if (primitiveGetter != null) {
+      interfaces.add(primitiveGetter);
+      if (withSetter) {
+        interfaces.add(primitiveSetter);
+      }
+    }
+
+    ClassFileWriter writer = new ClassFileWriter(accessorName(owner), OBJECT, interfaces.toArray(new String[0]));
+    writeConstructor(writer);
+
+    // getter: Object apply(Object instance)
+    MethodWriter getter = writer.method("apply", APPLY_DESC);
+    if (!staticField) {
+      getter.loadReference(1).checkCast(owner);
+    }
+    getter.field(owner, field.getName(), type, false, staticField);
+    box(getter, type);
+    getter.returnValue(Object.class);
+
+    // setter: void accept(Object instance, Object value)
+    if (withSetter) {
+      MethodWriter setter = writer.method("accept", BI_ACCEPT_DESC);
+      if (!staticField) {
+        setter.loadReference(1).checkCast(owner);
+      }
+      setter.loadReference(2);
+      unboxOrCast(setter, type);
+      setter.field(owner, field.getName(), type, true, staticField).returnValue(void.class);
+    }
+
+    if (primitiveGetter != null) {
+      // getter: T applyAsT(Object instance)
+      String typeName = Character.toUpperCase(type.getName().charAt(0)) + type.getName().substring(1);
+      MethodWriter getterSpecialization = writer.method("applyAs" + typeName, methodDescriptor(type, Object.class));
+      if (!staticField) {
+        getterSpecialization.loadReference(1).checkCast(owner);
+      }
+      getterSpecialization.field(owner, field.getName(), type, false, staticField).returnValue(type);
+
+      // setter: void accept(Object instance, T value)
+      if (withSetter) {
+        MethodWriter setterSpecialization = writer.method("accept", methodDescriptor(void.class, Object.class, type));
+        if (!staticField) {
+          setterSpecialization.loadReference(1).checkCast(owner);
+        }
+        setterSpecialization.load(type, 2);
+        setterSpecialization.field(owner, field.getName(), type, true, staticField).returnValue(void.class);
+      }
+    }
+
+    return writer.toByteArray();
+  }
+
+  /**
+   * Generates an accessor class for the given method. The accessor class implements {@code BiFunction<Object,
+   * Object[], Object>} taking the instance (or null for static methods) and the arguments of the method, returning the
+   * method result or null for void methods.
+   *
+   * @param method the method to generate the accessor for.
+   * @return the bytes of the generated class.
+   * @throws NullPointerException if the given method is null.
+   */
+  public static byte[] generateMethodAccessor(@NonNull Method method) {
+    Class<?> owner = method.getDeclaringClass();
+    Class<?>[] paramTypes = method.getParameterTypes();
+    boolean staticMethod = Modifier.isStatic(method.getModifiers());
+
+    ClassFileWriter writer = new ClassFileWriter(accessorName(owner), OBJECT, BI_FUNCTION);
+    writeConstructor(writer);
+
+    // Object apply(Object instance, Object args)
+    MethodWriter invoker = writer.method("apply", BI_APPLY_DESC);
+    if (paramTypes.length > 0) {
+      invoker.loadReference(2).checkCast(Object[].class).storeReference(3);
+    }
+    if (!staticMethod) {
+      invoker.loadReference(1).checkCast(owner);
+    }
+    loadArguments(invoker, paramTypes, 3);
+
+    String ownerName = internalName(owner);
+    String desc = methodDescriptor(method.getReturnType(), paramTypes);
+    if (staticMethod) {
+      invoker.invokeStatic(ownerName, method.getName(), desc, owner.isInterface());
+    } else if (owner.isInterface()) {
+      invoker.invokeInterface(ownerName, method.getName(), desc);
+    } else {
+      invoker.invokeVirtual(ownerName, method.getName(), desc);
+    }
+
+    // void methods return null
+    if (method.getReturnType() == void.class) {
+      invoker.pushNull();
+    } else {
+      box(invoker, method.getReturnType());
+    }
+    invoker.returnValue(Object.class);
+
+    return writer.toByteArray();
+  }
+
+  /**
+   * Generates an accessor class for the given constructor. The accessor class implements {@code Function<Object[],
+   * Object>} taking the arguments of the constructor and returning the constructed instance.
+   *
+   * @param constructor the constructor to generate the accessor for.
+   * @return the bytes of the generated class.
+   * @throws NullPointerException if the given constructor is null.
+   */
+  public static byte[] generateConstructorAccessor(@NonNull Constructor<?> constructor) {
+    Class<?> owner = constructor.getDeclaringClass();
+    Class<?>[] paramTypes = constructor.getParameterTypes();
+
+    ClassFileWriter writer = new ClassFileWriter(accessorName(owner), OBJECT, FUNCTION);
+    writeConstructor(writer);
+
+    // Object apply(Object args)
+    MethodWriter invoker = writer.method("apply", APPLY_DESC);
+    if (paramTypes.length > 0) {
+      invoker.loadReference(1).checkCast(Object[].class).storeReference(2);
+    }
+    invoker.newInstance(owner).dup();
+    loadArguments(invoker, paramTypes, 2);
+    invoker.invokeSpecial(internalName(owner), "<init>", methodDescriptor(void.class, paramTypes));
+    invoker.returnValue(Object.class);
+
+    return writer.toByteArray();
+  }
+
+  /**
+   * Get the internal name of the primitive specialization of {@code Function} for the given field type.
+   *
+   * @param type the type of the field.
+   * @return the internal name of the primitive getter interface, null if the type has no specialization.
+   */
+  private static @Nullable String primitiveGetterInterface(@NonNull Class<?> type) {
+    if (type == int.class) {
+      return TO_INT_FUNCTION;
+    } else if (type == long.class) {
+      return TO_LONG_FUNCTION;
+    } else if (type == double.class) {
+      return TO_DOUBLE_FUNCTION;
+    } else {
+      return null;
+    }
+  }
+
+  /**
+   * Get the internal name of the primitive specialization of {@code BiConsumer} for the given field type.
+   *
+   * @param type the type of the field.
+   * @return the internal name of the primitive setter interface, null if the type has no specialization.
+   */
+  private static @Nullable String primitiveSetterInterface(@NonNull Class<?> type) {
+    if (type == int.class) {
+      return OBJ_INT_CONSUMER;
+    } else if (type == long.class) {
+      return OBJ_LONG_CONSUMER;
+    } else if (type == double.class) {
+      return OBJ_DOUBLE_CONSUMER;
+    } else {
+      return null;
+    }
+  }
+
+  /**
+   * Get the name of an accessor class which is hosted by the given class. The name must be in the same package as the
+   * host class.
+   *
+   * @param host the class hosting the accessor class.
+   * @return the internal name of the accessor class.
+   */
+  private static @NonNull String accessorName(@NonNull Class<?> host) {
+    return internalName(host) + ACCESSOR_SUFFIX;
+  }
+
+  /**
+   * Writes the public no-args constructor of a generated class.
+   *
+   * @param writer the writer of the class to write the constructor to.
+   */
+  private static void writeConstructor(@NonNull ClassFileWriter writer) {
+    writer.method("<init>", "()V")
+      .loadReference(0)
+      .invokeSpecial(OBJECT, "<init>", "()V")
+      .returnValue(void.class);
+  }
+
+  /**
+   * Loads all elements from an object array in the given slot onto the stack, unboxing or casting each element to the
+   * corresponding given parameter type.
+   *
+   * @param writer     the writer of the method to emit the code to.
+   * @param paramTypes the types of the parameters to load.
+   * @param arraySlot  the local variable slot of the argument array.
+   */
+  private static void loadArguments(@NonNull MethodWriter writer, @NonNull Class<?>[] paramTypes, int arraySlot) {
+    for (int i = 0; i < paramTypes.length; i++) {
+      writer.loadReference(arraySlot).pushInt(i).loadArrayElement();
+      unboxOrCast(writer, paramTypes[i]);
+    }
+  }
+
+  /**
+   * Boxes the value on top of the stack if the given type is primitive.
+   *
+   * @param writer the writer of the method to emit the code to.
+   * @param type   the type of the value on top of the stack.
+   */
+  static void box(@NonNull MethodWriter writer, @NonNull Class<?> type) {
+    if (type.isPrimitive()) {
+      Class<?> wrapper = wrapperType(type);
+      writer.invokeStatic(internalName(wrapper), "valueOf", methodDescriptor(wrapper, type), false);
+    }
+  }
+
+  /**
+   * Unboxes the reference on top of the stack if the given type is primitive, casts it to the given type otherwise.
+   * Primitives are only unboxed from their exact wrapper type, callers must convert other values (for example by
+   * widening) before passing them to the generated code.
+   *
+   * @param writer the writer of the method to emit the code to.
+   * @param type   the type the reference on top of the stack should be converted to.
+   */
+  static void unboxOrCast(@NonNull MethodWriter writer, @NonNull Class<?> type) {
+    if (type.isPrimitive()) {
+      Class<?> wrapper = wrapperType(type);
+      writer.checkCast(wrapper).invokeVirtual(internalName(wrapper), type.getName() + "Value", "()" + descriptor(type));
+    } else if (type != Object.class) {
+      writer.checkCast(type);
+    }
+  }
+
+  /**
+   * Get the wrapper type of the given primitive type.
+   *
+   * @param primitive the primitive type to get the wrapper of.
+   * @return the wrapper type of the given primitive type.
+   */
+  static @NonNull Class<?> wrapperType(@NonNull Class<?> primitive) {
+    if (primitive == int.class) {
+      return Integer.class;
+    } else if (primitive == long.class) {
+      return Long.class;
+    } else if (primitive == double.class) {
+      return Double.class;
+    } else if (primitive == float.class) {
+      return Float.class;
+    } else if (primitive == boolean.class) {
+      return Boolean.class;
+    } else if (primitive == byte.class) {
+      return Byte.class;
+    } else if (primitive == char.class) {
+      return Character.class;
+    } else {
+      return Short.class;
+    }
+  }
+
+  /**
+   * Checks if the given class can host a generated accessor class. Array types, primitives and classes which are
+   * hidden or anonymous themselves (which have a slash in their name) cannot be used as hosts.
+   *
+   * @param host the class to check.
+   * @return true if the given class can host an accessor class, false otherwise.
+   */
+  private static boolean canHost(@NonNull Class<?> host) {
+    return !host.isArray() && !host.isPrimitive() && host.getName().indexOf('/') == -1;
+  }
+
+  /**
+   * Checks if the given type can be resolved and accessed from code within the given host class.
+   *
+   * @param host the class from which the type gets accessed.
+   * @param type the type to check.
+   * @return true if the given type is accessible from the host class, false otherwise.
+   */
+  private static boolean isAccessibleFrom(@NonNull Class<?> host, @NonNull Class<?> type) {
+    while (type.isArray()) {
+      type = type.getComponentType();
+    }
+
+    // primitives and objects need no checking
+    if (type.isPrimitive() || type == Object.class) {
+      return true;
+    }
+
+    // types in the same runtime package are always accessible
+    if (type.getClassLoader() == host.getClassLoader() && packageName(type).equals(packageName(host))) {
+      return true;
+    }
+
+    // other types need to be public (including all enclosing classes)
+    for (Class<?> current = type; current != null; current = current.getEnclosingClass()) {
+      if (!Modifier.isPublic(current.getModifiers())) {
+        return false;
+      }
+    }
+
+    // jdk types are only known to be accessible when in an exported java package
+    ClassLoader typeLoader = type.getClassLoader();
+    if (typeLoader == null || typeLoader == ClassLoader.getSystemClassLoader().getParent()) {
+      return type.getName().startsWith("java.");
+    }
+
+    // the type must be resolvable by its name from the host class
+    try {
+      return Class.forName(type.getName(), false, host.getClassLoader()) == type;
+    } catch (ClassNotFoundException | LinkageError exception) {
+      return false;
+    }
+  }
+
+  /**
+   * Get the package name of the given class.
+   *
+   * @param type the class to get the package name of.
+   * @return the package name of the given class, an empty string for the default package.
+   */
+  private static @NonNull String packageName(@NonNull Class<?> type) {
+    String name = type.getName();
+    int lastDot = name.lastIndexOf('.');
+    return lastDot == -1 ? "" : name.substring(0, lastDot);
+  }
+}
@@ -0,0 +1,1234 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.bytecode;
+
+import dev.derklaro.reflexion.AccessorFactory;
+import dev.derklaro.reflexion.FieldAccessor;
+import dev.derklaro.reflexion.MethodAccessor;
+import dev.derklaro.reflexion.Reflexion;
+import dev.derklaro.reflexion.ReflexionException;
+import dev.derklaro.reflexion.Result;
+import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.JniAccessorFactory;
+import dev.derklaro.reflexion.internal.util.Stats;
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.invoke.MethodHandle;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Executable;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import java.util.function.BiConsumer;
+import java.util.function.BiFunction;
+import java.util.function.Function;
+import java.util.function.ObjDoubleConsumer;
+import java.util.function.ObjIntConsumer;
+import java.util.function.ObjLongConsumer;
+import java.util.function.ToDoubleFunction;
+import java.util.function.ToIntFunction;
+import java.util.function.ToLongFunction;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * A reflexion accessor factory which generates a small class for each wrapped member that accesses the member
+ * directly using the matching bytecode instruction. The generated classes are defined as hidden nestmates (java 15+)
+ * or anonymous classes (java 8 - 16) of the class declaring the member, which allows the jit to inline the access like
+ * a normal call. Members which cannot be accessed from generated code fall back to method handles.
+ * <p>
+ * When available this factory is preferred over all other default factories. Factories which are provided as a
+ * service and have no preference against this factory still take precedence, as they did over the default factories
+ * before 1.4. A factory can also be used for specific classes by passing it to {@code Reflexion.on} explicitly.
+ *
+ * @since 1.4
+ */
+public final class BytecodeAccessorFactory extends MethodHandleAccessorFactory {
+
+  private static final Object[] NO_ARGS = new Object[0];
+
+  private final boolean available;
+
+  /**
+   * Constructs a new bytecode accessor factory instance.
+   */
+  public BytecodeAccessorFactory() {
+    // the trusted lookup is needed to define classes and for the fallback
+    this.available = super.isAvailable() && ClassDefiner.isAvailable() && this.selfTest();
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public boolean isAvailable() {
+    return this.available;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  @SuppressWarnings("unchecked")
+  public @NonNull FieldAccessor wrapField(@NonNull Reflexion reflexion, @NonNull Field field) {
+    if (this.available && AccessorGenerator.canGenerate(field)) {
+      try {
+        int modifiers = field.getModifiers();
+        boolean finalField = Modifier.isFinal(modifiers);
+
+        // final fields can only be written from <init> or <clinit>, use a method handle for them instead
+        Object accessor = this.defineAccessor(field.getDeclaringClass(), field, !finalField);
+        BiConsumer<Object, Object> setter = finalField
+          ? this.fallbackSetter(field, Modifier.isStatic(modifiers))
+          : (BiConsumer<Object, Object>) accessor;
+
+        return new BytecodeFieldAccessor(field, reflexion, this, accessor, setter);
+      } catch (LinkageError | ReflectiveOperationException exception) {
+        // the generated class was rejected by the jvm, fall back to method handles
+        recordFallback();
+      } catch (RuntimeException | Error exception) {
+        throw exception;
+      } catch (Throwable throwable) {
+        throw new ReflexionException(throwable);
+      }
+    }
+
+    return super.wrapField(reflexion, field);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  @SuppressWarnings("unchecked")
+  public @NonNull MethodAccessor<Method> wrapMethod(@NonNull Reflexion reflexion, @NonNull Method method) {
+    if (this.available && AccessorGenerator.canGenerate(method)) {
+      try {
+        Object accessor = this.defineAccessor(method.getDeclaringClass(), method, false);
+        return new BytecodeMethodAccessor(method, reflexion, this, (BiFunction<Object, Object[], Object>) accessor);
+      } catch (LinkageError | ReflectiveOperationException exception) {
+        // the generated class was rejected by the jvm, fall back to method handles
+        recordFallback();
+      } catch (RuntimeException | Error exception) {
+        throw exception;
+      } catch (Throwable throwable) {
+        throw new ReflexionException(throwable);
+      }
+    }
+
+    return super.wrapMethod(reflexion, method);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  @SuppressWarnings("unchecked")
+  public @NonNull MethodAccessor<Constructor<?>> wrapConstructor(@NonNull Reflexion rfx, @NonNull Constructor<?> ctr) {
+    if (this.available && AccessorGenerator.canGenerate(ctr)) {
+      try {
+        Object accessor = this.defineAccessor(ctr.getDeclaringClass(), ctr, false);
+        return new BytecodeConstructorAccessor(ctr, rfx, this, (Function<Object[], Object>) accessor);
+      } catch (LinkageError | ReflectiveOperationException exception) {
+        // the generated class was rejected by the jvm, fall back to method handles
+        recordFallback();
+      } catch (RuntimeException | Error exception) {
+        throw exception;
+      } catch (Throwable throwable) {
+        throw new ReflexionException(throwable);
+      }
+    }
+
+    return super.wrapConstructor(rfx, ctr);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public int compareTo(@NonNull AccessorFactory o) {
+    // no preference between two instances of this factory
+    if (o instanceof BytecodeAccessorFactory) {
+      return 0;
+    }
+
+    // prefer this one over the default factories if available
+    if (o instanceof MethodHandleAccessorFactory
+      || o instanceof BareAccessorFactory
+      || o instanceof JniAccessorFactory) {
+      return this.available ? -1 : 1;
+    }
+
+    // no opinion, service factories are sorted first and win the tie
+    return 0;
+  }
+
+  /**
+   * Records that an accessor could not be generated and that the member is wrapped using method handles instead.
+   */
+  private static void recordFallback() {
+    if (Stats.ENABLED) {
+      Stats.generationFallback();
+    }
+  }
+
+  /**
+   * Wraps the given field using method handles, bypassing the accessor generation.
+   *
+   * @param reflexion the reflexion instance which requested the accessor.
+   * @param field     the field to wrap.
+   * @return a method handle based accessor for the given field.
+   */
+  private @NonNull FieldAccessor wrapFallbackField(@NonNull Reflexion reflexion, @NonNull Field field) {
+    return super.wrapField(reflexion, field);
+  }
+
+  /**
+   * Wraps the given method using method handles, bypassing the accessor generation.
+   *
+   * @param reflexion the reflexion instance which requested the accessor.
+   * @param method    the method to wrap.
+   * @return a method handle based accessor for the given method.
+   */
+  private @NonNull MethodAccessor<Method> wrapFallbackMethod(@NonNull Reflexion reflexion, @NonNull Method method) {
+    return super.wrapMethod(reflexion, method);
+  }
+
+  /**
+   * Wraps the given constructor using method handles, bypassing the accessor generation.
+   *
+   * @param reflexion   the reflexion instance which requested the accessor.
+   * @param constructor the constructor to wrap.
+   * @return a method handle based accessor for the given constructor.
+   */
+  private @NonNull MethodAccessor<Constructor<?>> wrapFallbackConstructor(
+    @NonNull Reflexion reflexion,
+    @NonNull Constructor<?> constructor
+  ) {
+    return super.wrapConstructor(reflexion, constructor);
+  }
+
+  /**
+   * Get the wrapper types of the given parameter types, the generated accessors only unbox arguments of exactly that
+   * type. The wrapper of reference parameter types is null.
+   *
+   * @param parameterTypes the parameter types to get the wrappers of.
+   * @return the wrapper type of each parameter, null if no parameter is primitive.
+   */
+  private static Class<?> @Nullable [] parameterWrappers(@NonNull Class<?>[] parameterTypes) {
+    Class<?>[] wrappers = null;
+    for (int i = 0; i < parameterTypes.length; i++) {
+      if (parameterTypes[i].isPrimitive()) {
+        if (wrappers == null) {
+          wrappers = new Class<?>[parameterTypes.length];
+        }
+        wrappers[i] = AccessorGenerator.wrapperType(parameterTypes[i]);
+      }
+    }
+    return wrappers;
+  }
+
+  /**
+   * Checks if the given arguments need a conversion before they can be passed to a generated accessor, which is the
+   * case if a primitive argument is not given as an instance of its exact wrapper type (for example an integer passed
+   * to a long parameter, or null).
+   *
+   * @param wrappers the wrapper types of the parameters, null if no parameter is primitive.
+   * @param args     the arguments to check, must have the same length as the wrappers.
+   * @return true if at least one of the given arguments must be converted, false otherwise.
+   */
+  private static boolean needsConversion(Class<?> @Nullable [] wrappers, @NonNull Object[] args) {
+    if (wrappers != null) {
+      for (int i = 0; i < wrappers.length; i++) {
+        Class<?> wrapper = wrappers[i];
+        if (wrapper != null && (args[i] == null || args[i].getClass() != wrapper)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Checks if the given argument array has the given length, the generated accessors do not check the length.
+   *
+   * @param expected the amount of parameters of the invoked executable.
+   * @param args     the arguments to check.
+   * @throws IllegalArgumentException if the amount of given arguments does not match, like a method handle spreader.
+   */
+  private static void checkArgumentCount(int expected, @NonNull Object[] args) {
+    if (args.length != expected) {
+      throw new IllegalArgumentException("Wrong number of arguments: expected " + expected + ", got " + args.length);
+    }
+  }
+
+  /**
+   * Creates a method handle for the given method or constructor which takes the instance and all arguments without
+   * spreading them from an array.
+   *
+   * @param executable the method or constructor to create the handle for.
+   * @return a fixed arity handle for the given executable.
+   * @throws ReflexionException if the executable cannot be unreflected.
+   * @see #convertToFixedArity(MethodHandle, boolean, boolean)
+   */
+  private @NonNull MethodHandle fixedArityHandle(@NonNull Executable executable) {
+    boolean ctor = executable instanceof Constructor<?>;
+    boolean staticMethod = !ctor && Modifier.isStatic(executable.getModifiers());
+    return this.convertToFixedArity(this.exactHandle(executable), staticMethod, ctor);
+  }
+
+  /**
+   * Unreflects the given method or constructor using the trusted lookup, keeping the exact type of the executable.
+   *
+   * @param executable the method or constructor to unreflect.
+   * @return a method handle for the given executable with its exact original type.
+   * @throws ReflexionException if the executable cannot be unreflected.
+   */
+  private @NonNull MethodHandle exactHandle(@NonNull Executable executable) {
+    try {
+      if (executable instanceof Constructor<?>) {
+        return this.trustedLookup.unreflectConstructor((Constructor<?>) executable);
+      } else {
+        return this.trustedLookup.unreflect((Method) executable);
+      }
+    } catch (IllegalAccessException exception) {
+      throw new ReflexionException(exception);
+    }
+  }
+
+  /**
+   * Generates and defines an accessor class for the given member and constructs a new instance of it.
+   *
+   * @param host       the class declaring the member.
+   * @param member     the field, method or constructor to generate the accessor for.
+   * @param withSetter if a setter should be generated, only used for fields.
+   * @return a new instance of the generated accessor class.
+   * @throws Throwable if the class cannot be generated or defined.
+   */
+  private @NonNull Object defineAccessor(@NonNull Class<?> host, @NonNull Object member, boolean withSetter)
+    throws Throwable {
+    byte[] bytes;
+    if (member instanceof Field) {
+      bytes = AccessorGenerator.generateFieldAccessor((Field) member, withSetter);
+    } else if (member instanceof Method) {
+      bytes = AccessorGenerator.generateMethodAccessor((Method) member);
+    } else {
+      bytes = AccessorGenerator.generateConstructorAccessor((Constructor<?>) member);
+    }
+
+    return ClassDefiner.defineAndConstruct(this.trustedLookup, host, bytes);
+  }
+
+  /**
+   * Creates a setter for the given (final) field which is based on a method handle.
+   *
+   * @param field       the field to create the setter for.
+   * @param staticField if the given field is static.
+   * @return a setter for the given field taking the instance (ignored for static fields) and the new value.
+   * @throws Exception if the field setter cannot be unreflected.
+   */
+  private @NonNull BiConsumer<Object, Object> fallbackSetter(@NonNull Field field, boolean staticField)
+    throws Exception {
+    MethodHandle setter = this.convertFieldToGeneric(field, staticField, true);
+    return (instance, value) -> {
+      try {
+        if (staticField) {
+          setter.invoke(value);
+        } else {
+          setter.invoke(instance, value);
+        }
+      } catch (Throwable throwable) {
+        Util.throwUnchecked(throwable);
+      }
+    };
+  }
+
+  /**
+   * Checks if accessors can be generated and defined in the current environment by wrapping the members of a probe
+   * class and checking the results.
+   *
+   * @return true if generated accessors are working in the current jvm, false otherwise.
+   */
+  @SuppressWarnings("unchecked")
+  private boolean selfTest() {
+    try {
+      Constructor<Probe> ctor = Probe.class.getDeclaredConstructor(int.class);
+      Field field = Probe.class.getDeclaredField("value");
+      Method method = Probe.class.getDeclaredMethod("sum", int.class);
+
+      Function<Object[], Object> ctorAccessor = (Function<Object[], Object>) this.defineAccessor(
+        Probe.class, ctor, false);
+      Object fieldAccessor = this.defineAccessor(Probe.class, field, true);
+      BiFunction<Object, Object[], Object> methodAccessor = (BiFunction<Object, Object[], Object>) this.defineAccessor(
+        Probe.class, method, false);
+
+      // construct, write, read & invoke
+      Object probe = ctorAccessor.apply(new Object[]{5});
+      ((BiConsumer<Object, Object>) fieldAccessor).accept(probe, 7);
+
+      Object value = ((Function<Object, Object>) fieldAccessor).apply(probe);
+      Object sum = methodAccessor.apply(probe, new Object[]{3});
+      return Integer.valueOf(7).equals(value) && Long.valueOf(10).equals(sum);
+    } catch (Throwable throwable) {
+      return false;
+    }
+  }
+
+  /**
+   * A class which is used to check if the accessor generation is working.
+   *
+   * @since 1.4
+   */
+  private static final class Probe {
+
+    private int value;
+
+    /**
+     * Constructs a new probe instance.
+     *
+     * @param value the initial value of the probe.
+     */
+    private Probe(int value) {
+      this.value = value;
+    }
+
+    /**
+     * Sums the value of this probe and the given value.
+     *
+     * @param other the value to add.
+     * @return the sum of the value of this probe and the given value.
+     */
+    private long sum(int other) {
+      return (long) this.value + other;
+    }
+  }
+
+  /**
+   * A field accessor which uses a generated class to get and set the field value. Primitive access to fields which
+   * have no primitive specialization in the generated class, and values which are not given as the exact wrapper of a
+   * primitive field type (and therefore need a widening conversion), are delegated to a method handle based accessor,
+   * which is created lazily on first use.
+   *
+   * @since 1.4
+   */
+  private static final class BytecodeFieldAccessor implements FieldAccessor {
+
+    private final Field field;
+    private final Reflexion reflexion;
+    private final boolean staticField;
+    private final @Nullable Class<?> wrapper;
+    private final BytecodeAccessorFactory factory;
+
+    private final Function<Object, Object> getter;
+    private final BiConsumer<Object, Object> setter;
+
+    private final @Nullable ToIntFunction<Object> intGetter;
+    private final @Nullable ObjIntConsumer<Object> intSetter;
+    private final @Nullable ToLongFunction<Object> longGetter;
+    private final @Nullable ObjLongConsumer<Object> longSetter;
+    private final @Nullable ToDoubleFunction<Object> doubleGetter;
+    private final @Nullable ObjDoubleConsumer<Object> doubleSetter;
+
+    private volatile FieldAccessor fallback;
+
+    /**
+     * Constructs a new bytecode field accessor instance.
+     *
+     * @param field     the field which is wrapped by the new accessor.
+     * @param reflexion the reflexion instance which produced the reflection lookup.
+     * @param factory   the factory which created the accessor, used to create the fallback accessor.
+     * @param accessor  the instance of the generated accessor class, also implementing the getter of the field.
+     * @param setter    the setter of the given field, taking the instance and new value.
+     */
+    @SuppressWarnings("unchecked")
+    public BytecodeFieldAccessor(
+      Field field,
+      Reflexion reflexion,
+      BytecodeAccessorFactory factory,
+      Object accessor,
+      BiConsumer<Object, Object> setter
+    ) {
+      this.field = field;
+      this.reflexion = reflexion;
+      this.staticField = Modifier.isStatic(field.getModifiers());
+      this.wrapper = field.getType().isPrimitive() ? AccessorGenerator.wrapperType(field.getType()) : null;
+      this.factory = factory;
+      this.getter = (Function<Object, Object>) accessor;
+      this.setter = setter;
+
+      // the primitive specializations are only implemented if the field has the exact type
+      this.intGetter = accessor instanceof ToIntFunction ? (ToIntFunction<Object>) accessor : null;
+      this.intSetter = accessor instanceof ObjIntConsumer ? (ObjIntConsumer<Object>) accessor : null;
+      this.longGetter = accessor instanceof ToLongFunction ? (ToLongFunction<Object>) accessor : null;
+      this.longSetter = accessor instanceof ObjLongConsumer ? (ObjLongConsumer<Object>) accessor : null;
+      this.doubleGetter = accessor instanceof ToDoubleFunction ? (ToDoubleFunction<Object>) accessor : null;
+      this.doubleSetter = accessor instanceof ObjDoubleConsumer ? (ObjDoubleConsumer<Object>) accessor : null;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Field getMember() {
+      return this.field;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Reflexion getReflexion() {
+      return this.reflexion;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <T> Result<T> getValue() {
+      return this.getValue(this.staticField ? null : this.reflexion.getBinding());
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <T> Result<T> getValue(@Nullable Object instance) {
+      return Result.tryExecute(() -> this.getValueDirect(instance));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Result<Void> setValue(@Nullable Object value) {
+      return this.setValue(this.staticField ? null : this.reflexion.getBinding(), value);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Result<Void> setValue(@Nullable Object instance, @Nullable Object value) {
+      return Result.tryExecute(() -> {
+        this.setValueDirect(instance, value);
+        return null;
+      });
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <T> T getValueDirect(@Nullable Object instance) {
+      return (T) this.getter.apply(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setValueDirect(@Nullable Object instance, @Nullable Object value) {
+      Class<?> wrapper = this.wrapper;
+      if (wrapper != null && (value == null || value.getClass() != wrapper)) {
+        // the generated setter only unboxes the exact wrapper type, let the fallback widen the value (or fail)
+        this.fallback().setValueDirect(instance, value);
+      } else {
+        this.setter.accept(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int getInt(@Nullable Object instance) {
+      ToIntFunction<Object> getter = this.intGetter;
+      return getter != null ? getter.applyAsInt(instance) : this.fallback().getInt(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setInt(@Nullable Object instance, int value) {
+      ObjIntConsumer<Object> setter = this.intSetter;
+      if (setter != null) {
+        setter.accept(instance, value);
+      } else {
+        this.fallback().setInt(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public long getLong(@Nullable Object instance) {
+      ToLongFunction<Object> getter = this.longGetter;
+      return getter != null ? getter.applyAsLong(instance) : this.fallback().getLong(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setLong(@Nullable Object instance, long value) {
+      ObjLongConsumer<Object> setter = this.longSetter;
+      if (setter != null) {
+        setter.accept(instance, value);
+      } else {
+        this.fallback().setLong(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public double getDouble(@Nullable Object instance) {
+      ToDoubleFunction<Object> getter = this.doubleGetter;
+      return getter != null ? getter.applyAsDouble(instance) : this.fallback().getDouble(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setDouble(@Nullable Object instance, double value) {
+      ObjDoubleConsumer<Object> setter = this.doubleSetter;
+      if (setter != null) {
+        setter.accept(instance, value);
+      } else {
+        this.fallback().setDouble(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public float getFloat(@Nullable Object instance) {
+      return this.fallback().getFloat(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setFloat(@Nullable Object instance, float value) {
+      this.fallback().setFloat(instance, value);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean getBoolean(@Nullable Object instance) {
+      return this.fallback().getBoolean(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setBoolean(@Nullable Object instance, boolean value) {
+      this.fallback().setBoolean(instance, value);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public byte getByte(@Nullable Object instance) {
+      return this.fallback().getByte(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setByte(@Nullable Object instance, byte value) {
+      this.fallback().setByte(instance, value);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public short getShort(@Nullable Object instance) {
+      return this.fallback().getShort(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setShort(@Nullable Object instance, short value) {
+      this.fallback().setShort(instance, value);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public char getChar(@Nullable Object instance) {
+      return this.fallback().getChar(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setChar(@Nullable Object instance, char value) {
+      this.fallback().setChar(instance, value);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle getterHandle() {
+      return this.fallback().getterHandle();
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle setterHandle() {
+      return this.fallback().setterHandle();
+    }
+
+    /**
+     * Get the method handle based accessor for the field of this accessor, creating it if needed.
+     *
+     * @return the method handle based accessor for the field.
+     */
+    private @NonNull FieldAccessor fallback() {
+      FieldAccessor fallback = this.fallback;
+      if (fallback == null) {
+        // racy, but creating the accessor twice is harmless
+        this.fallback = fallback = this.factory.wrapFallbackField(this.reflexion, this.field);
+      }
+      return fallback;
+    }
+  }
+
+  /**
+   * A method accessor which uses a generated class to invoke the method. Invocations with primitive arguments which are
+   * not given as their exact wrapper type are delegated to a method handle based accessor, which is created lazily on
+   * first use.
+   *
+   * @since 1.4
+   */
+  private static final class BytecodeMethodAccessor implements MethodAccessor<Method> {
+
+    private final Method method;
+    private final Reflexion reflexion;
+    private final boolean staticMethod;
+    private final int parameterCount;
+    private final Class<?> @Nullable [] parameterWrappers;
+    private final BytecodeAccessorFactory factory;
+    private final BiFunction<Object, Object[], Object> invoker;
+
+    private volatile MethodHandle fixedArityHandle;
+    private volatile MethodAccessor<Method> fallback;
+
+    /**
+     * Constructs a new bytecode method accessor instance.
+     *
+     * @param method    the method which is wrapped by this accessor.
+     * @param reflexion the reflexion instance which produced the lookup call.
+     * @param factory   the factory which created the accessor, used to create the fixed arity handle.
+     * @param invoker   the invoker of the method, taking the instance and arguments.
+     */
+    public BytecodeMethodAccessor(
+      Method method,
+      Reflexion reflexion,
+      BytecodeAccessorFactory factory,
+      BiFunction<Object, Object[], Object> invoker
+    ) {
+      this.method = method;
+      this.reflexion = reflexion;
+      this.staticMethod = Modifier.isStatic(method.getModifiers());
+      this.parameterCount = method.getParameterCount();
+      this.parameterWrappers = parameterWrappers(method.getParameterTypes());
+      this.factory = factory;
+      this.invoker = invoker;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Method getMember() {
+      return this.method;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Reflexion getReflexion() {
+      return this.reflexion;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke() {
+      return this.invoke(this.staticMethod ? null : this.reflexion.getBinding());
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke(@Nullable Object instance) {
+      return this.invoke(instance, NO_ARGS);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invokeWithArgs(@NonNull Object... args) {
+      return this.invoke(this.staticMethod ? null : this.reflexion.getBinding(), args);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke(@Nullable Object instance, @NonNull Object... args) {
+      return Result.tryExecute(() -> this.invokeDirect(instance, args));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public <V> V invokeDirect(@Nullable Object instance) {
+      return this.invokeDirect(instance, NO_ARGS);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
+      checkArgumentCount(this.parameterCount, args);
+      if (needsConversion(this.parameterWrappers, args)) {
+        return this.fallback().invokeDirect(instance, args);
+      }
+      return (V) this.invoker.apply(instance, args);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke0(@Nullable Object instance) {
+      // the generated accessor can be invoked without allocating an argument array
+      checkArgumentCount(this.parameterCount, NO_ARGS);
+      return (V) this.invoker.apply(instance, NO_ARGS);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke1(@Nullable Object instance, @Nullable Object arg1) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke2(@Nullable Object instance, @Nullable Object arg1, @Nullable Object arg2) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1, arg2);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke3(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3
+    ) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1, arg2, arg3);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke4(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3,
+      @Nullable Object arg4
+    ) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1, arg2, arg3, arg4);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke5(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3,
+      @Nullable Object arg4,
+      @Nullable Object arg5
+    ) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1, arg2, arg3, arg4, arg5);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle asMethodHandle() {
+      return this.factory.exactHandle(this.method);
+    }
+
+    /**
+     * Get the fixed arity method handle for the method of this accessor, creating it if needed.
+     *
+     * @return the fixed arity method handle for the method.
+     */
+    private @NonNull MethodHandle fixedArity() {
+      MethodHandle handle = this.fixedArityHandle;
+      if (handle == null) {
+        // racy, but creating the handle twice is harmless
+        this.fixedArityHandle = handle = this.factory.fixedArityHandle(this.method);
+      }
+      return handle;
+    }
+
+    /**
+     * Get the method handle based accessor for the method of this accessor, creating it if needed.
+     *
+     * @return the method handle based accessor for the method.
+     */
+    private @NonNull MethodAccessor<Method> fallback() {
+      MethodAccessor<Method> fallback = this.fallback;
+      if (fallback == null) {
+        // racy, but creating the accessor twice is harmless
+        this.fallback = fallback = this.factory.wrapFallbackMethod(this.reflexion, this.method);
+      }
+      return fallback;
+    }
+  }
+
+  /**
+   * A constructor accessor which uses a generated class to construct new instances. Invocations with primitive
+   * arguments which are not given as their exact wrapper type are delegated to a method handle based accessor, which
+   * is created lazily on first use.
+   *
+   * @since 1.4
+   */
+  private static final class BytecodeConstructorAccessor implements MethodAccessor<Constructor<?>> {
+
+    private final Constructor<?> constructor;
+    private final Reflexion reflexion;
+    private final int parameterCount;
+    private final Class<?> @Nullable [] parameterWrappers;
+    private final BytecodeAccessorFactory factory;
+    private final Function<Object[], Object> invoker;
+
+    private volatile MethodHandle fixedArityHandle;
+    private volatile MethodAccessor<Constructor<?>> fallback;
+
+    /**
+     * Constructs a new bytecode constructor accessor instance.
+     *
+     * @param constructor the constructor which is wrapped by the accessor.
+     * @param reflexion   the reflexion instance which produced the reflection lookup call.
+     * @param factory     the factory which created the accessor, used to create the fixed arity handle.
+     * @param invoker     the invoker of the constructor, taking the arguments.
+     */
+    public BytecodeConstructorAccessor(
+      Constructor<?> constructor,
+      Reflexion reflexion,
+      BytecodeAccessorFactory factory,
+      Function<Object[], Object> invoker
+    ) {
+      this.constructor = constructor;
+      this.reflexion = reflexion;
+      this.parameterCount = constructor.getParameterCount();
+      this.parameterWrappers = parameterWrappers(constructor.getParameterTypes());
+      this.factory = factory;
+      this.invoker = invoker;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Constructor<?> getMember() {
+      return this.constructor;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Reflexion getReflexion() {
+      return this.reflexion;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke() {
+      return this.invoke(null, NO_ARGS);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke(@Nullable Object instance) {
+      return this.invoke(null, NO_ARGS);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invokeWithArgs(@NonNull Object... args) {
+      return this.invoke(null, args);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke(@Nullable Object instance, @NonNull Object... args) {
+      return Result.tryExecute(() -> this.invokeDirect(instance, args));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public <V> V invokeDirect(@Nullable Object instance) {
+      return this.invokeDirect(null, NO_ARGS);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
+      checkArgumentCount(this.parameterCount, args);
+      if (needsConversion(this.parameterWrappers, args)) {
+        return this.fallback().invokeDirect(null, args);
+      }
+      return (V) this.invoker.apply(args);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke0(@Nullable Object instance) {
+      // the generated accessor can be invoked without allocating an argument array
+      checkArgumentCount(this.parameterCount, NO_ARGS);
+      return (V) this.invoker.apply(NO_ARGS);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke1(@Nullable Object instance, @Nullable Object arg1) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke2(@Nullable Object instance, @Nullable Object arg1, @Nullable Object arg2) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1, arg2);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke3(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3
+    ) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1, arg2, arg3);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke4(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3,
+      @Nullable Object arg4
+    ) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1, arg2, arg3, arg4);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke5(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3,
+      @Nullable Object arg4,
+      @Nullable Object arg5
+    ) {
+      try {
+        Object result = this.fixedArity().invokeExact(instance, arg1, arg2, arg3, arg4, arg5);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle asMethodHandle() {
+      return this.factory.exactHandle(this.constructor);
+    }
+
+    /**
+     * Get the fixed arity method handle for the constructor of this accessor, creating it if needed.
+     *
+     * @return the fixed arity method handle for the constructor.
+     */
+    private @NonNull MethodHandle fixedArity() {
+      MethodHandle handle = this.fixedArityHandle;
+      if (handle == null) {
+        // racy, but creating the handle twice is harmless
+        this.fixedArityHandle = handle = this.factory.fixedArityHandle(this.constructor);
+      }
+      return handle;
+    }
+
+    /**
+     * Get the method handle based accessor for the constructor of this accessor, creating it if needed.
+     *
+     * @return the method handle based accessor for the constructor.
+     */
+    private @NonNull MethodAccessor<Constructor<?>> fallback() {
+      MethodAccessor<Constructor<?>> fallback = this.fallback;
+      if (fallback == null) {
+        // racy, but creating the accessor twice is harmless
+        this.fallback = fallback = this.factory.wrapFallbackConstructor(this.reflexion, this.constructor);
+      }
+      return fallback;
+    }
+  }
+}
@@ -0,0 +1,154 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.bytecode;
+
+import java.lang.invoke.MethodHandles.Lookup;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Array;
+import java.lang.reflect.Field;
+import java.lang.reflect.InvocationTargetException;
+import java.lang.reflect.Method;
+import lombok.NonNull;
+
+/**
+ * Internal: defines generated accessor classes as in the context of the class declaring the accessed member. On java
+ * 15 and later hidden classes are used ({@code Lookup.defineHiddenClass}) which are defined as nestmates of the host
+ * class. On older versions {@code sun.misc.Unsafe.defineAnonymousClass} is used instead.
+ *
+ * @since 1.4
+ */
+final class ClassDefiner {
+
+  // java 15+: Lookup.defineHiddenClass(byte[], boolean, ClassOption...)
+  private static final Method DEFINE_HIDDEN_CLASS;
+  private static final Object HIDDEN_CLASS_OPTIONS;
+
+  // java 8 - 16: Unsafe.defineAnonymousClass(Class, byte[], Object[])
+  private static final Object UNSAFE;
+  private static final Method DEFINE_ANONYMOUS_CLASS;
+
+  static {
+    Method defineHiddenClass = null;
+    Object hiddenClassOptions = null;
+    try {
+      // resolve the nestmate option to allow private access to the members of the host
+      @SuppressWarnings({"unchecked", "rawtypes"})
+      Class<Enum> optionClass = (Class<Enum>) Class.forName("java.lang.invoke.MethodHandles$Lookup$ClassOption");
+      hiddenClassOptions = Array.newInstance(optionClass, 1);
+      Array.set(hiddenClassOptions, 0, Enum.valueOf(optionClass, "NESTMATE"));
+
+      defineHiddenClass = Lookup.class.getMethod(
+        "defineHiddenClass",
+        byte[].class, boolean.class, hiddenClassOptions.getClass());
+    } catch (Throwable ignored) {
+      // not available on this jvm
+    }
+
+    Object unsafe = null;
+    Method defineAnonymousClass = null;
+    if (defineHiddenClass == null) {
+      try {
+        Class<?> unsafeClass = Class.forName("sun.misc.Unsafe");
+
+        Field theUnsafeField = unsafeClass.getDeclaredField("theUnsafe");
+        theUnsafeField.setAccessible(true);
+
+        unsafe = theUnsafeField.get(null);
+        defineAnonymousClass = unsafeClass.getMethod("defineAnonymousClass", Class.class, byte[].class, Object[].class);
+      } catch (Throwable ignored) {
+        // not available on this jvm
+      }
+    }
+
+    DEFINE_HIDDEN_CLASS = defineHiddenClass;
+    HIDDEN_CLASS_OPTIONS = hiddenClassOptions;
+    UNSAFE = unsafe;
+    DEFINE_ANONYMOUS_CLASS = defineAnonymousClass;
+  }
+
+  private ClassDefiner() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Get if classes can be defined in the current jvm.
+   *
+   * @return true if classes can be defined, false otherwise.
+   */
+  public static boolean isAvailable() {
+    return DEFINE_HIDDEN_CLASS != null || DEFINE_ANONYMOUS_CLASS != null;
+  }
+
+  /**
+   * Defines the given class bytes in the context of the given host class and constructs a new instance of it using
+   * the public no-args constructor.
+   *
+   * @param trustedLookup the trusted lookup, used to get a full privileged lookup in the host class.
+   * @param host          the class in which context the class should be defined.
+   * @param bytes         the bytes of the class to define.
+   * @return a new instance of the defined class.
+   * @throws Throwable            if the class cannot be defined or instantiated.
+   * @throws NullPointerException if the given lookup, host or bytes are null.
+   */
+  public static @NonNull Object defineAndConstruct(
+    @NonNull Lookup trustedLookup,
+    @NonNull Class<?> host,
+    byte[] bytes
+  ) throws Throwable {
+    Class<?> definedClass = defineClass(trustedLookup, host, bytes);
+    return trustedLookup.findConstructor(definedClass, MethodType.methodType(void.class)).invoke();
+  }
+
+  /**
+   * Defines the given class bytes in the context of the given host class.
+   *
+   * @param trustedLookup the trusted lookup, used to get a full privileged lookup in the host class.
+   * @param host          the class in which context the class should be defined.
+   * @param bytes         the bytes of the class to define.
+   * @return the defined class.
+   * @throws Throwable if the class cannot be defined.
+   */
+  private static @NonNull Class<?> defineClass(
+    @NonNull Lookup trustedLookup,
+    @NonNull Class<?> host,
+    byte[] bytes
+  ) throws Throwable {
+    try {
+      if (DEFINE_HIDDEN_CLASS != null) {
+        Lookup hostLookup = trustedLookup.in(host);
+        Lookup definedLookup = (Lookup) DEFINE_HIDDEN_CLASS.invoke(hostLookup, bytes, true, HIDDEN_CLASS_OPTIONS);
+        return definedLookup.lookupClass();
+      } else if (DEFINE_ANONYMOUS_CLASS != null) {
+        return (Class<?>) DEFINE_ANONYMOUS_CLASS.invoke(UNSAFE, host, bytes, null);
+      } else {
+        throw new UnsupportedOperationException("Unable to define classes in the current jvm");
+      }
+    } catch (InvocationTargetException exception) {
+      // rethrow the actual exception thrown by the define method
+      Throwable cause = exception.getCause();
+      throw cause == null ? exception : cause;
+    }
+  }
+}
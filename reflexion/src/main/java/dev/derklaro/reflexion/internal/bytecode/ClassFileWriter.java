@@ -0,0 +1,820 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.bytecode;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import lombok.NonNull;
+
+/**
+ * Internal: a minimal writer for java class files, only supporting what is needed to emit the small accessor classes
+ * generated by this library. The written classes have no fields and only public methods without branches, therefore
+ * neither exception tables nor stack map frames are emitted.
+ *
+ * @since 1.4
+ */
+final class ClassFileWriter {
+
+  // java 8 class file version, allows a constant pool entry for interface method references to static methods
+  private static final int CLASS_FILE_VERSION = 52;
+
+  // access flags
+  private static final int ACC_PUBLIC = 0x0001;
+  private static final int ACC_FINAL = 0x0010;
+  private static final int ACC_SUPER = 0x0020;
+
+  // constant pool tags
+  private static final int CONSTANT_UTF8 = 1;
+  private static final int CONSTANT_CLASS = 7;
+  private static final int CONSTANT_FIELDREF = 9;
+  private static final int CONSTANT_METHODREF = 10;
+  private static final int CONSTANT_INTERFACE_METHODREF = 11;
+  private static final int CONSTANT_NAME_AND_TYPE = 12;
+
+  private final ByteVector constantPool = new ByteVector();
+  private final Map<String, Integer> constantIndexes = new HashMap<>();
+  private int constantCount = 1;
+
+  private final int thisClass;
+  private final int superClass;
+  private final int[] interfaces;
+  private final List<MethodWriter> methods = new ArrayList<>();
+
+  /**
+   * Constructs a new class file writer for a public final class.
+   *
+   * @param internalName the internal name of the class to write.
+   * @param superName    the internal name of the super class.
+   * @param interfaces   the internal names of the interfaces implemented by the class.
+   * @throws NullPointerException if the given name, super name or interface array is null.
+   */
+  public ClassFileWriter(@NonNull String internalName, @NonNull String superName, @NonNull String... interfaces) {
+    this.thisClass = this.classConstant(internalName);
+    this.superClass = this.classConstant(superName);
+    this.interfaces = new int[interfaces.length];
+    for (int i = 0; i < interfaces.length; i++) {
+      this.interfaces[i] = this.classConstant(interfaces[i]);
+    }
+  }
+
+  /**
+   * Get the internal name of the given class, as used in the constant pool.
+   *
+   * @param type the class to get the internal name of.
+   * @return the internal name of the given class.
+   * @throws NullPointerException if the given class is null.
+   */
+  public static @NonNull String internalName(@NonNull Class<?> type) {
+    return type.getName().replace('.', '/');
+  }
+
+  /**
+   * Get the type descriptor of the given class.
+   *
+   * @param type the class to get the descriptor of.
+   * @return the type descriptor of the given class.
+   * @throws NullPointerException if the given class is null.
+   */
+  public static @NonNull String descriptor(@NonNull Class<?> type) {
+    if (type.isPrimitive()) {
+      if (type == int.class) {
+        return "I";
+      } else if (type == long.class) {
+        return "J";
+      } else if (type == double.class) {
+        return "D";
+      } else if (type == float.class) {
+        return "F";
+      } else if (type == boolean.class) {
+        return "Z";
+      } else if (type == byte.class) {
+        return "B";
+      } else if (type == char.class) {
+        return "C";
+      } else if (type == short.class) {
+        return "S";
+      } else {
+        return "V";
+      }
+    }
+
+    // array names are already in descriptor format
+    String internalName = internalName(type);
+    return type.isArray() ? internalName : 'L' + internalName + ';';
+  }
+
+  /**
+   * Get the method descriptor of a method with the given return and parameter types.
+   *
+   * @param returnType the return type of the method.
+   * @param paramTypes the parameter types of the method.
+   * @return the method descriptor of the method.
+   * @throws NullPointerException if the given return type or parameter array is null.
+   */
+  public static @NonNull String methodDescriptor(@NonNull Class<?> returnType, @NonNull Class<?>... paramTypes) {
+    StringBuilder builder = new StringBuilder("(");
+    for (Class<?> paramType : paramTypes) {
+      builder.append(descriptor(paramType));
+    }
+    return builder.append(')').append(descriptor(returnType)).toString();
+  }
+
+  /**
+   * Adds a new public method to the class.
+   *
+   * @param name       the name of the method.
+   * @param descriptor the descriptor of the method.
+   * @return a writer for the code of the method.
+   * @throws NullPointerException if the given name or descriptor is null.
+   */
+  public @NonNull MethodWriter method(@NonNull String name, @NonNull String descriptor) {
+    MethodWriter writer = new MethodWriter(this, this.utf8Constant(name), descriptor);
+    this.methods.add(writer);
+    return writer;
+  }
+
+  /**
+   * Writes the class file.
+   *
+   * @return the bytes of the class file.
+   */
+  public byte[] toByteArray() {
+    int codeAttributeName = this.utf8Constant("Code");
+
+    ByteVector out = new ByteVector();
+    out.putInt(0xCAFEBABE).putShort(0).putShort(CLASS_FILE_VERSION);
+
+    // constant pool
+    out.putShort(this.constantCount).putBytes(this.constantPool);
+
+    // class info
+    out.putShort(ACC_PUBLIC | ACC_FINAL | ACC_SUPER).putShort(this.thisClass).putShort(this.superClass);
+    out.putShort(this.interfaces.length);
+    for (int anInterface : this.interfaces) {
+      out.putShort(anInterface);
+    }
+
+    // no fields
+    out.putShort(0);
+
+    // methods
+    out.putShort(this.methods.size());
+    for (MethodWriter method : this.methods) {
+      method.write(out, codeAttributeName);
+    }
+
+    // no class attributes
+    out.putShort(0);
+    return out.toByteArray();
+  }
+
+  /**
+   * Get or adds an utf8 constant to the constant pool.
+   *
+   * @param value the value of the constant.
+   * @return the index of the constant in the constant pool.
+   */
+  private int utf8Constant(@NonNull String value) {
+    String key = CONSTANT_UTF8 + value;
+    Integer known = this.constantIndexes.get(key);
+    if (known != null) {
+      return known;
+    }
+
+    // java identifiers can contain any unicode char, the class file format requires them in modified utf8
+    int length = 0;
+    for (int i = 0; i < value.length(); i++) {
+      char c = value.charAt(i);
+      length += c != 0 && c < 0x80 ? 1 : c < 0x800 ? 2 : 3;
+    }
+    if (length > 0xFFFF) {
+      throw new IllegalArgumentException("Constant " + value + " is too long for the constant pool");
+    }
+
+    this.constantPool.putByte(CONSTANT_UTF8).putShort(length);
+    for (int i = 0; i < value.length(); i++) {
+      char c = value.charAt(i);
+      if (c != 0 && c < 0x80) {
+        this.constantPool.putByte(c);
+      } else if (c < 0x800) {
+        // the null char is encoded using two bytes as well
+        this.constantPool.putByte(0xC0 | (c >> 6)).putByte(0x80 | (c & 0x3F));
+      } else {
+        this.constantPool.putByte(0xE0 | (c >> 12)).putByte(0x80 | ((c >> 6) & 0x3F)).putByte(0x80 | (c & 0x3F));
+      }
+    }
+    return this.registerConstant(key, 1);
+  }
+
+  /**
+   * Get or adds a class constant to the constant pool.
+   *
+   * @param internalName the internal name of the class.
+   * @return the index of the constant in the constant pool.
+   */
+  int classConstant(@NonNull String internalName) {
+    String key = CONSTANT_CLASS + internalName;
+    Integer known = this.constantIndexes.get(key);
+    if (known != null) {
+      return known;
+    }
+
+    int nameIndex = this.utf8Constant(internalName);
+    this.constantPool.putByte(CONSTANT_CLASS).putShort(nameIndex);
+    return this.registerConstant(key, 1);
+  }
+
+  /**
+   * Get or adds a field or method reference constant to the constant pool.
+   *
+   * @param tag        the tag of the reference constant.
+   * @param owner      the internal name of the class declaring the member.
+   * @param name       the name of the member.
+   * @param descriptor the descriptor of the member.
+   * @return the index of the constant in the constant pool.
+   */
+  int memberConstant(int tag, @NonNull String owner, @NonNull String name, @NonNull String descriptor) {
+    String key = tag + owner + '.' + name + descriptor;
+    Integer known = this.constantIndexes.get(key);
+    if (known != null) {
+      return known;
+    }
+
+    int classIndex = this.classConstant(owner);
+    int nameAndTypeIndex = this.nameAndTypeConstant(name, descriptor);
+    this.constantPool.putByte(tag).putShort(classIndex).putShort(nameAndTypeIndex);
+    return this.registerConstant(key, 1);
+  }
+
+  /**
+   * Get or adds a name and type constant to the constant pool.
+   *
+   * @param name       the name of the member.
+   * @param descriptor the descriptor of the member.
+   * @return the index of the constant in the constant pool.
+   */
+  private int nameAndTypeConstant(@NonNull String name, @NonNull String descriptor) {
+    String key = CONSTANT_NAME_AND_TYPE + name + ':' + descriptor;
+    Integer known = this.constantIndexes.get(key);
+    if (known != null) {
+      return known;
+    }
+
+    int nameIndex = this.utf8Constant(name);
+    int descriptorIndex = this.utf8Constant(descriptor);
+    this.constantPool.putByte(CONSTANT_NAME_AND_TYPE).putShort(nameIndex).putShort(descriptorIndex);
+    return this.registerConstant(key, 1);
+  }
+
+  /**
+   * Registers the constant which was written last to the constant pool.
+   *
+   * @param key   the key of the constant, for de-duplication.
+   * @param slots the amount of slots the constant takes in the pool.
+   * @return the index of the constant in the constant pool.
+   */
+  private int registerConstant(@NonNull String key, int slots) {
+    int index = this.constantCount;
+    this.constantCount += slots;
+    this.constantIndexes.put(key, index);
+    return index;
+  }
+
+  /**
+   * A writer for the code of a single method. The writer keeps track of the operand stack depth to compute the maximum
+   * stack size of the method.
+   *
+   * @since 1.4
+   */
+  static final class MethodWriter {
+
+    // opcodes
+    private static final int ACONST_NULL = 0x01;
+    private static final int ICONST_0 = 0x03;
+    private static final int BIPUSH = 0x10;
+    private static final int SIPUSH = 0x11;
+    private static final int ILOAD = 0x15;
+    private static final int LLOAD = 0x16;
+    private static final int FLOAD = 0x17;
+    private static final int DLOAD = 0x18;
+    private static final int ALOAD = 0x19;
+    private static final int AALOAD = 0x32;
+    private static final int ISTORE = 0x36;
+    private static final int ASTORE = 0x3a;
+    private static final int DUP = 0x59;
+    private static final int IRETURN = 0xac;
+    private static final int LRETURN = 0xad;
+    private static final int FRETURN = 0xae;
+    private static final int DRETURN = 0xaf;
+    private static final int ARETURN = 0xb0;
+    private static final int RETURN = 0xb1;
+    private static final int GETSTATIC = 0xb2;
+    private static final int PUTSTATIC = 0xb3;
+    private static final int GETFIELD = 0xb4;
+    private static final int PUTFIELD = 0xb5;
+    private static final int INVOKEVIRTUAL = 0xb6;
+    private static final int INVOKESPECIAL = 0xb7;
+    private static final int INVOKESTATIC = 0xb8;
+    private static final int INVOKEINTERFACE = 0xb9;
+    private static final int NEW = 0xbb;
+    private static final int CHECKCAST = 0xc0;
+
+    private final ClassFileWriter classWriter;
+    private final int nameIndex;
+    private final int descriptorIndex;
+    private final ByteVector code = new ByteVector();
+
+    private int maxLocals;
+    private int stackSize;
+    private int maxStackSize;
+
+    /**
+     * Constructs a new method writer.
+     *
+     * @param classWriter the writer of the class declaring the method.
+     * @param nameIndex   the constant pool index of the method name.
+     * @param descriptor  the descriptor of the method.
+     */
+    private MethodWriter(@NonNull ClassFileWriter classWriter, int nameIndex, @NonNull String descriptor) {
+      this.classWriter = classWriter;
+      this.nameIndex = nameIndex;
+      this.descriptorIndex = classWriter.utf8Constant(descriptor);
+      // 'this' + all parameters
+      this.maxLocals = 1 + argumentSlots(descriptor);
+    }
+
+    /**
+     * Counts the slots which are needed by the arguments of the given method descriptor.
+     *
+     * @param descriptor the method descriptor.
+     * @return the slots needed by the arguments of the method.
+     */
+    private static int argumentSlots(@NonNull String descriptor) {
+      int slots = 0;
+      int index = 1;
+      while (descriptor.charAt(index) != ')') {
+        char current = descriptor.charAt(index);
+        if (current == 'J' || current == 'D') {
+          slots += 2;
+          index++;
+        } else {
+          slots++;
+          // skip the array dimensions and the class name of reference types
+          while (descriptor.charAt(index) == '[') {
+            index++;
+          }
+          if (descriptor.charAt(index) == 'L') {
+            index = descriptor.indexOf(';', index);
+          }
+          index++;
+        }
+      }
+      return slots;
+    }
+
+    /**
+     * Get the slots needed by a value with the given type descriptor.
+     *
+     * @param descriptor the descriptor of the value.
+     * @return the slots needed by the value.
+     */
+    private static int valueSlots(@NonNull String descriptor) {
+      char first = descriptor.charAt(0);
+      return first == 'V' ? 0 : first == 'J' || first == 'D' ? 2 : 1;
+    }
+
+    /**
+     * Get the stack slots needed by the return value of the given method descriptor.
+     *
+     * @param descriptor the method descriptor.
+     * @return the slots needed by the return value.
+     */
+    private static int returnSlots(@NonNull String descriptor) {
+      return valueSlots(descriptor.substring(descriptor.indexOf(')') + 1));
+    }
+
+    /**
+     * Pushes null to the stack.
+     *
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter pushNull() {
+      return this.op(ACONST_NULL, 1);
+    }
+
+    /**
+     * Pushes the given int constant to the stack.
+     *
+     * @param value the value to push.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter pushInt(int value) {
+      if (value >= -1 && value <= 5) {
+        return this.op(ICONST_0 + value, 1);
+      } else if (value >= Byte.MIN_VALUE && value <= Byte.MAX_VALUE) {
+        this.op(BIPUSH, 1).code.putByte(value);
+      } else {
+        this.op(SIPUSH, 1).code.putShort(value);
+      }
+      return this;
+    }
+
+    /**
+     * Loads a reference from the given local variable slot.
+     *
+     * @param slot the slot to load the reference from.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter loadReference(int slot) {
+      return this.localOp(ALOAD, slot, 1);
+    }
+
+    /**
+     * Loads a value of the given type from the given local variable slot.
+     *
+     * @param type the type of the value to load.
+     * @param slot the slot to load the value from.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter load(@NonNull Class<?> type, int slot) {
+      if (!type.isPrimitive()) {
+        return this.localOp(ALOAD, slot, 1);
+      } else if (type == long.class) {
+        return this.localOp(LLOAD, slot, 2);
+      } else if (type == double.class) {
+        return this.localOp(DLOAD, slot, 2);
+      } else if (type == float.class) {
+        return this.localOp(FLOAD, slot, 1);
+      } else {
+        return this.localOp(ILOAD, slot, 1);
+      }
+    }
+
+    /**
+     * Stores the reference on top of the stack in the given local variable slot.
+     *
+     * @param slot the slot to store the reference in.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter storeReference(int slot) {
+      this.maxLocals = Math.max(this.maxLocals, slot + 1);
+      return this.localOp(ASTORE, slot, -1);
+    }
+
+    /**
+     * Loads the reference at the index on top of the stack from the object array below it.
+     *
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter loadArrayElement() {
+      return this.op(AALOAD, -1);
+    }
+
+    /**
+     * Duplicates the value on top of the stack.
+     *
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter dup() {
+      return this.op(DUP, 1);
+    }
+
+    /**
+     * Emits the given instruction which takes no operands.
+     *
+     * @param opcode     the opcode of the instruction.
+     * @param stackDelta the change of the stack size caused by the instruction.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter insn(int opcode, int stackDelta) {
+      return this.op(opcode, stackDelta);
+    }
+
+    /**
+     * Checks that the reference on top of the stack is an instance of the given type.
+     *
+     * @param type the type to check.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter checkCast(@NonNull Class<?> type) {
+      this.op(CHECKCAST, 0).code.putShort(this.classWriter.classConstant(internalName(type)));
+      return this;
+    }
+
+    /**
+     * Creates a new uninitialized instance of the given type.
+     *
+     * @param type the type to create the instance of.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter newInstance(@NonNull Class<?> type) {
+      this.op(NEW, 1).code.putShort(this.classWriter.classConstant(internalName(type)));
+      return this;
+    }
+
+    /**
+     * Reads or writes the given field.
+     *
+     * @param owner the class declaring the field.
+     * @param name  the name of the field.
+     * @param type  the type of the field.
+     * @param write if the field should be written rather than read.
+     * @param stat  if the field is static.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter field(
+      @NonNull Class<?> owner,
+      @NonNull String name,
+      @NonNull Class<?> type,
+      boolean write,
+      boolean stat
+    ) {
+      String descriptor = descriptor(type);
+      int valueSlots = valueSlots(descriptor);
+      int instanceSlots = stat ? 0 : 1;
+
+      int opcode;
+      int stackDelta;
+      if (write) {
+        opcode = stat ? PUTSTATIC : PUTFIELD;
+        stackDelta = -valueSlots - instanceSlots;
+      } else {
+        opcode = stat ? GETSTATIC : GETFIELD;
+        stackDelta = valueSlots - instanceSlots;
+      }
+
+      int index = this.classWriter.memberConstant(CONSTANT_FIELDREF, internalName(owner), name, descriptor);
+      this.op(opcode, stackDelta).code.putShort(index);
+      return this;
+    }
+
+    /**
+     * Invokes a virtual method on a class.
+     *
+     * @param owner the owner of the method.
+     * @param name  the name of the method.
+     * @param desc  the descriptor of the method.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter invokeVirtual(@NonNull String owner, @NonNull String name, @NonNull String desc) {
+      return this.invoke(INVOKEVIRTUAL, CONSTANT_METHODREF, owner, name, desc, true);
+    }
+
+    /**
+     * Invokes an abstract or default method on an interface.
+     *
+     * @param owner the owner of the method.
+     * @param name  the name of the method.
+     * @param desc  the descriptor of the method.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter invokeInterface(@NonNull String owner, @NonNull String name, @NonNull String desc) {
+      this.invoke(INVOKEINTERFACE, CONSTANT_INTERFACE_METHODREF, owner, name, desc, true);
+      // the count operand includes the receiver, followed by a mandatory zero byte
+      this.code.putByte(1 + argumentSlots(desc)).putByte(0);
+      return this;
+    }
+
+    /**
+     * Invokes a static method.
+     *
+     * @param owner      the owner of the method.
+     * @param name       the name of the method.
+     * @param descriptor the descriptor of the method.
+     * @param itf        if the owner of the method is an interface.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter invokeStatic(
+      @NonNull String owner,
+      @NonNull String name,
+      @NonNull String descriptor,
+      boolean itf
+    ) {
+      int tag = itf ? CONSTANT_INTERFACE_METHODREF : CONSTANT_METHODREF;
+      return this.invoke(INVOKESTATIC, tag, owner, name, descriptor, false);
+    }
+
+    /**
+     * Invokes a constructor or super method without virtual dispatch.
+     *
+     * @param owner the owner of the method.
+     * @param name  the name of the method.
+     * @param desc  the descriptor of the method.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter invokeSpecial(@NonNull String owner, @NonNull String name, @NonNull String desc) {
+      return this.invoke(INVOKESPECIAL, CONSTANT_METHODREF, owner, name, desc, true);
+    }
+
+    /**
+     * Returns the value on top of the stack from the method, using the return instruction for the given type.
+     *
+     * @param type the type of the value to return, void for no value.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull MethodWriter returnValue(@NonNull Class<?> type) {
+      if (type == void.class) {
+        return this.op(RETURN, 0);
+      } else if (!type.isPrimitive()) {
+        return this.op(ARETURN, -1);
+      } else if (type == long.class) {
+        return this.op(LRETURN, -2);
+      } else if (type == double.class) {
+        return this.op(DRETURN, -2);
+      } else if (type == float.class) {
+        return this.op(FRETURN, -1);
+      } else {
+        return this.op(IRETURN, -1);
+      }
+    }
+
+    /**
+     * Emits a method invocation instruction.
+     *
+     * @param opcode     the opcode of the instruction.
+     * @param tag        the tag of the constant pool entry for the invoked method.
+     * @param owner      the owner of the method.
+     * @param name       the name of the method.
+     * @param descriptor the descriptor of the method.
+     * @param receiver   if the invocation takes a receiver.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    private @NonNull MethodWriter invoke(
+      int opcode,
+      int tag,
+      @NonNull String owner,
+      @NonNull String name,
+      @NonNull String descriptor,
+      boolean receiver
+    ) {
+      int stackDelta = returnSlots(descriptor) - argumentSlots(descriptor) - (receiver ? 1 : 0);
+      int index = this.classWriter.memberConstant(tag, owner, name, descriptor);
+      this.op(opcode, stackDelta).code.putShort(index);
+      return this;
+    }
+
+    /**
+     * Emits a local variable instruction, using the short form if possible.
+     *
+     * @param opcode     the opcode of the long form of the instruction.
+     * @param slot       the local variable slot.
+     * @param stackDelta the change of the stack size caused by the instruction.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    private @NonNull MethodWriter localOp(int opcode, int slot, int stackDelta) {
+      if (slot <= 3) {
+        // the short forms are ordered by type, each type having 4 slots: xLOAD_0 = ILOAD_0 + (xLOAD - ILOAD) * 4
+        int base = opcode >= ISTORE ? 0x3b + (opcode - ISTORE) * 4 : 0x1a + (opcode - ILOAD) * 4;
+        return this.op(base + slot, stackDelta);
+      } else {
+        this.op(opcode, stackDelta).code.putByte(slot);
+        return this;
+      }
+    }
+
+    /**
+     * Emits the given opcode and tracks the stack size change.
+     *
+     * @param opcode     the opcode to emit.
+     * @param stackDelta the change of the stack size caused by the instruction.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    private @NonNull MethodWriter op(int opcode, int stackDelta) {
+      this.code.putByte(opcode);
+      this.stackSize += stackDelta;
+      this.maxStackSize = Math.max(this.maxStackSize, this.stackSize);
+      return this;
+    }
+
+    /**
+     * Writes this method into the given class file buffer.
+     *
+     * @param out               the buffer to write the method to.
+     * @param codeAttributeName the constant pool index of the code attribute name.
+     */
+    private void write(@NonNull ByteVector out, int codeAttributeName) {
+      out.putShort(ACC_PUBLIC).putShort(this.nameIndex).putShort(this.descriptorIndex);
+
+      // the code attribute is the only attribute of the method
+      out.putShort(1).putShort(codeAttributeName);
+      out.putInt(12 + this.code.length());
+      out.putShort(this.maxStackSize).putShort(this.maxLocals);
+      out.putInt(this.code.length()).putBytes(this.code);
+      // no exception table & no attributes
+      out.putShort(0).putShort(0);
+    }
+  }
+
+  /**
+   * A growable byte array which writes values in big endian order, as required by the class file format.
+   *
+   * @since 1.4
+   */
+  private static final class ByteVector {
+
+    private byte[] data = new byte[64];
+    private int length;
+
+    /**
+     * Writes a single byte.
+     *
+     * @param value the byte to write.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull ByteVector putByte(int value) {
+      this.ensureCapacity(1);
+      this.data[this.length++] = (byte) value;
+      return this;
+    }
+
+    /**
+     * Writes an unsigned short.
+     *
+     * @param value the short to write.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull ByteVector putShort(int value) {
+      this.ensureCapacity(2);
+      this.data[this.length++] = (byte) (value >>> 8);
+      this.data[this.length++] = (byte) value;
+      return this;
+    }
+
+    /**
+     * Writes an int.
+     *
+     * @param value the int to write.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull ByteVector putInt(int value) {
+      return this.putShort(value >>> 16).putShort(value);
+    }
+
+    /**
+     * Writes all bytes of the given byte vector.
+     *
+     * @param other the bytes to write.
+     * @return the same instance as used to call the method, for chaining.
+     */
+    public @NonNull ByteVector putBytes(@NonNull ByteVector other) {
+      this.ensureCapacity(other.length);
+      System.arraycopy(other.data, 0, this.data, this.length, other.length);
+      this.length += other.length;
+      return this;
+    }
+
+    /**
+     * Get the amount of bytes written to this vector.
+     *
+     * @return the amount of bytes written to this vector.
+     */
+    public int length() {
+      return this.length;
+    }
+
+    /**
+     * Copies the written bytes into a new array.
+     *
+     * @return the written bytes.
+     */
+    public byte[] toByteArray() {
+      return Arrays.copyOf(this.data, this.length);
+    }
+
+    /**
+     * Ensures that the given amount of bytes can be written without exceeding the backing array.
+     *
+     * @param bytes the amount of bytes that should be written.
+     */
+    private void ensureCapacity(int bytes) {
+      if (this.length + bytes > this.data.length) {
+        this.data = Arrays.copyOf(this.data, Math.max(this.data.length * 2, this.length + bytes));
+      }
+    }
+  }
+}
@@ -0,0 +1,171 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.handles;
+
+import dev.derklaro.reflexion.FieldAccessor;
+import dev.derklaro.reflexion.MethodAccessor;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodHandles.Lookup;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Executable;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import lombok.NonNull;
+
+/**
+ * Internal: creates the exact type method handles of accessors which don't provide their own. The wrapped member is
+ * unreflected using the trusted lookup if available, or the public lookup otherwise. If the member is not accessible
+ * for the public lookup, the handle invokes the direct access methods of the accessor instead.
+ *
+ * @since 1.4
+ */
+public final class AccessorHandles {
+
+  private static final MethodHandle GET_VALUE;
+  private static final MethodHandle SET_VALUE;
+  private static final MethodHandle INVOKE;
+
+  static {
+    try {
+      Lookup lookup = MethodHandles.publicLookup();
+      GET_VALUE = lookup.findVirtual(
+        FieldAccessor.class,
+        "getValueDirect",
+        MethodType.methodType(Object.class, Object.class));
+      SET_VALUE = lookup.findVirtual(
+        FieldAccessor.class,
+        "setValueDirect",
+        MethodType.methodType(void.class, Object.class, Object.class));
+      INVOKE = lookup.findVirtual(
+        MethodAccessor.class,
+        "invokeDirect",
+        MethodType.methodType(Object.class, Object.class, Object[].class)).asFixedArity();
+    } catch (NoSuchMethodException | IllegalAccessException exception) {
+      throw new ExceptionInInitializerError(exception);
+    }
+  }
+
+  private AccessorHandles() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Creates a handle which reads the field wrapped by the given accessor, see {@link FieldAccessor#getterHandle()}.
+   *
+   * @param accessor the accessor to create the handle for.
+   * @return a handle reading the wrapped field.
+   * @throws NullPointerException if the given accessor is null.
+   */
+  public static @NonNull MethodHandle getterHandle(@NonNull FieldAccessor accessor) {
+    Field field = accessor.getMember();
+    boolean staticField = Modifier.isStatic(field.getModifiers());
+    try {
+      Lookup trustedLookup = ImplLookupAccessor.findImplLookup();
+      if (trustedLookup != null) {
+        // find the handle instead of unreflecting the field, see MethodHandleAccessorFactory.findFieldHandle
+        return staticField
+          ? trustedLookup.findStaticGetter(field.getDeclaringClass(), field.getName(), field.getType())
+          : trustedLookup.findGetter(field.getDeclaringClass(), field.getName(), field.getType());
+      }
+      return MethodHandles.publicLookup().unreflectGetter(field);
+    } catch (NoSuchFieldException | IllegalAccessException exception) {
+      // read the field through the accessor
+      MethodHandle getter = GET_VALUE.bindTo(accessor);
+      if (staticField) {
+        return MethodHandles.insertArguments(getter, 0, (Object) null).asType(MethodType.methodType(field.getType()));
+      }
+      return getter.asType(MethodType.methodType(field.getType(), field.getDeclaringClass()));
+    }
+  }
+
+  /**
+   * Creates a handle which writes the field wrapped by the given accessor, see {@link FieldAccessor#setterHandle()}.
+   *
+   * @param accessor the accessor to create the handle for.
+   * @return a handle writing the wrapped field.
+   * @throws NullPointerException if the given accessor is null.
+   */
+  public static @NonNull MethodHandle setterHandle(@NonNull FieldAccessor accessor) {
+    Field field = accessor.getMember();
+    boolean staticField = Modifier.isStatic(field.getModifiers());
+    try {
+      Lookup trustedLookup = ImplLookupAccessor.findImplLookup();
+      if (trustedLookup != null) {
+        return staticField
+          ? trustedLookup.findStaticSetter(field.getDeclaringClass(), field.getName(), field.getType())
+          : trustedLookup.findSetter(field.getDeclaringClass(), field.getName(), field.getType());
+      }
+      return MethodHandles.publicLookup().unreflectSetter(field);
+    } catch (NoSuchFieldException | IllegalAccessException exception) {
+      // write the field through the accessor
+      MethodHandle setter = SET_VALUE.bindTo(accessor);
+      if (staticField) {
+        MethodHandle staticSetter = MethodHandles.insertArguments(setter, 0, (Object) null);
+        return staticSetter.asType(MethodType.methodType(void.class, field.getType()));
+      }
+      return setter.asType(MethodType.methodType(void.class, field.getDeclaringClass(), field.getType()));
+    }
+  }
+
+  /**
+   * Creates a handle which invokes the method or constructor wrapped by the given accessor, see
+   * {@link MethodAccessor#asMethodHandle()}.
+   *
+   * @param accessor the accessor to create the handle for.
+   * @return a handle invoking the wrapped member.
+   * @throws NullPointerException if the given accessor is null.
+   */
+  public static @NonNull MethodHandle invokerHandle(@NonNull MethodAccessor<?> accessor) {
+    Executable executable = accessor.getMember();
+    Lookup trustedLookup = ImplLookupAccessor.findImplLookup();
+    Lookup lookup = trustedLookup != null ? trustedLookup : MethodHandles.publicLookup();
+    try {
+      return executable instanceof Method
+        ? lookup.unreflect((Method) executable)
+        : lookup.unreflectConstructor((Constructor<?>) executable);
+    } catch (IllegalAccessException exception) {
+      // invoke the member through the accessor
+      MethodType type;
+      MethodHandle invoker = INVOKE.bindTo(accessor);
+      Class<?>[] parameterTypes = executable.getParameterTypes();
+      if (executable instanceof Constructor<?>) {
+        invoker = MethodHandles.insertArguments(invoker, 0, (Object) null);
+        type = MethodType.methodType(executable.getDeclaringClass(), parameterTypes);
+      } else {
+        Method method = (Method) executable;
+        type = MethodType.methodType(method.getReturnType(), parameterTypes);
+        if (Modifier.isStatic(method.getModifiers())) {
+          invoker = MethodHandles.insertArguments(invoker, 0, (Object) null);
+        } else {
+          type = type.insertParameterTypes(0, method.getDeclaringClass());
+        }
+      }
+      return invoker.asCollector(Object[].class, parameterTypes.length).asType(type);
+    }
+  }
+}
@@ -42,11 +42,21 @@ private ImplLookupAccessor() {
   }
 
   /**
-   * Tries to get the IMPL_LOOKUP using the either direct field access or the methods provided by sun.misc.Unsafe.
+   * Tries to get the IMPL_LOOKUP using the either direct field access or the methods provided by sun.misc.Unsafe. The
+   * lookup is only resolved once per jvm, subsequent calls return the result of the first resolve.
    *
    * @return the IMPL_LOOKUP field value or null if the lookup is not possible.
    */
   public static @Nullable Lookup findImplLookup() {
+    return LookupHolder.IMPL_LOOKUP;
+  }
+
+  /**
+   * Resolves the IMPL_LOOKUP using the either direct field access or the methods provided by sun.misc.Unsafe.
+   *
+   * @return the IMPL_LOOKUP field value or null if the lookup is not possible.
+   */
+  private static @Nullable Lookup resolveImplLookup() {
     // we prefer direct access as the user is 100% sure what he is doing and we are not relying
     // on sun internal methods if not 100% needed
     return Util.firstNonNull(tryResolveUsingDirectAccess(), tryResolveUsingUnsafe());
@@ -111,4 +121,14 @@ private ImplLookupAccessor() {
       return null;
     }
   }
+
+  /**
+   * Holds the resolved IMPL_LOOKUP, the lookup is resolved when the holder is first accessed.
+   *
+   * @since 1.4
+   */
+  private static final class LookupHolder {
+
+    private static final Lookup IMPL_LOOKUP = resolveImplLookup();
+  }
 }
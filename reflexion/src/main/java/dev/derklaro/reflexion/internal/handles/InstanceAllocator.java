@@ -0,0 +1,134 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.handles;
+
+import dev.derklaro.reflexion.ReflexionException;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: creates handles which allocate instances of a class without running any of its constructors. The fields
+ * of allocated instances hold their default values (null, 0 or false), including fields which are initialized in their
+ * declaration.
+ * <p>
+ * Instances are allocated using {@code sun.misc.Unsafe.allocateInstance}, which is available on all jvms supported by
+ * this library. If the unsafe class is not available the serialization constructor of the class is used instead, which
+ * only runs the constructor without parameters of {@code Object}.
+ *
+ * @since 1.4
+ */
+public final class InstanceAllocator {
+
+  private static final MethodType ALLOCATOR_TYPE = MethodType.methodType(Object.class);
+
+  private InstanceAllocator() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Creates a handle of type {@code ()Object} which allocates a new instance of the given class on each invocation,
+   * without running any constructor of the class.
+   *
+   * @param type the class to allocate instances of.
+   * @return a handle allocating instances of the given class.
+   * @throws NullPointerException     if the given type is null.
+   * @throws IllegalArgumentException if the given type is abstract, an interface, an array or a primitive type.
+   * @throws ReflexionException       if neither allocation strategy is available.
+   */
+  public static @NonNull MethodHandle allocatorFor(@NonNull Class<?> type) {
+    if (type.isArray() || type.isPrimitive() || Modifier.isAbstract(type.getModifiers())) {
+      throw new IllegalArgumentException("Unable to allocate instances of " + type.getName());
+    }
+
+    MethodHandle unsafeAllocate = UnsafeHolder.ALLOCATE_INSTANCE;
+    if (unsafeAllocate != null) {
+      return MethodHandles.insertArguments(unsafeAllocate, 0, type).asType(ALLOCATOR_TYPE);
+    }
+
+    return serializationAllocator(type);
+  }
+
+  /**
+   * Creates an allocator for the given type based on the serialization constructor of it.
+   *
+   * @param type the class to allocate instances of.
+   * @return a handle allocating instances of the given class.
+   * @throws ReflexionException if the serialization constructor cannot be created.
+   */
+  private static @NonNull MethodHandle serializationAllocator(@NonNull Class<?> type) {
+    try {
+      Class<?> factoryClass = Class.forName("sun.reflect.ReflectionFactory");
+      Object factory = factoryClass.getMethod("getReflectionFactory").invoke(null);
+      Method newConstructor = factoryClass.getMethod("newConstructorForSerialization", Class.class, Constructor.class);
+      Constructor<?> constructor = (Constructor<?>) newConstructor.invoke(factory, type, Object.class.getConstructor());
+
+      MethodHandle newInstance = MethodHandles.publicLookup()
+        .findVirtual(Constructor.class, "newInstance", MethodType.methodType(Object.class, Object[].class))
+        .bindTo(constructor);
+      return MethodHandles.insertArguments(newInstance, 0, (Object) new Object[0]).asType(ALLOCATOR_TYPE);
+    } catch (Exception exception) {
+      throw new ReflexionException(exception);
+    }
+  }
+
+  /**
+   * Resolves the handle to {@code allocateInstance} of the unsafe instance.
+   *
+   * @return a handle of type {@code (Class)Object} allocating instances, null if unsafe is not available.
+   */
+  private static @Nullable MethodHandle resolveUnsafeAllocate() {
+    try {
+      Class<?> unsafeClass = Class.forName("sun.misc.Unsafe");
+      Field theUnsafe = unsafeClass.getDeclaredField("theUnsafe");
+      theUnsafe.setAccessible(true);
+
+      MethodHandle allocateInstance = MethodHandles.publicLookup().findVirtual(
+        unsafeClass,
+        "allocateInstance",
+        MethodType.methodType(Object.class, Class.class));
+      return allocateInstance.bindTo(theUnsafe.get(null));
+    } catch (Throwable throwable) {
+      // unsafe is not available in this jvm
+      return null;
+    }
+  }
+
+  /**
+   * Holds the resolved unsafe allocation handle, the handle is resolved when the holder is first accessed.
+   *
+   * @since 1.4
+   */
+  private static final class UnsafeHolder {
+
+    private static final MethodHandle ALLOCATE_INSTANCE = resolveUnsafeAllocate();
+  }
+}
@@ -0,0 +1,368 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.handles;
+
+import dev.derklaro.reflexion.AccessorFactory;
+import dev.derklaro.reflexion.FieldAccessor;
+import dev.derklaro.reflexion.MethodAccessor;
+import dev.derklaro.reflexion.ReflexionException;
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.invoke.CallSite;
+import java.lang.invoke.LambdaMetafactory;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodHandles.Lookup;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Executable;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import java.util.Arrays;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: binds accessors to implementations of functional interfaces which are spun using the lambda metafactory.
+ * Methods and constructors are bound directly, which means that the functional interface method calls the member
+ * without going through a method handle. Fields cannot be targeted by the lambda metafactory, therefore field getters
+ * and setters are bound to the matching direct accessor method of the field accessor.
+ * <p>
+ * The implementations of bound members are defined in the class declaring the member, therefore the functional
+ * interface must be visible to the class loader of that class.
+ *
+ * @since 1.4
+ */
+public final class LambdaBinder {
+
+  private LambdaBinder() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Binds the member of the given method accessor to an implementation of the given functional interface. If the
+   * interface method takes one parameter less than the member (including the receiver of instance methods), the
+   * binding of the reflexion instance of the accessor is used as the receiver.
+   *
+   * @param accessor the accessor of the member to bind.
+   * @param samType  the functional interface to implement.
+   * @param <F>      the type of the functional interface.
+   * @return an implementation of the given functional interface which invokes the member of the given accessor.
+   * @throws NullPointerException     if the given accessor or interface type is null.
+   * @throws IllegalArgumentException if the given type is not a functional interface or the receiver is missing.
+   * @throws ReflexionException       if the interface cannot be bound to the member.
+   */
+  public static @NonNull <F> F bindMember(@NonNull MethodAccessor<?> accessor, @NonNull Class<F> samType) {
+    Method sam = findSam(samType);
+    Executable member = accessor.getMember();
+    Lookup caller = callerLookup(accessor.getReflexion().getAccessorFactory(), member.getDeclaringClass());
+
+    try {
+      MethodHandle impl = member instanceof Constructor<?>
+        ? caller.unreflectConstructor((Constructor<?>) member)
+        : caller.unreflect((Method) member);
+
+      // bind the receiver of instance methods if the interface method does not take it
+      boolean instanceMethod = !(member instanceof Constructor<?>) && !Modifier.isStatic(member.getModifiers());
+      if (instanceMethod && sam.getParameterCount() == impl.type().parameterCount() - 1) {
+        Object receiver = accessor.getReflexion().getBinding();
+        if (receiver == null) {
+          throw new IllegalArgumentException("Binding " + samType.getName() + " to " + member + " requires a receiver");
+        }
+        return spin(caller, samType, sam, impl, member.getDeclaringClass(), receiver);
+      }
+
+      return spin(caller, samType, sam, impl, null, null);
+    } catch (IllegalAccessException exception) {
+      throw new ReflexionException(exception);
+    }
+  }
+
+  /**
+   * Binds the getter of the given field accessor to an implementation of the given functional interface. The interface
+   * method either takes no parameters (reading using the implicit instance of the accessor) or the instance to read
+   * from. A primitive return type of the interface method is read without boxing.
+   *
+   * @param accessor the accessor of the field to bind.
+   * @param samType  the functional interface to implement.
+   * @param <F>      the type of the functional interface.
+   * @return an implementation of the given functional interface which reads the field of the given accessor.
+   * @throws NullPointerException     if the given accessor or interface type is null.
+   * @throws IllegalArgumentException if the given type is not a functional interface or has an unsupported signature.
+   * @throws ReflexionException       if the interface cannot be bound to the field.
+   */
+  public static @NonNull <F> F bindGetter(@NonNull FieldAccessor accessor, @NonNull Class<F> samType) {
+    Method sam = findSam(samType);
+    int parameterCount = sam.getParameterCount();
+    Class<?> returnType = sam.getReturnType();
+    if (parameterCount > 1 || returnType == void.class) {
+      throw new IllegalArgumentException("Interface " + samType.getName() + " cannot be bound to a field getter");
+    }
+
+    String name = returnType.isPrimitive() ? "get" + capitalize(returnType.getName()) : "getValueDirect";
+    Class<?>[] parameterTypes = parameterCount == 0 ? new Class<?>[0] : new Class<?>[]{Object.class};
+    return bindFieldAccess(accessor, samType, sam, name, parameterTypes);
+  }
+
+  /**
+   * Binds the setter of the given field accessor to an implementation of the given functional interface. The interface
+   * method either takes the new value (writing using the implicit instance of the accessor) or the instance to write
+   * to followed by the new value. A primitive value parameter of the interface method is written without boxing.
+   *
+   * @param accessor the accessor of the field to bind.
+   * @param samType  the functional interface to implement.
+   * @param <F>      the type of the functional interface.
+   * @return an implementation of the given functional interface which writes the field of the given accessor.
+   * @throws NullPointerException     if the given accessor or interface type is null.
+   * @throws IllegalArgumentException if the given type is not a functional interface or has an unsupported signature.
+   * @throws ReflexionException       if the interface cannot be bound to the field.
+   */
+  public static @NonNull <F> F bindSetter(@NonNull FieldAccessor accessor, @NonNull Class<F> samType) {
+    Method sam = findSam(samType);
+    int parameterCount = sam.getParameterCount();
+    if (parameterCount < 1 || parameterCount > 2 || sam.getReturnType() != void.class) {
+      throw new IllegalArgumentException("Interface " + samType.getName() + " cannot be bound to a field setter");
+    }
+
+    Class<?> valueType = sam.getParameterTypes()[parameterCount - 1];
+    String name = valueType.isPrimitive() ? "set" + capitalize(valueType.getName()) : "setValueDirect";
+    Class<?> implValueType = valueType.isPrimitive() ? valueType : Object.class;
+    Class<?>[] parameterTypes = parameterCount == 1
+      ? new Class<?>[]{implValueType}
+      : new Class<?>[]{Object.class, implValueType};
+    return bindFieldAccess(accessor, samType, sam, name, parameterTypes);
+  }
+
+  /**
+   * Binds the given method of the field accessor interface, using the given accessor as the receiver, to an
+   * implementation of the given functional interface.
+   *
+   * @param accessor       the accessor to use as the receiver of the method.
+   * @param samType        the functional interface to implement.
+   * @param sam            the single abstract method of the functional interface.
+   * @param name           the name of the field accessor method to bind.
+   * @param parameterTypes the parameter types of the field accessor method to bind.
+   * @param <F>            the type of the functional interface.
+   * @return an implementation of the given functional interface which calls the given field accessor method.
+   * @throws ReflexionException if the interface cannot be bound to the field accessor method.
+   */
+  private static @NonNull <F> F bindFieldAccess(
+    @NonNull FieldAccessor accessor,
+    @NonNull Class<F> samType,
+    @NonNull Method sam,
+    @NonNull String name,
+    @NonNull Class<?>[] parameterTypes
+  ) {
+    // the implementation must see both the interface and the field accessor, prefer this class for public interfaces
+    Class<?> host = isPublic(samType) ? LambdaBinder.class : samType;
+    Lookup caller = callerLookup(accessor.getReflexion().getAccessorFactory(), host);
+    try {
+      MethodHandle impl = caller.unreflect(FieldAccessor.class.getMethod(name, parameterTypes));
+      return spin(caller, samType, sam, impl, FieldAccessor.class, accessor);
+    } catch (NoSuchMethodException | IllegalAccessException exception) {
+      throw new ReflexionException(exception);
+    }
+  }
+
+  /**
+   * Spins an implementation of the given functional interface which calls the given implementation handle.
+   *
+   * @param caller       the lookup in which the implementation is defined, must have private access.
+   * @param samType      the functional interface to implement.
+   * @param sam          the single abstract method of the functional interface.
+   * @param impl         the direct handle of the member to call in the interface method.
+   * @param capturedType the type of the captured receiver, null if no receiver is captured.
+   * @param captured     the captured receiver, null if no receiver is captured.
+   * @param <F>          the type of the functional interface.
+   * @return an implementation of the given functional interface.
+   * @throws ReflexionException if the implementation cannot be spun.
+   */
+  @SuppressWarnings("unchecked")
+  private static @NonNull <F> F spin(
+    @NonNull Lookup caller,
+    @NonNull Class<F> samType,
+    @NonNull Method sam,
+    @NonNull MethodHandle impl,
+    @Nullable Class<?> capturedType,
+    @Nullable Object captured
+  ) {
+    MethodType samMethodType = MethodType.methodType(sam.getReturnType(), sam.getParameterTypes());
+    MethodType implType = capturedType == null ? impl.type() : impl.type().dropParameterTypes(0, 1);
+    if (implType.parameterCount() != samMethodType.parameterCount()) {
+      throw new IllegalArgumentException(String.format(
+        "Interface method %s takes %d parameters, but the member takes %d",
+        sam,
+        samMethodType.parameterCount(),
+        implType.parameterCount()));
+    }
+
+    try {
+      MethodType invokedType = capturedType == null
+        ? MethodType.methodType(samType)
+        : MethodType.methodType(samType, capturedType);
+      CallSite callSite = LambdaMetafactory.metafactory(
+        caller,
+        sam.getName(),
+        invokedType,
+        samMethodType,
+        impl,
+        instantiatedType(samMethodType, implType));
+      MethodHandle factory = callSite.getTarget();
+      return (F) (capturedType == null ? factory.invoke() : factory.invoke(captured));
+    } catch (Throwable throwable) {
+      throw new ReflexionException(throwable);
+    }
+  }
+
+  /**
+   * Get the most specific method type which is a specialization of the given interface method type and is adaptable
+   * to the given implementation type, as required by the lambda metafactory.
+   *
+   * @param samMethodType the erased type of the interface method.
+   * @param implType      the type of the implementation, without captured parameters.
+   * @return the instantiated method type to use for the interface method.
+   */
+  private static @NonNull MethodType instantiatedType(@NonNull MethodType samMethodType, @NonNull MethodType implType) {
+    Class<?>[] parameterTypes = new Class<?>[samMethodType.parameterCount()];
+    for (int i = 0; i < parameterTypes.length; i++) {
+      parameterTypes[i] = specialize(samMethodType.parameterType(i), implType.parameterType(i));
+    }
+
+    Class<?> returnType = samMethodType.returnType() == void.class
+      ? void.class
+      : specialize(samMethodType.returnType(), implType.returnType());
+    return MethodType.methodType(returnType, parameterTypes);
+  }
+
+  /**
+   * Specializes the given erased interface type to the given implementation type if possible.
+   *
+   * @param samType  the erased type used by the interface method.
+   * @param implType the type used by the implementation.
+   * @return the implementation type (boxed if primitive) if it is a subtype of the interface type, else the interface
+   * type.
+   */
+  private static @NonNull Class<?> specialize(@NonNull Class<?> samType, @NonNull Class<?> implType) {
+    if (samType.isPrimitive() || implType == void.class) {
+      return samType;
+    }
+
+    Class<?> boxedImplType = MethodType.methodType(implType).wrap().returnType();
+    return samType.isAssignableFrom(boxedImplType) ? boxedImplType : samType;
+  }
+
+  /**
+   * Finds the single abstract method of the given functional interface, ignoring abstract redeclarations of the
+   * public methods of {@code Object}.
+   *
+   * @param samType the functional interface to find the single abstract method of.
+   * @return the single abstract method of the given interface.
+   * @throws IllegalArgumentException if the given type is not a functional interface.
+   */
+  private static @NonNull Method findSam(@NonNull Class<?> samType) {
+    if (!samType.isInterface()) {
+      throw new IllegalArgumentException(samType.getName() + " is not an interface");
+    }
+
+    Method sam = null;
+    for (Method method : samType.getMethods()) {
+      if (!Modifier.isAbstract(method.getModifiers()) || isObjectMethod(method)) {
+        continue;
+      }
+
+      // the same method can be visible multiple times when redeclared in a sub interface
+      boolean sameSignature = sam != null
+        && sam.getName().equals(method.getName())
+        && Arrays.equals(sam.getParameterTypes(), method.getParameterTypes());
+      if (sam != null && !sameSignature) {
+        throw new IllegalArgumentException(samType.getName() + " is not a functional interface");
+      }
+      sam = method;
+    }
+
+    if (sam == null) {
+      throw new IllegalArgumentException(samType.getName() + " declares no abstract method");
+    }
+    return sam;
+  }
+
+  /**
+   * Checks if the given interface method is a redeclaration of a public method of {@code Object}.
+   *
+   * @param method the method to check.
+   * @return true if the given method redeclares a public method of object, false otherwise.
+   */
+  private static boolean isObjectMethod(@NonNull Method method) {
+    try {
+      Object.class.getMethod(method.getName(), method.getParameterTypes());
+      return true;
+    } catch (NoSuchMethodException exception) {
+      return false;
+    }
+  }
+
+  /**
+   * Get a lookup with full privileges in the given class, in which the interface implementation is defined.
+   *
+   * @param factory the accessor factory of the accessor to bind, its trusted lookup is preferred.
+   * @param host    the class in which the interface implementation should be defined.
+   * @return a lookup with full privileges in the given class.
+   * @throws ReflexionException if no trusted lookup is available.
+   */
+  private static @NonNull Lookup callerLookup(@NonNull AccessorFactory factory, @NonNull Class<?> host) {
+    Lookup trustedLookup = factory instanceof MethodHandleAccessorFactory
+      ? ((MethodHandleAccessorFactory) factory).lookup()
+      : null;
+    trustedLookup = Util.firstNonNull(trustedLookup, ImplLookupAccessor.findImplLookup());
+    if (trustedLookup == null) {
+      throw new ReflexionException("Binding functional interfaces requires the trusted lookup");
+    }
+    return trustedLookup.in(host);
+  }
+
+  /**
+   * Checks if the given type and all classes enclosing it are public.
+   *
+   * @param type the type to check.
+   * @return true if the given type is accessible from every class, false otherwise.
+   */
+  private static boolean isPublic(@NonNull Class<?> type) {
+    for (Class<?> current = type; current != null; current = current.getEnclosingClass()) {
+      if (!Modifier.isPublic(current.getModifiers())) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Capitalizes the first letter of the given primitive type name, for example {@code int} to {@code Int}.
+   *
+   * @param name the name to capitalize.
+   * @return the capitalized name.
+   */
+  private static @NonNull String capitalize(@NonNull String name) {
+    return Character.toUpperCase(name.charAt(0)) + name.substring(1);
+  }
+}
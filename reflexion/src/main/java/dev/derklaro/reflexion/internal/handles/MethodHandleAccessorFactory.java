@@ -31,7 +31,12 @@
 import dev.derklaro.reflexion.ReflexionException;
 import dev.derklaro.reflexion.Result;
 import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.bytecode.BytecodeAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.JniAccessorFactory;
 import dev.derklaro.reflexion.internal.natives.NativeAccessorFactory;
+import dev.derklaro.reflexion.internal.unsafe.UnsafeAccessorFactory;
+import dev.derklaro.reflexion.internal.util.Stats;
+import dev.derklaro.reflexion.internal.util.Util;
 import java.lang.invoke.MethodHandle;
 import java.lang.invoke.MethodHandles;
 import java.lang.invoke.MethodHandles.Lookup;
@@ -52,7 +57,7 @@
  */
 public class MethodHandleAccessorFactory implements AccessorFactory {
 
-  private final Lookup trustedLookup;
+  protected final Lookup trustedLookup;
 
   /**
    * Constructs a new method handle accessor factory instance.
@@ -77,15 +82,29 @@ public boolean isAvailable() {
    */
   @Override
   public @NonNull FieldAccessor wrapField(@NonNull Reflexion reflexion, @NonNull Field field) {
+    long start = Stats.ENABLED ? System.nanoTime() : 0L;
     try {
       boolean staticField = Modifier.isStatic(field.getModifiers());
 
-      MethodHandle getter = this.convertFieldToGeneric(field, staticField, false);
-      MethodHandle setter = this.convertFieldToGeneric(field, staticField, true);
+      MethodHandle rawGetter = this.findFieldHandle(field, staticField, false);
+      MethodHandle rawSetter = this.findFieldHandle(field, staticField, true);
 
-      return new MethodHandleFieldAccessor(field, reflexion, getter, setter);
+      return new MethodHandleFieldAccessor(
+        field,
+        reflexion,
+        rawGetter,
+        rawSetter,
+        this.convertFieldToGeneric(rawGetter, staticField, false),
+        this.convertFieldToGeneric(rawSetter, staticField, true),
+        // keep the exact field type for primitive access without boxing
+        this.convertFieldToExact(rawGetter, staticField),
+        this.convertFieldToExact(rawSetter, staticField));
     } catch (Exception exception) {
       throw new ReflexionException(exception);
+    } finally {
+      if (Stats.ENABLED) {
+        Stats.handlesBuilt(System.nanoTime() - start);
+      }
     }
   }
 
@@ -94,12 +113,22 @@ public boolean isAvailable() {
    */
   @Override
   public @NonNull MethodAccessor<Method> wrapMethod(@NonNull Reflexion reflexion, @NonNull Method method) {
+    long start = Stats.ENABLED ? System.nanoTime() : 0L;
     try {
       MethodHandle unreflected = this.trustedLookup.unreflect(method);
       boolean staticMethod = Modifier.isStatic(method.getModifiers());
-      return new MethodHandleMethodAccessor(method, reflexion, this.convertToGeneric(unreflected, staticMethod, false));
+      return new MethodHandleMethodAccessor(
+        method,
+        reflexion,
+        unreflected,
+        this.convertToGeneric(unreflected, staticMethod, false),
+        this.convertToFixedArity(unreflected, staticMethod, false));
     } catch (Exception exception) {
       throw new ReflexionException(exception);
+    } finally {
+      if (Stats.ENABLED) {
+        Stats.handlesBuilt(System.nanoTime() - start);
+      }
     }
   }
 
@@ -108,14 +137,34 @@ public boolean isAvailable() {
    */
   @Override
   public @NonNull MethodAccessor<Constructor<?>> wrapConstructor(@NonNull Reflexion rfx, @NonNull Constructor<?> ctr) {
+    long start = Stats.ENABLED ? System.nanoTime() : 0L;
     try {
       MethodHandle unreflected = this.trustedLookup.unreflectConstructor(ctr);
-      return new MethodHandleConstructorAccessor(ctr, rfx, this.convertToGeneric(unreflected, false, true));
+      return new MethodHandleConstructorAccessor(
+        ctr,
+        rfx,
+        unreflected,
+        this.convertToGeneric(unreflected, false, true),
+        this.convertToFixedArity(unreflected, false, true));
     } catch (Exception exception) {
       throw new ReflexionException(exception);
+    } finally {
+      if (Stats.ENABLED) {
+        Stats.handlesBuilt(System.nanoTime() - start);
+      }
     }
   }
 
+  /**
+   * Get the trusted lookup which is used by this factory to access members.
+   *
+   * @return the trusted lookup used by this factory, null if the lookup could not be resolved.
+   * @since 1.4
+   */
+  public final @Nullable Lookup lookup() {
+    return this.trustedLookup;
+  }
+
   /**
    * Gets the IMPL_LOOKUP field instance if possible. This method does not throw an exception but returns null if the
    * field is not accessible for some reason.
@@ -136,7 +185,7 @@ public boolean isAvailable() {
    * @return a generified version of the given method handle.
    * @throws NullPointerException if the given method handle is null.
    */
-  private @NonNull MethodHandle convertToGeneric(@NonNull MethodHandle handle, boolean staticMethod, boolean ctor) {
+  protected @NonNull MethodHandle convertToGeneric(@NonNull MethodHandle handle, boolean staticMethod, boolean ctor) {
     MethodHandle target = handle.asFixedArity();
     // special thing - we do not need the trailing array if we have 0 arguments anyway
     int paramCount = handle.type().parameterCount() - (ctor || staticMethod ? 0 : 1);
@@ -153,6 +202,31 @@ public boolean isAvailable() {
     return target.asType(methodType);
   }
 
+  /**
+   * Converts the given method handle to a generic handle which takes a leading instance argument followed by all
+   * arguments of the method (not spread into an array) and returns an object. For static methods and constructors
+   * the leading instance argument is present as well, but ignored. The returned handle can be called using
+   * {@code invokeExact} with a call site type consisting only of objects.
+   *
+   * @param handle       the handle to generify.
+   * @param staticMethod if the method wrapped by the given method handle is static.
+   * @param ctor         if the method wrapped by the given method handle is a constructor.
+   * @return a generified version of the given method handle, keeping the arity of the method.
+   * @throws NullPointerException if the given method handle is null.
+   */
+  protected @NonNull MethodHandle convertToFixedArity(
+    @NonNull MethodHandle handle,
+    boolean staticMethod,
+    boolean ctor
+  ) {
+    MethodHandle target = handle.asFixedArity();
+    // adds a leading 'this' argument which we can ignore
+    if (staticMethod || ctor) {
+      target = MethodHandles.dropArguments(target, 0, Object.class);
+    }
+    return target.asType(MethodType.genericMethodType(target.type().parameterCount()));
+  }
+
   /**
    * Converts the given field to a generic handle which can be invoked using an object and returns an object rather than
    * requiring exact class instances.
@@ -164,23 +238,29 @@ public boolean isAvailable() {
    * @throws Exception            if any exception occurs during the field unreflection.
    * @throws NullPointerException if the given field is null.
    */
-  private @NonNull MethodHandle convertFieldToGeneric(
+  protected @NonNull MethodHandle convertFieldToGeneric(
     @NonNull Field field,
     boolean staticField,
     boolean set
   ) throws Exception {
-    // we need to do this as unreflecting the field will cause java to throw exceptions when we access trusted final fields
-    MethodHandle handle;
-    if (staticField) {
-      handle = set
-        ? this.trustedLookup.findStaticSetter(field.getDeclaringClass(), field.getName(), field.getType())
-        : this.trustedLookup.findStaticGetter(field.getDeclaringClass(), field.getName(), field.getType());
-    } else {
-      handle = set
-        ? this.trustedLookup.findSetter(field.getDeclaringClass(), field.getName(), field.getType())
-        : this.trustedLookup.findGetter(field.getDeclaringClass(), field.getName(), field.getType());
-    }
+    return this.convertFieldToGeneric(this.findFieldHandle(field, staticField, set), staticField, set);
+  }
 
+  /**
+   * Converts the given field getter or setter handle to a generic handle which can be invoked using an object and
+   * returns an object rather than requiring exact class instances.
+   *
+   * @param handle      the getter or setter handle of the field, with the exact types of the field.
+   * @param staticField if the field accessed by the given handle is static.
+   * @param set         if the given handle is a setter for the field.
+   * @return a generified version of the given field handle.
+   * @throws NullPointerException if the given handle is null.
+   */
+  protected @NonNull MethodHandle convertFieldToGeneric(
+    @NonNull MethodHandle handle,
+    boolean staticField,
+    boolean set
+  ) {
     // generify the method type so that we don't need to worry about it when using the handles
     MethodType mt;
     if (staticField) {
@@ -194,21 +274,78 @@ public boolean isAvailable() {
     return handle.asType(mt);
   }
 
+  /**
+   * Converts the given field getter or setter handle to a handle which keeps the exact field type, but takes an object
+   * as the instance. For static fields the instance parameter is present as well, but ignored. The returned getter has
+   * the type {@code (Object)T}, the returned setter the type {@code (Object,T)void}.
+   *
+   * @param handle      the getter or setter handle of the field, with the exact types of the field.
+   * @param staticField if the field accessed by the given handle is static.
+   * @return a version of the given field handle which takes an object as the instance.
+   * @throws NullPointerException if the given handle is null.
+   */
+  protected @NonNull MethodHandle convertFieldToExact(@NonNull MethodHandle handle, boolean staticField) {
+    if (staticField) {
+      // add the leading instance parameter which gets ignored
+      return MethodHandles.dropArguments(handle, 0, Object.class);
+    } else {
+      // only generify the instance parameter
+      return handle.asType(handle.type().changeParameterType(0, Object.class));
+    }
+  }
+
+  /**
+   * Finds a getter or setter method handle for the given field using the trusted lookup.
+   *
+   * @param field       the field to find the handle for.
+   * @param staticField if the given field is static.
+   * @param set         if a setter handle should be looked up rather than a getter.
+   * @return the getter or setter for the given field with the exact types of the field.
+   * @throws Exception            if any exception occurs during the field lookup.
+   * @throws NullPointerException if the given field is null.
+   */
+  protected @NonNull MethodHandle findFieldHandle(
+    @NonNull Field field,
+    boolean staticField,
+    boolean set
+  ) throws Exception {
+    // we need to do this as unreflecting the field will cause java to throw exceptions when we access trusted final fields
+    if (staticField) {
+      return set
+        ? this.trustedLookup.findStaticSetter(field.getDeclaringClass(), field.getName(), field.getType())
+        : this.trustedLookup.findStaticGetter(field.getDeclaringClass(), field.getName(), field.getType());
+    } else {
+      return set
+        ? this.trustedLookup.findSetter(field.getDeclaringClass(), field.getName(), field.getType())
+        : this.trustedLookup.findGetter(field.getDeclaringClass(), field.getName(), field.getType());
+    }
+  }
+
   /**
    * {@inheritDoc}
    */
   @Override
   public int compareTo(@NonNull AccessorFactory o) {
+    // always prefer generated accessors over this one
+    if (o instanceof BytecodeAccessorFactory) {
+      return 1;
+    }
+
     // always prefer native over this one
     if (o instanceof NativeAccessorFactory) {
       return 1;
     }
 
-    // prefer the bare one over this one if we don't have the trusted lookup
-    if (o instanceof BareAccessorFactory) {
+    // prefer the bare and jni based ones over this one if we don't have the trusted lookup
+    if (o instanceof BareAccessorFactory || o instanceof JniAccessorFactory) {
       return this.trustedLookup != null ? -1 : 1;
     }
 
+    // the preference of the unsafe factory depends on the jvm version, let it decide
+    if (o instanceof UnsafeAccessorFactory) {
+      return -o.compareTo(this);
+    }
+
     // prefer the handle based accessor with the trusted lookup
     if (o instanceof MethodHandleAccessorFactory) {
       return this.trustedLookup != null ? -1 : ((MethodHandleAccessorFactory) o).trustedLookup != null ? 1 : 0;
@@ -228,22 +365,45 @@ private static final class MethodHandleFieldAccessor implements FieldAccessor {
     private final Field field;
     private final Reflexion reflexion;
 
+    private final MethodHandle rawGetter;
+    private final MethodHandle rawSetter;
+
     private final MethodHandle getter;
     private final MethodHandle setter;
 
+    private final MethodHandle exactGetter;
+    private final MethodHandle exactSetter;
+
     /**
      * Constructs a new method handle field accessor instance.
      *
-     * @param field     the field which is wrapped by the new accessor.
-     * @param reflexion the reflexion instance which produced the reflection lookup.
-     * @param getter    the getter method handle for the given field.
-     * @param setter    the setter method handle for the given field.
+     * @param field       the field which is wrapped by the new accessor.
+     * @param reflexion   the reflexion instance which produced the reflection lookup.
+     * @param rawGetter   the getter method handle for the given field, with the exact original type.
+     * @param rawSetter   the setter method handle for the given field, with the exact original type.
+     * @param getter      the getter method handle for the given field.
+     * @param setter      the setter method handle for the given field.
+     * @param exactGetter the getter method handle for the given field, returning the exact field type.
+     * @param exactSetter the setter method handle for the given field, taking the exact field type.
      */
-    public MethodHandleFieldAccessor(Field field, Reflexion reflexion, MethodHandle getter, MethodHandle setter) {
+    public MethodHandleFieldAccessor(
+      Field field,
+      Reflexion reflexion,
+      MethodHandle rawGetter,
+      MethodHandle rawSetter,
+      MethodHandle getter,
+      MethodHandle setter,
+      MethodHandle exactGetter,
+      MethodHandle exactSetter
+    ) {
       this.field = field;
       this.reflexion = reflexion;
+      this.rawGetter = rawGetter;
+      this.rawSetter = rawSetter;
       this.getter = getter;
       this.setter = setter;
+      this.exactGetter = exactGetter;
+      this.exactSetter = exactSetter;
     }
 
     /**
@@ -274,17 +434,8 @@ public MethodHandleFieldAccessor(Field field, Reflexion reflexion, MethodHandle
      * {@inheritDoc}
      */
     @Override
-    @SuppressWarnings("unchecked")
     public @NonNull <T> Result<T> getValue(@Nullable Object instance) {
-      return Result.tryExecute(() -> {
-        if (Modifier.isStatic(this.field.getModifiers())) {
-          // no need for the instance, ignore it
-          return (T) this.getter.invoke();
-        } else {
-          // we need to give the instance
-          return (T) this.getter.invoke(instance);
-        }
-      });
+      return Result.tryExecute(() -> this.getValueDirect(instance));
     }
 
     /**
@@ -301,6 +452,36 @@ public MethodHandleFieldAccessor(Field field, Reflexion reflexion, MethodHandle
     @Override
     public @NonNull Result<Void> setValue(@Nullable Object instance, @Nullable Object value) {
       return Result.tryExecute(() -> {
+        this.setValueDirect(instance, value);
+        return null;
+      });
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <T> T getValueDirect(@Nullable Object instance) {
+      try {
+        if (Modifier.isStatic(this.field.getModifiers())) {
+          // no need for the instance, ignore it
+          return (T) this.getter.invoke();
+        } else {
+          // we need to give the instance
+          return (T) this.getter.invoke(instance);
+        }
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setValueDirect(@Nullable Object instance, @Nullable Object value) {
+      try {
         if (Modifier.isStatic(this.field.getModifiers())) {
           // no need for the instance, ignore it
           this.setter.invoke(value);
@@ -308,8 +489,217 @@ public MethodHandleFieldAccessor(Field field, Reflexion reflexion, MethodHandle
           // we need to give the instance
           this.setter.invoke(instance, value);
         }
-        return null;
-      });
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int getInt(@Nullable Object instance) {
+      try {
+        return (int) this.exactGetter.invoke(instance);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setInt(@Nullable Object instance, int value) {
+      try {
+        this.exactSetter.invoke(instance, value);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public long getLong(@Nullable Object instance) {
+      try {
+        return (long) this.exactGetter.invoke(instance);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setLong(@Nullable Object instance, long value) {
+      try {
+        this.exactSetter.invoke(instance, value);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public double getDouble(@Nullable Object instance) {
+      try {
+        return (double) this.exactGetter.invoke(instance);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setDouble(@Nullable Object instance, double value) {
+      try {
+        this.exactSetter.invoke(instance, value);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public float getFloat(@Nullable Object instance) {
+      try {
+        return (float) this.exactGetter.invoke(instance);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setFloat(@Nullable Object instance, float value) {
+      try {
+        this.exactSetter.invoke(instance, value);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean getBoolean(@Nullable Object instance) {
+      try {
+        return (boolean) this.exactGetter.invoke(instance);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setBoolean(@Nullable Object instance, boolean value) {
+      try {
+        this.exactSetter.invoke(instance, value);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public byte getByte(@Nullable Object instance) {
+      try {
+        return (byte) this.exactGetter.invoke(instance);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setByte(@Nullable Object instance, byte value) {
+      try {
+        this.exactSetter.invoke(instance, value);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public short getShort(@Nullable Object instance) {
+      try {
+        return (short) this.exactGetter.invoke(instance);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setShort(@Nullable Object instance, short value) {
+      try {
+        this.exactSetter.invoke(instance, value);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public char getChar(@Nullable Object instance) {
+      try {
+        return (char) this.exactGetter.invoke(instance);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setChar(@Nullable Object instance, char value) {
+      try {
+        this.exactSetter.invoke(instance, value);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle getterHandle() {
+      return this.rawGetter;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle setterHandle() {
+      return this.rawSetter;
     }
   }
 
@@ -322,19 +712,31 @@ private static final class MethodHandleMethodAccessor implements MethodAccessor<
 
     private final Method method;
     private final Reflexion reflexion;
+    private final MethodHandle rawHandle;
     private final MethodHandle methodHandle;
+    private final MethodHandle fixedArityHandle;
 
     /**
      * Constructs a new method handle method accessor instance.
      *
-     * @param method       the method which is wrapped by this accessor.
-     * @param reflexion    the reflexion instance which produced the lookup call.
-     * @param methodHandle the method handle to get the method value.
+     * @param method           the method which is wrapped by this accessor.
+     * @param reflexion        the reflexion instance which produced the lookup call.
+     * @param rawHandle        the method handle with the exact original type of the wrapped member.
+     * @param methodHandle     the method handle to get the method value.
+     * @param fixedArityHandle the method handle to invoke the method without spreading the arguments.
      */
-    public MethodHandleMethodAccessor(Method method, Reflexion reflexion, MethodHandle methodHandle) {
+    public MethodHandleMethodAccessor(
+      Method method,
+      Reflexion reflexion,
+      MethodHandle rawHandle,
+      MethodHandle methodHandle,
+      MethodHandle fixedArityHandle
+    ) {
       this.method = method;
       this.reflexion = reflexion;
+      this.rawHandle = rawHandle;
       this.methodHandle = methodHandle;
+      this.fixedArityHandle = fixedArityHandle;
     }
 
     /**
@@ -365,9 +767,8 @@ public MethodHandleMethodAccessor(Method method, Reflexion reflexion, MethodHand
      * {@inheritDoc}
      */
     @Override
-    @SuppressWarnings("unchecked")
     public @NonNull <V> Result<V> invoke(@Nullable Object instance) {
-      return Result.tryExecute(() -> (V) this.methodHandle.invoke(instance));
+      return Result.tryExecute(() -> this.invokeDirect(instance));
     }
 
     /**
@@ -382,15 +783,150 @@ public MethodHandleMethodAccessor(Method method, Reflexion reflexion, MethodHand
      * {@inheritDoc}
      */
     @Override
-    @SuppressWarnings("unchecked")
     public @NonNull <V> Result<V> invoke(@Nullable Object instance, @NonNull Object... args) {
+      return Result.tryExecute(() -> this.invokeDirect(instance, args));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance) {
+      try {
+        return (V) this.methodHandle.invoke(instance);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
       // convert no-args actually to a no-args call
       if (args.length == 0) {
-        return this.invoke(instance);
-      } else {
-        return Result.tryExecute(() -> (V) this.methodHandle.invoke(instance, args));
+        return this.invokeDirect(instance);
+      }
+
+      try {
+        return (V) this.methodHandle.invoke(instance, args);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke0(@Nullable Object instance) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
       }
     }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke1(@Nullable Object instance, @Nullable Object arg1) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke2(@Nullable Object instance, @Nullable Object arg1, @Nullable Object arg2) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1, arg2);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke3(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3
+    ) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1, arg2, arg3);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke4(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3,
+      @Nullable Object arg4
+    ) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1, arg2, arg3, arg4);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke5(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3,
+      @Nullable Object arg4,
+      @Nullable Object arg5
+    ) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1, arg2, arg3, arg4, arg5);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle asMethodHandle() {
+      return this.rawHandle;
+    }
   }
 
   /**
@@ -402,19 +938,31 @@ private static final class MethodHandleConstructorAccessor implements MethodAcce
 
     private final Reflexion reflexion;
     private final Constructor<?> method;
+    private final MethodHandle rawHandle;
     private final MethodHandle methodHandle;
+    private final MethodHandle fixedArityHandle;
 
     /**
      * Constructs a new method handle constructor accessor instance.
      *
-     * @param method       the constructor which is wrapped by the accessor.
-     * @param reflexion    the reflexion instance which produced the reflection lookup call.
-     * @param methodHandle the method handle to invoke the constructor.
+     * @param method           the constructor which is wrapped by the accessor.
+     * @param reflexion        the reflexion instance which produced the reflection lookup call.
+     * @param rawHandle        the method handle with the exact original type of the wrapped member.
+     * @param methodHandle     the method handle to invoke the constructor.
+     * @param fixedArityHandle the method handle to invoke the method without spreading the arguments.
      */
-    public MethodHandleConstructorAccessor(Constructor<?> method, Reflexion reflexion, MethodHandle methodHandle) {
+    public MethodHandleConstructorAccessor(
+      Constructor<?> method,
+      Reflexion reflexion,
+      MethodHandle rawHandle,
+      MethodHandle methodHandle,
+      MethodHandle fixedArityHandle
+    ) {
       this.method = method;
       this.reflexion = reflexion;
+      this.rawHandle = rawHandle;
       this.methodHandle = methodHandle;
+      this.fixedArityHandle = fixedArityHandle;
     }
 
     /**
@@ -445,9 +993,8 @@ public MethodHandleConstructorAccessor(Constructor<?> method, Reflexion reflexio
      * {@inheritDoc}
      */
     @Override
-    @SuppressWarnings("unchecked")
     public @NonNull <V> Result<V> invoke(@Nullable Object instance) {
-      return Result.tryExecute(() -> (V) this.methodHandle.invoke());
+      return Result.tryExecute(() -> this.invokeDirect(instance));
     }
 
     /**
@@ -462,14 +1009,149 @@ public MethodHandleConstructorAccessor(Constructor<?> method, Reflexion reflexio
      * {@inheritDoc}
      */
     @Override
-    @SuppressWarnings("unchecked")
     public @NonNull <V> Result<V> invoke(@Nullable Object instance, @NotNull @NonNull Object... args) {
+      return Result.tryExecute(() -> this.invokeDirect(instance, args));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance) {
+      try {
+        return (V) this.methodHandle.invoke();
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
       // convert no args calls back to an actual no-args invocation
       if (args.length == 0) {
-        return this.invoke(null);
-      } else {
-        return Result.tryExecute(() -> (V) this.methodHandle.invoke(args));
+        return this.invokeDirect(null);
+      }
+
+      try {
+        return (V) this.methodHandle.invoke(args);
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke0(@Nullable Object instance) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
       }
     }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke1(@Nullable Object instance, @Nullable Object arg1) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke2(@Nullable Object instance, @Nullable Object arg1, @Nullable Object arg2) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1, arg2);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke3(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3
+    ) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1, arg2, arg3);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke4(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3,
+      @Nullable Object arg4
+    ) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1, arg2, arg3, arg4);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invoke5(
+      @Nullable Object instance,
+      @Nullable Object arg1,
+      @Nullable Object arg2,
+      @Nullable Object arg3,
+      @Nullable Object arg4,
+      @Nullable Object arg5
+    ) {
+      try {
+        Object result = this.fixedArityHandle.invokeExact(instance, arg1, arg2, arg3, arg4, arg5);
+        return (V) result;
+      } catch (Throwable throwable) {
+        throw Util.throwUnchecked(throwable);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle asMethodHandle() {
+      return this.rawHandle;
+    }
   }
 }
@@ -24,8 +24,17 @@
 
 package dev.derklaro.reflexion.internal.natives;
 
+import java.lang.reflect.Executable;
+import java.lang.reflect.Field;
+
 /**
- * The bridge to the native library bundled in this library to access the IMPL_LOOKUP field.
+ * The bridge to the native library bundled in this library to access the IMPL_LOOKUP field and to access fields,
+ * methods and constructors using jni.
+ * <p>
+ * The jni entry points do not validate their arguments, passing an instance which is not an instance of the declaring
+ * class of a member, a value which is not assignable to a field or parameter, or null as the instance of an instance
+ * member corrupts the jvm. All arguments must be validated by the caller. The static member is accessed if the given
+ * instance is null. Primitive values which are passed as raw bits are encoded as described in {@link NativeValues}.
  *
  * @since 1.0
  */
@@ -33,5 +42,68 @@ final class FNativeReflect {
 
   // CHECKSTYLE.OFF: Must match native naming
   public static native Object GetImplLookup();
+
+  public static native long FieldId(Field field);
+
+  public static native long MethodId(Executable executable);
+
+  public static native boolean GetBooleanField(Object instance, Class<?> owner, long fieldId);
+
+  public static native void SetBooleanField(Object instance, Class<?> owner, long fieldId, boolean value);
+
+  public static native byte GetByteField(Object instance, Class<?> owner, long fieldId);
+
+  public static native void SetByteField(Object instance, Class<?> owner, long fieldId, byte value);
+
+  public static native char GetCharField(Object instance, Class<?> owner, long fieldId);
+
+  public static native void SetCharField(Object instance, Class<?> owner, long fieldId, char value);
+
+  public static native short GetShortField(Object instance, Class<?> owner, long fieldId);
+
+  public static native void SetShortField(Object instance, Class<?> owner, long fieldId, short value);
+
+  public static native int GetIntField(Object instance, Class<?> owner, long fieldId);
+
+  public static native void SetIntField(Object instance, Class<?> owner, long fieldId, int value);
+
+  public static native long GetLongField(Object instance, Class<?> owner, long fieldId);
+
+  public static native void SetLongField(Object instance, Class<?> owner, long fieldId, long value);
+
+  public static native float GetFloatField(Object instance, Class<?> owner, long fieldId);
+
+  public static native void SetFloatField(Object instance, Class<?> owner, long fieldId, float value);
+
+  public static native double GetDoubleField(Object instance, Class<?> owner, long fieldId);
+
+  public static native void SetDoubleField(Object instance, Class<?> owner, long fieldId, double value);
+
+  public static native Object GetObjectField(Object instance, Class<?> owner, long fieldId);
+
+  public static native void SetObjectField(Object instance, Class<?> owner, long fieldId, Object value);
+
+  public static native void ReadFields(Object instance, long[] fieldIds, byte[] kinds, long[] out);
+
+  public static native Object CallObjectMethod(
+    Object instance,
+    Class<?> owner,
+    long methodId,
+    byte[] kinds,
+    Object[] args,
+    long[] prims
+  );
+
+  public static native long CallPrimitiveMethod(
+    Object instance,
+    Class<?> owner,
+    long methodId,
+    byte returnKind,
+    byte[] kinds,
+    Object[] args,
+    long[] prims
+  );
+
+  public static native Object NewObject(Class<?> owner, long methodId, byte[] kinds, Object[] args, long[] prims);
   // CHECKSTYLE.ON
 }
@@ -0,0 +1,921 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.natives;
+
+import dev.derklaro.reflexion.AccessorFactory;
+import dev.derklaro.reflexion.FieldAccessor;
+import dev.derklaro.reflexion.MethodAccessor;
+import dev.derklaro.reflexion.Reflexion;
+import dev.derklaro.reflexion.ReflexionException;
+import dev.derklaro.reflexion.Result;
+import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Executable;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * An accessor factory which accesses fields, methods and constructors through jni using the native library bundled
+ * with reflexion. The jni ids of the members are resolved once when an accessor is created. Reading and writing
+ * primitive fields uses the typed jni functions without boxing. Unlike the method handle based factories this factory
+ * neither requires the IMPL_LOOKUP nor the ability to make members accessible, which makes it the preferred fallback
+ * on jvms on which both are restricted. Jni does not perform access checks, final fields can be written as well.
+ * <p>
+ * All arguments are validated before passing them to the native code, as invalid arguments would corrupt the jvm. The
+ * declaring class of a static member is initialized when the member is wrapped.
+ *
+ * @since 1.4
+ */
+public final class JniAccessorFactory implements AccessorFactory {
+
+  private static final Object[] NO_ARGS = new Object[0];
+  private static final boolean NATIVE_AVAILABLE = probeNative();
+
+  private static final MethodHandle GET_VALUE;
+  private static final MethodHandle SET_VALUE;
+  private static final MethodHandle INVOKE;
+
+  static {
+    try {
+      MethodHandles.Lookup lookup = MethodHandles.lookup();
+      GET_VALUE = lookup.findVirtual(
+        JniFieldAccessor.class,
+        "getValueDirect",
+        MethodType.methodType(Object.class, Object.class));
+      SET_VALUE = lookup.findVirtual(
+        JniFieldAccessor.class,
+        "setValueDirect",
+        MethodType.methodType(void.class, Object.class, Object.class));
+      INVOKE = lookup.findVirtual(
+        JniExecutableAccessor.class,
+        "invokeDirect",
+        MethodType.methodType(Object.class, Object.class, Object[].class)).asFixedArity();
+    } catch (NoSuchMethodException | IllegalAccessException exception) {
+      throw new ExceptionInInitializerError(exception);
+    }
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public boolean isAvailable() {
+    return NATIVE_AVAILABLE;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull FieldAccessor wrapField(@NonNull Reflexion reflexion, @NonNull Field field) {
+    checkAvailable();
+    try {
+      boolean staticField = Modifier.isStatic(field.getModifiers());
+      if (staticField) {
+        ensureInitialized(field.getDeclaringClass());
+      }
+      return new JniFieldAccessor(field, reflexion, FNativeReflect.FieldId(field), staticField);
+    } catch (ReflexionException exception) {
+      throw exception;
+    } catch (Exception | LinkageError exception) {
+      throw new ReflexionException(exception);
+    }
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull MethodAccessor<Method> wrapMethod(@NonNull Reflexion reflexion, @NonNull Method method) {
+    checkAvailable();
+    try {
+      boolean staticMethod = Modifier.isStatic(method.getModifiers());
+      if (staticMethod) {
+        ensureInitialized(method.getDeclaringClass());
+      }
+      return new JniMethodAccessor(method, reflexion, FNativeReflect.MethodId(method), staticMethod);
+    } catch (ReflexionException exception) {
+      throw exception;
+    } catch (Exception | LinkageError exception) {
+      throw new ReflexionException(exception);
+    }
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull MethodAccessor<Constructor<?>> wrapConstructor(@NonNull Reflexion rfx, @NonNull Constructor<?> ctr) {
+    checkAvailable();
+    try {
+      return new JniConstructorAccessor(ctr, rfx, FNativeReflect.MethodId(ctr));
+    } catch (ReflexionException exception) {
+      throw exception;
+    } catch (Exception | LinkageError exception) {
+      throw new ReflexionException(exception);
+    }
+  }
+
+  /**
+   * Compiles a batch which reads the given primitive instance fields of instances of the given type in a single jni
+   * transition, spreading the cost of the transition across all fields in the batch.
+   *
+   * @param type   the type of the instances to read the fields of.
+   * @param fields the fields to read, all must be primitive instance fields declared by the given type or a super type.
+   * @return a batch reading the given fields.
+   * @throws NullPointerException     if the given type, field array or an element of it is null.
+   * @throws IllegalArgumentException if one of the given fields is static, not primitive or not a field of the type.
+   * @throws ReflexionException       if the native library is not available or a field id can't be resolved.
+   */
+  public @NonNull NativeFieldBatch compileBatch(@NonNull Class<?> type, @NonNull Field... fields) {
+    checkAvailable();
+
+    long[] fieldIds = new long[fields.length];
+    byte[] kinds = new byte[fields.length];
+    for (int i = 0; i < fields.length; i++) {
+      Field field = fields[i];
+      if (Modifier.isStatic(field.getModifiers()) || !field.getType().isPrimitive()) {
+        throw new IllegalArgumentException("Field " + field + " is not a primitive instance field");
+      }
+      if (!field.getDeclaringClass().isAssignableFrom(type)) {
+        throw new IllegalArgumentException("Field " + field + " is not a field of " + type);
+      }
+
+      fieldIds[i] = FNativeReflect.FieldId(field);
+      kinds[i] = NativeValues.kindOf(field.getType());
+    }
+    return new NativeFieldBatch(type, fields.clone(), fieldIds, kinds);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public int compareTo(@NonNull AccessorFactory o) {
+    // no preference between two instances of this factory
+    if (o instanceof JniAccessorFactory) {
+      return 0;
+    }
+
+    // prefer this one over plain reflection if the native library is available
+    if (o instanceof BareAccessorFactory) {
+      return NATIVE_AVAILABLE ? -1 : 1;
+    }
+
+    // prefer all other factories, they don't need to cross the jni boundary for each access
+    return 1;
+  }
+
+  /**
+   * Ensures that the native library is loaded and provides the jni entry points of this factory.
+   *
+   * @throws ReflexionException if the native library is not available.
+   */
+  private static void checkAvailable() {
+    if (!NATIVE_AVAILABLE) {
+      throw new ReflexionException("The reflexion native library is not available");
+    }
+  }
+
+  /**
+   * Initializes the given class if it wasn't initialized before. Static members are accessed via jni using the
+   * resolved member ids, which (unlike resolving the member by its name) does not initialize the declaring class.
+   *
+   * @param type the class to initialize.
+   * @throws ClassNotFoundException if the given class can't be resolved through its own class loader.
+   */
+  private static void ensureInitialized(@NonNull Class<?> type) throws ClassNotFoundException {
+    Class.forName(type.getName(), true, type.getClassLoader());
+  }
+
+  /**
+   * Loads the native library and checks that it provides the jni entry points used by this factory, which might not be
+   * the case if an outdated version of the library was loaded.
+   *
+   * @return true if the native library is available, false otherwise.
+   */
+  private static boolean probeNative() {
+    if (!NativeLibLoader.tryLoadNative()) {
+      return false;
+    }
+
+    try {
+      return FNativeReflect.FieldId(JniAccessorFactory.class.getDeclaredField("NO_ARGS")) != 0;
+    } catch (Throwable throwable) {
+      return false;
+    }
+  }
+
+  /**
+   * A field accessor which reads and writes the field using the typed jni field functions.
+   *
+   * @since 1.4
+   */
+  private static final class JniFieldAccessor implements FieldAccessor {
+
+    private final Field field;
+    private final Reflexion reflexion;
+
+    private final Class<?> owner;
+    private final Class<?> type;
+    private final long fieldId;
+    private final byte kind;
+    private final boolean staticField;
+
+    /**
+     * Constructs a new jni field accessor instance.
+     *
+     * @param field       the field to wrap.
+     * @param reflexion   the reflexion instance which produced this instance.
+     * @param fieldId     the resolved jni id of the field.
+     * @param staticField if the field is static.
+     */
+    public JniFieldAccessor(Field field, Reflexion reflexion, long fieldId, boolean staticField) {
+      this.field = field;
+      this.reflexion = reflexion;
+      this.owner = field.getDeclaringClass();
+      this.type = field.getType();
+      this.fieldId = fieldId;
+      this.kind = NativeValues.kindOf(this.type);
+      this.staticField = staticField;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Field getMember() {
+      return this.field;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Reflexion getReflexion() {
+      return this.reflexion;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <T> Result<T> getValue() {
+      return this.getValue(this.staticField ? null : this.reflexion.getBinding());
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <T> Result<T> getValue(@Nullable Object instance) {
+      return Result.tryExecute(() -> this.getValueDirect(instance));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Result<Void> setValue(@Nullable Object value) {
+      return this.setValue(this.staticField ? null : this.reflexion.getBinding(), value);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Result<Void> setValue(@Nullable Object instance, @Nullable Object value) {
+      return Result.tryExecute(() -> {
+        this.setValueDirect(instance, value);
+        return null;
+      });
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <T> T getValueDirect(@Nullable Object instance) {
+      Object target = this.target(instance);
+      switch (this.kind) {
+        case NativeValues.BOOLEAN:
+          return (T) Boolean.valueOf(FNativeReflect.GetBooleanField(target, this.owner, this.fieldId));
+        case NativeValues.BYTE:
+          return (T) Byte.valueOf(FNativeReflect.GetByteField(target, this.owner, this.fieldId));
+        case NativeValues.CHAR:
+          return (T) Character.valueOf(FNativeReflect.GetCharField(target, this.owner, this.fieldId));
+        case NativeValues.SHORT:
+          return (T) Short.valueOf(FNativeReflect.GetShortField(target, this.owner, this.fieldId));
+        case NativeValues.INT:
+          return (T) Integer.valueOf(FNativeReflect.GetIntField(target, this.owner, this.fieldId));
+        case NativeValues.LONG:
+          return (T) Long.valueOf(FNativeReflect.GetLongField(target, this.owner, this.fieldId));
+        case NativeValues.FLOAT:
+          return (T) Float.valueOf(FNativeReflect.GetFloatField(target, this.owner, this.fieldId));
+        case NativeValues.DOUBLE:
+          return (T) Double.valueOf(FNativeReflect.GetDoubleField(target, this.owner, this.fieldId));
+        default:
+          return (T) FNativeReflect.GetObjectField(target, this.owner, this.fieldId);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setValueDirect(@Nullable Object instance, @Nullable Object value) {
+      Object target = this.target(instance);
+      if (this.kind != NativeValues.REFERENCE) {
+        this.setRaw(target, NativeValues.toRaw(this.kind, value));
+        return;
+      }
+
+      FNativeReflect.SetObjectField(target, this.owner, this.fieldId, Util.checkFieldValue(this.field, value));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int getInt(@Nullable Object instance) {
+      if (this.kind == NativeValues.INT) {
+        return FNativeReflect.GetIntField(this.target(instance), this.owner, this.fieldId);
+      }
+      return (int) NativeValues.toRaw(NativeValues.INT, this.getValueDirect(instance));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setInt(@Nullable Object instance, int value) {
+      if (this.kind == NativeValues.INT) {
+        FNativeReflect.SetIntField(this.target(instance), this.owner, this.fieldId, value);
+      } else {
+        this.setValueDirect(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public long getLong(@Nullable Object instance) {
+      if (this.kind == NativeValues.LONG) {
+        return FNativeReflect.GetLongField(this.target(instance), this.owner, this.fieldId);
+      }
+      return NativeValues.toRaw(NativeValues.LONG, this.getValueDirect(instance));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setLong(@Nullable Object instance, long value) {
+      if (this.kind == NativeValues.LONG) {
+        FNativeReflect.SetLongField(this.target(instance), this.owner, this.fieldId, value);
+      } else {
+        this.setValueDirect(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public double getDouble(@Nullable Object instance) {
+      if (this.kind == NativeValues.DOUBLE) {
+        return FNativeReflect.GetDoubleField(this.target(instance), this.owner, this.fieldId);
+      }
+      return Double.longBitsToDouble(NativeValues.toRaw(NativeValues.DOUBLE, this.getValueDirect(instance)));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setDouble(@Nullable Object instance, double value) {
+      if (this.kind == NativeValues.DOUBLE) {
+        FNativeReflect.SetDoubleField(this.target(instance), this.owner, this.fieldId, value);
+      } else {
+        this.setValueDirect(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public float getFloat(@Nullable Object instance) {
+      if (this.kind == NativeValues.FLOAT) {
+        return FNativeReflect.GetFloatField(this.target(instance), this.owner, this.fieldId);
+      }
+      return Float.intBitsToFloat((int) NativeValues.toRaw(NativeValues.FLOAT, this.getValueDirect(instance)));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setFloat(@Nullable Object instance, float value) {
+      if (this.kind == NativeValues.FLOAT) {
+        FNativeReflect.SetFloatField(this.target(instance), this.owner, this.fieldId, value);
+      } else {
+        this.setValueDirect(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean getBoolean(@Nullable Object instance) {
+      if (this.kind == NativeValues.BOOLEAN) {
+        return FNativeReflect.GetBooleanField(this.target(instance), this.owner, this.fieldId);
+      }
+      return NativeValues.toRaw(NativeValues.BOOLEAN, this.getValueDirect(instance)) != 0;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setBoolean(@Nullable Object instance, boolean value) {
+      if (this.kind == NativeValues.BOOLEAN) {
+        FNativeReflect.SetBooleanField(this.target(instance), this.owner, this.fieldId, value);
+      } else {
+        this.setValueDirect(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public byte getByte(@Nullable Object instance) {
+      if (this.kind == NativeValues.BYTE) {
+        return FNativeReflect.GetByteField(this.target(instance), this.owner, this.fieldId);
+      }
+      return (byte) NativeValues.toRaw(NativeValues.BYTE, this.getValueDirect(instance));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setByte(@Nullable Object instance, byte value) {
+      if (this.kind == NativeValues.BYTE) {
+        FNativeReflect.SetByteField(this.target(instance), this.owner, this.fieldId, value);
+      } else {
+        this.setValueDirect(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public short getShort(@Nullable Object instance) {
+      if (this.kind == NativeValues.SHORT) {
+        return FNativeReflect.GetShortField(this.target(instance), this.owner, this.fieldId);
+      }
+      return (short) NativeValues.toRaw(NativeValues.SHORT, this.getValueDirect(instance));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setShort(@Nullable Object instance, short value) {
+      if (this.kind == NativeValues.SHORT) {
+        FNativeReflect.SetShortField(this.target(instance), this.owner, this.fieldId, value);
+      } else {
+        this.setValueDirect(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public char getChar(@Nullable Object instance) {
+      if (this.kind == NativeValues.CHAR) {
+        return FNativeReflect.GetCharField(this.target(instance), this.owner, this.fieldId);
+      }
+      return (char) NativeValues.toRaw(NativeValues.CHAR, this.getValueDirect(instance));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setChar(@Nullable Object instance, char value) {
+      if (this.kind == NativeValues.CHAR) {
+        FNativeReflect.SetCharField(this.target(instance), this.owner, this.fieldId, value);
+      } else {
+        this.setValueDirect(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle getterHandle() {
+      MethodHandle getter = GET_VALUE.bindTo(this);
+      if (this.staticField) {
+        return MethodHandles.insertArguments(getter, 0, (Object) null).asType(MethodType.methodType(this.type));
+      }
+      return getter.asType(MethodType.methodType(this.type, this.owner));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle setterHandle() {
+      MethodHandle setter = SET_VALUE.bindTo(this);
+      if (this.staticField) {
+        MethodHandle staticSetter = MethodHandles.insertArguments(setter, 0, (Object) null);
+        return staticSetter.asType(MethodType.methodType(void.class, this.type));
+      }
+      return setter.asType(MethodType.methodType(void.class, this.owner, this.type));
+    }
+
+    /**
+     * Get the instance to pass to the native code, validating that the given instance is an instance of the declaring
+     * class of the field if the field is not static.
+     *
+     * @param instance the instance given by the caller.
+     * @return the instance to pass to the native code, null for static fields.
+     * @throws NullPointerException     if the field is not static and the given instance is null.
+     * @throws IllegalArgumentException if the field is not static and the given instance has the wrong type.
+     */
+    private @Nullable Object target(@Nullable Object instance) {
+      return this.staticField ? null : Util.checkInstance(this.field, this.owner, instance);
+    }
+
+    /**
+     * Writes the given raw bits into the primitive field.
+     *
+     * @param target the instance to write the field of, null for static fields.
+     * @param raw    the raw bits of the value to write.
+     */
+    private void setRaw(@Nullable Object target, long raw) {
+      switch (this.kind) {
+        case NativeValues.BOOLEAN:
+          FNativeReflect.SetBooleanField(target, this.owner, this.fieldId, raw != 0);
+          break;
+        case NativeValues.BYTE:
+          FNativeReflect.SetByteField(target, this.owner, this.fieldId, (byte) raw);
+          break;
+        case NativeValues.CHAR:
+          FNativeReflect.SetCharField(target, this.owner, this.fieldId, (char) raw);
+          break;
+        case NativeValues.SHORT:
+          FNativeReflect.SetShortField(target, this.owner, this.fieldId, (short) raw);
+          break;
+        case NativeValues.INT:
+          FNativeReflect.SetIntField(target, this.owner, this.fieldId, (int) raw);
+          break;
+        case NativeValues.LONG:
+          FNativeReflect.SetLongField(target, this.owner, this.fieldId, raw);
+          break;
+        case NativeValues.FLOAT:
+          FNativeReflect.SetFloatField(target, this.owner, this.fieldId, Float.intBitsToFloat((int) raw));
+          break;
+        default:
+          FNativeReflect.SetDoubleField(target, this.owner, this.fieldId, Double.longBitsToDouble(raw));
+          break;
+      }
+    }
+  }
+
+  /**
+   * The base of the accessors which invoke methods and constructors through jni, validating and converting the
+   * arguments of the invocation.
+   *
+   * @param <T> the type of the wrapped executable.
+   * @since 1.4
+   */
+  private abstract static class JniExecutableAccessor<T extends Executable> implements MethodAccessor<T> {
+
+    protected final T executable;
+    protected final Reflexion reflexion;
+
+    protected final Class<?> owner;
+    protected final long methodId;
+    protected final Class<?>[] parameterTypes;
+    protected final byte[] parameterKinds;
+    private final boolean primitiveParameters;
+
+    /**
+     * Constructs a new jni executable accessor instance.
+     *
+     * @param executable the executable to wrap.
+     * @param reflexion  the reflexion instance which produced this instance.
+     * @param methodId   the resolved jni id of the executable.
+     */
+    protected JniExecutableAccessor(T executable, Reflexion reflexion, long methodId) {
+      this.executable = executable;
+      this.reflexion = reflexion;
+      this.owner = executable.getDeclaringClass();
+      this.methodId = methodId;
+      this.parameterTypes = executable.getParameterTypes();
+      this.parameterKinds = NativeValues.kindsOf(this.parameterTypes);
+
+      boolean primitiveParameters = false;
+      for (Class<?> parameterType : this.parameterTypes) {
+        primitiveParameters |= parameterType.isPrimitive();
+      }
+      this.primitiveParameters = primitiveParameters;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull T getMember() {
+      return this.executable;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Reflexion getReflexion() {
+      return this.reflexion;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public <V> V invokeDirect(@Nullable Object instance) {
+      return this.invokeDirect(instance, NO_ARGS);
+    }
+
+    /**
+     * Validates the given arguments and converts the primitive arguments into their raw bits.
+     *
+     * @param args the arguments given by the caller.
+     * @return the raw bits of the primitive arguments indexed by their position, null if no parameter is primitive.
+     * @throws IllegalArgumentException if the amount or type of the given arguments doesn't match the parameters.
+     */
+    protected long @Nullable [] convertArguments(@NonNull Object[] args) {
+      if (args.length != this.parameterTypes.length) {
+        throw new IllegalArgumentException(
+          "Wrong number of arguments: expected " + this.parameterTypes.length + ", got " + args.length);
+      }
+
+      long[] prims = this.primitiveParameters ? new long[args.length] : null;
+      for (int i = 0; i < args.length; i++) {
+        Object arg = args[i];
+        byte kind = this.parameterKinds[i];
+        if (kind != NativeValues.REFERENCE) {
+          prims[i] = NativeValues.toRaw(kind, arg);
+        } else if (arg != null && !this.parameterTypes[i].isInstance(arg)) {
+          // passing an argument of another type to jni would corrupt the jvm
+          throw new IllegalArgumentException("Argument type mismatch at index " + i + ": " + arg.getClass().getName());
+        }
+      }
+      return prims;
+    }
+
+    /**
+     * Creates a method handle which invokes this accessor and has the given type.
+     *
+     * @param type          the type of the handle to create.
+     * @param withoutTarget if the invocation doesn't need an instance, the first parameter is the instance otherwise.
+     * @return a method handle invoking this accessor.
+     */
+    protected @NonNull MethodHandle invokerHandle(@NonNull MethodType type, boolean withoutTarget) {
+      MethodHandle invoker = INVOKE.bindTo(this);
+      if (withoutTarget) {
+        invoker = MethodHandles.insertArguments(invoker, 0, (Object) null);
+      }
+      return invoker.asCollector(Object[].class, this.parameterTypes.length).asType(type);
+    }
+  }
+
+  /**
+   * A method accessor which invokes the method using the typed jni call functions.
+   *
+   * @since 1.4
+   */
+  private static final class JniMethodAccessor extends JniExecutableAccessor<Method> {
+
+    private final byte returnKind;
+    private final boolean staticMethod;
+
+    /**
+     * Constructs a new jni method accessor instance.
+     *
+     * @param method       the method to wrap.
+     * @param reflexion    the reflexion instance which produced this instance.
+     * @param methodId     the resolved jni id of the method.
+     * @param staticMethod if the method is static.
+     */
+    public JniMethodAccessor(Method method, Reflexion reflexion, long methodId, boolean staticMethod) {
+      super(method, reflexion, methodId);
+      this.returnKind = NativeValues.kindOf(method.getReturnType());
+      this.staticMethod = staticMethod;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke() {
+      return this.invoke(this.staticMethod ? null : this.reflexion.getBinding());
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke(@Nullable Object instance) {
+      return Result.tryExecute(() -> this.invokeDirect(instance, NO_ARGS));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invokeWithArgs(@NonNull Object... args) {
+      return this.invoke(this.reflexion.getBinding(), args);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke(@Nullable Object instance, @NonNull Object... args) {
+      return Result.tryExecute(() -> this.invokeDirect(instance, args));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
+      long[] prims = this.convertArguments(args);
+      Object target = this.target(instance);
+      if (this.returnKind == NativeValues.REFERENCE) {
+        return (V) FNativeReflect.CallObjectMethod(
+          target,
+          this.owner,
+          this.methodId,
+          this.parameterKinds,
+          args,
+          prims);
+      }
+
+      // the exception thrown by the method (if any) is rethrown as-is when returning from the native call
+      long result = FNativeReflect.CallPrimitiveMethod(
+        target,
+        this.owner,
+        this.methodId,
+        this.returnKind,
+        this.parameterKinds,
+        args,
+        prims);
+      return (V) NativeValues.fromRaw(this.returnKind, result);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle asMethodHandle() {
+      MethodType type = MethodType.methodType(this.executable.getReturnType(), this.parameterTypes);
+      if (this.staticMethod) {
+        return this.invokerHandle(type, true);
+      }
+      return this.invokerHandle(type.insertParameterTypes(0, this.owner), false);
+    }
+
+    /**
+     * Get the instance to pass to the native code, validating that the given instance is an instance of the declaring
+     * class of the method if the method is not static.
+     *
+     * @param instance the instance given by the caller.
+     * @return the instance to pass to the native code, null for static methods.
+     * @throws NullPointerException     if the method is not static and the given instance is null.
+     * @throws IllegalArgumentException if the method is not static and the given instance has the wrong type.
+     */
+    private @Nullable Object target(@Nullable Object instance) {
+      return this.staticMethod ? null : Util.checkInstance(this.executable, this.owner, instance);
+    }
+  }
+
+  /**
+   * A constructor accessor which constructs new instances using the jni object construction function.
+   *
+   * @since 1.4
+   */
+  private static final class JniConstructorAccessor extends JniExecutableAccessor<Constructor<?>> {
+
+    /**
+     * Constructs a new jni constructor accessor instance.
+     *
+     * @param constructor the constructor to wrap.
+     * @param reflexion   the reflexion instance which produced this instance.
+     * @param methodId    the resolved jni id of the constructor.
+     */
+    public JniConstructorAccessor(Constructor<?> constructor, Reflexion reflexion, long methodId) {
+      super(constructor, reflexion, methodId);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke() {
+      return Result.tryExecute(() -> this.invokeDirect(null, NO_ARGS));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke(@Nullable Object instance) {
+      return this.invoke();
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invokeWithArgs(@NonNull Object... args) {
+      return Result.tryExecute(() -> this.invokeDirect(null, args));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <V> Result<V> invoke(@Nullable Object instance, @NonNull Object... args) {
+      return this.invokeWithArgs(args);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <V> V invokeDirect(@Nullable Object instance, @NonNull Object... args) {
+      // jni would happily construct a new enum constant
+      if (this.owner.isEnum()) {
+        throw new IllegalArgumentException("Cannot reflectively create enum objects");
+      }
+      // jni would allocate an instance of the abstract class, throw the same exception as constructor.newInstance
+      if (Modifier.isAbstract(this.owner.getModifiers())) {
+        throw Util.throwUnchecked(new InstantiationException(this.owner.getName()));
+      }
+
+      // the exception thrown by the constructor (if any) is rethrown as-is when returning from the native call
+      long[] prims = this.convertArguments(args);
+      return (V) FNativeReflect.NewObject(this.owner, this.methodId, this.parameterKinds, args, prims);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle asMethodHandle() {
+      return this.invokerHandle(MethodType.methodType(this.owner, this.parameterTypes), true);
+    }
+  }
+}
@@ -37,6 +37,7 @@
 public final class NativeAccessorFactory extends MethodHandleAccessorFactory {
 
   private static final boolean NATIVE_LOADED = NativeLibLoader.tryLoadNative();
+  private static final Lookup NATIVE_LOOKUP = resolveNativeLookup();
 
   /**
    * {@inheritDoc}
@@ -54,6 +55,15 @@ public boolean isAvailable() {
    */
   @Override
   protected @Nullable Lookup getTrustedLookup() {
+    return NATIVE_LOOKUP;
+  }
+
+  /**
+   * Resolves the IMPL_LOOKUP using the native library. This is only done once per jvm when this class is initialized.
+   *
+   * @return the IMPL_LOOKUP resolved by the native library, null if the library is not loaded or the lookup failed.
+   */
+  private static @Nullable Lookup resolveNativeLookup() {
     try {
       // ensure that we were able to load the native library before trying anything
       return NATIVE_LOADED ? (Lookup) FNativeReflect.GetImplLookup() : null;
@@ -0,0 +1,115 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.natives;
+
+import java.lang.reflect.Field;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.List;
+import lombok.NonNull;
+import org.jetbrains.annotations.Unmodifiable;
+
+/**
+ * A batch of primitive instance fields which are read from an object in a single jni transition, spreading the cost of
+ * crossing the jni boundary across all fields of the batch. Batches are compiled using
+ * {@link JniAccessorFactory#compileBatch(Class, Field...)}.
+ * <p>
+ * The values are written into a long array as raw bits: integral values (including booleans as 0 or 1 and chars) are
+ * widened to a long, floats are stored as their raw int bits (decode using {@code Float.intBitsToFloat((int) raw)})
+ * and doubles as their raw long bits (decode using {@code Double.longBitsToDouble(raw)}).
+ * <p>
+ * Instances of this class are immutable and can be shared freely between threads.
+ *
+ * @since 1.4
+ */
+public final class NativeFieldBatch {
+
+  private final Class<?> type;
+  private final Field[] fields;
+  private final long[] fieldIds;
+  private final byte[] kinds;
+
+  /**
+   * Constructs a new native field batch.
+   *
+   * @param type     the type of the instances to read the fields of.
+   * @param fields   the fields of the batch.
+   * @param fieldIds the resolved jni ids of the fields.
+   * @param kinds    the kinds of the fields.
+   */
+  NativeFieldBatch(@NonNull Class<?> type, @NonNull Field[] fields, @NonNull long[] fieldIds, @NonNull byte[] kinds) {
+    this.type = type;
+    this.fields = fields;
+    this.fieldIds = fieldIds;
+    this.kinds = kinds;
+  }
+
+  /**
+   * Get the type of the instances of which the fields are read.
+   *
+   * @return the type of the instances to read the fields of.
+   */
+  public @NonNull Class<?> getType() {
+    return this.type;
+  }
+
+  /**
+   * Get the fields of this batch, in the order in which their values are written.
+   *
+   * @return the fields of this batch.
+   */
+  public @Unmodifiable @NonNull List<Field> getFields() {
+    return Collections.unmodifiableList(Arrays.asList(this.fields));
+  }
+
+  /**
+   * Get the amount of fields in this batch.
+   *
+   * @return the amount of fields in this batch.
+   */
+  public int getFieldCount() {
+    return this.fields.length;
+  }
+
+  /**
+   * Reads the values of all fields of the batch from the given instance into the given array, as raw bits.
+   *
+   * @param instance the instance to read the fields of.
+   * @param out      the array to write the raw bits of the values into, at the index of the field in the batch.
+   * @throws NullPointerException     if the given instance or output array is null.
+   * @throws IllegalArgumentException if the given instance has the wrong type or the output array is too small.
+   */
+  public void readRaw(@NonNull Object instance, @NonNull long[] out) {
+    // passing an instance of another type to jni would corrupt the jvm
+    if (!this.type.isInstance(instance)) {
+      throw new IllegalArgumentException("Cannot read fields of " + this.type + " from " + instance.getClass());
+    }
+    if (out.length < this.fields.length) {
+      throw new IllegalArgumentException("Output array of length " + out.length + " cannot hold all field values");
+    }
+
+    FNativeReflect.ReadFields(instance, this.fieldIds, this.kinds, out);
+  }
+}
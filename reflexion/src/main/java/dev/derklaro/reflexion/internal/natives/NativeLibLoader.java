@@ -25,13 +25,18 @@
 package dev.derklaro.reflexion.internal.natives;
 
 import dev.derklaro.reflexion.Result;
+import java.io.ByteArrayOutputStream;
 import java.io.IOException;
 import java.io.InputStream;
 import java.nio.file.Files;
 import java.nio.file.Path;
+import java.nio.file.Paths;
 import java.nio.file.StandardCopyOption;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
 import java.util.Locale;
 import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
 
 /**
  * The loader for the native library bundled with this library.
@@ -42,6 +47,8 @@ final class NativeLibLoader {
 
   private static final boolean NATIVE_DISABLED = Boolean.getBoolean(
     Result.class.getPackage().getName() + ".native-disabled");
+  private static final String NATIVE_CACHE_DIR = System.getProperty(
+    Result.class.getPackage().getName() + ".native-cache-dir");
 
   private static final Os UNSUPPORTED_OS = new Os("unsupported", "", "");
   private static final String NATIVE_LIB_FILE_FORMAT = "reflexion-native/reflexion-%s_%s/%sreflexion.%s";
@@ -80,11 +87,21 @@ private NativeLibLoader() {
   }
 
   /**
-   * Tries to load the native library which is bundled with reflexion.
+   * Tries to load the native library which is bundled with reflexion. The library is only loaded once, subsequent calls
+   * return the result of the first attempt.
    *
    * @return true if the library was loaded successfully, false otherwise.
    */
   public static boolean tryLoadNative() {
+    return LoadResult.LOADED;
+  }
+
+  /**
+   * Loads the native library which is bundled with reflexion.
+   *
+   * @return true if the library was loaded successfully, false otherwise.
+   */
+  private static boolean loadNative() {
     // check if we can load a native lib
     if (NATIVE_DISABLED || OS == UNSUPPORTED_OS || OS_ARCH.equals("unsupported")) {
       return false;
@@ -92,21 +109,118 @@ public static boolean tryLoadNative() {
 
     // get the full name to the folder and file we should search for the lib, then try to load it
     String file = String.format(NATIVE_LIB_FILE_FORMAT, OS.name, OS_ARCH, OS.libPrefix, OS.libExtension);
-    InputStream nativeLibStream = NativeLibLoader.class.getClassLoader().getResourceAsStream(file);
+    byte[] library;
+    try (InputStream nativeLibStream = NativeLibLoader.class.getClassLoader().getResourceAsStream(file)) {
+      // check if the lib for the environment was found
+      if (nativeLibStream == null) {
+        return false;
+      }
+      library = readFully(nativeLibStream);
+    } catch (IOException exception) {
+      return false;
+    }
+
+    // prefer the cached library file, extract to a temp file if there is no cache or the cache is not usable
+    String extension = file.substring(file.lastIndexOf('.'));
+    Path libraryPath = null;
+    if (NATIVE_CACHE_DIR != null) {
+      libraryPath = extractToCache(Paths.get(NATIVE_CACHE_DIR), library, extension);
+    }
+    if (libraryPath == null && (libraryPath = extractToTemp(library, extension)) == null) {
+      return false;
+    }
 
-    // check if the lib for the environment was found
-    if (nativeLibStream == null) {
+    try {
+      // try to load the library
+      System.load(libraryPath.toAbsolutePath().toString());
+      return true;
+    } catch (Exception | UnsatisfiedLinkError exception) {
+      // unable to load, ignore
       return false;
     }
+  }
+
+  /**
+   * Writes the given library into the given cache directory, unless the library was cached before. The file name of
+   * the cached library is based on the sha-256 hash of the library content, which allows jvm instances using the same
+   * library to share the cached file (and the mapping of it). An existing cache file is only used if its content
+   * matches the hash, otherwise it gets replaced. The file is written to a temp file first and then moved atomically
+   * into place, so that parallel jvm instances never load a partially written library.
+   *
+   * @param cacheDir  the directory in which the library should be cached.
+   * @param library   the content of the library.
+   * @param extension the file extension of the library, including the leading dot.
+   * @return the path to the cached library, null if the library cannot be cached.
+   * @throws NullPointerException if the given cache directory, library or extension is null.
+   */
+  private static @Nullable Path extractToCache(
+    @NonNull Path cacheDir,
+    @NonNull byte[] library,
+    @NonNull String extension
+  ) {
+    try {
+      String hash = sha256(library);
+      Path target = cacheDir.resolve("reflexion-" + hash + extension);
+      if (isCached(target, hash)) {
+        // cached by a previous or parallel run
+        return target;
+      }
+
+      // the file is either missing or corrupted, (re-)write it atomically
+      Files.createDirectories(cacheDir);
+      Path temp = Files.createTempFile(cacheDir, "reflexion-", ".tmp");
+      try {
+        Files.write(temp, library);
+        Files.move(temp, target, StandardCopyOption.ATOMIC_MOVE, StandardCopyOption.REPLACE_EXISTING);
+      } catch (IOException exception) {
+        // another jvm might have moved the file concurrently (and is using it already, some os do not allow
+        // replacing the file in that case), only use the target if the content is intact
+        Files.deleteIfExists(temp);
+        if (!isCached(target, hash)) {
+          return null;
+        }
+      }
+      return target;
+    } catch (IOException | NoSuchAlgorithmException exception) {
+      // unable to use the cache directory
+      return null;
+    }
+  }
 
+  /**
+   * Checks if the given cached library file exists and its content matches the given sha-256 hash.
+   *
+   * @param target the path of the cached library file.
+   * @param hash   the expected lowercase hex encoded sha-256 hash of the library.
+   * @return true if the cached file exists and is intact, false otherwise.
+   * @throws IOException              if an i/o error occurs while reading the cached file.
+   * @throws NoSuchAlgorithmException if the jvm does not support sha-256.
+   * @throws NullPointerException     if the given target or hash is null.
+   */
+  private static boolean isCached(
+    @NonNull Path target,
+    @NonNull String hash
+  ) throws IOException, NoSuchAlgorithmException {
+    return Files.isRegularFile(target) && hash.equals(sha256(Files.readAllBytes(target)));
+  }
+
+  /**
+   * Writes the given library into a new temp file which gets deleted when the jvm shuts down.
+   *
+   * @param library   the content of the library.
+   * @param extension the file extension of the library, including the leading dot.
+   * @return the path to the temp file holding the library, null if the temp file cannot be created.
+   * @throws NullPointerException if the given library or extension is null.
+   */
+  private static @Nullable Path extractToTemp(@NonNull byte[] library, @NonNull String extension) {
     Path temp;
     try {
       // create a temp file at the target
-      temp = Files.createTempFile("reflexion-", file.substring(file.lastIndexOf('.')));
-      Files.copy(nativeLibStream, temp, StandardCopyOption.REPLACE_EXISTING);
+      temp = Files.createTempFile("reflexion-", extension);
+      Files.write(temp, library);
     } catch (IOException exception) {
       // unable to create the temp file / write to it...
-      return false;
+      return null;
     }
 
     // try to not leave crap on the file system
@@ -117,15 +231,43 @@ public static boolean tryLoadNative() {
         // ok well, just leave the file there then
       }
     }));
+    return temp;
+  }
 
-    try {
-      // try to load the library
-      System.load(temp.toAbsolutePath().toString());
-      return true;
-    } catch (Exception exception) {
-      // unable to load, ignore
-      return false;
+  /**
+   * Reads all bytes from the given stream.
+   *
+   * @param stream the stream to read.
+   * @return all bytes read from the given stream.
+   * @throws IOException          if an i/o error occurs while reading.
+   * @throws NullPointerException if the given stream is null.
+   */
+  private static byte[] readFully(@NonNull InputStream stream) throws IOException {
+    ByteArrayOutputStream out = new ByteArrayOutputStream();
+    byte[] buffer = new byte[8192];
+
+    int read;
+    while ((read = stream.read(buffer)) != -1) {
+      out.write(buffer, 0, read);
     }
+    return out.toByteArray();
+  }
+
+  /**
+   * Computes the lowercase hex encoded sha-256 hash of the given content.
+   *
+   * @param content the content to hash.
+   * @return the hex encoded hash of the given content.
+   * @throws NoSuchAlgorithmException if the jvm does not support sha-256.
+   * @throws NullPointerException     if the given content is null.
+   */
+  private static @NonNull String sha256(@NonNull byte[] content) throws NoSuchAlgorithmException {
+    byte[] hash = MessageDigest.getInstance("SHA-256").digest(content);
+    StringBuilder builder = new StringBuilder(hash.length * 2);
+    for (byte b : hash) {
+      builder.append(Character.forDigit((b >> 4) & 0xF, 16)).append(Character.forDigit(b & 0xF, 16));
+    }
+    return builder.toString();
   }
 
   /**
@@ -153,4 +295,14 @@ public Os(@NonNull String name, @NonNull String libPrefix, @NonNull String libEx
       this.libExtension = libExtension;
     }
   }
+
+  /**
+   * Holds the result of loading the native library, initialized lazily when the library is first requested.
+   *
+   * @since 1.4
+   */
+  private static final class LoadResult {
+
+    private static final boolean LOADED = loadNative();
+  }
 }
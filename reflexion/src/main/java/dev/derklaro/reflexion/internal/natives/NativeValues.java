@@ -0,0 +1,248 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.natives;
+
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: converts between boxed values and the raw bits used to pass primitive values to and from the native jni
+ * entry points. Each primitive type is identified by its jvm type descriptor char (for example {@code I} for int),
+ * reference types use {@code L} and void uses {@code V}. Integral values are stored widened to a long (booleans as 0
+ * or 1, chars zero extended), floats as their raw int bits and doubles as their raw long bits.
+ * <p>
+ * Boxed values are converted using the same identity and widening primitive conversions which are allowed by
+ * java.lang.reflect, for example an Integer can be converted to a long, but not to a short.
+ *
+ * @since 1.4
+ */
+final class NativeValues {
+
+  static final byte BOOLEAN = 'Z';
+  static final byte BYTE = 'B';
+  static final byte CHAR = 'C';
+  static final byte SHORT = 'S';
+  static final byte INT = 'I';
+  static final byte LONG = 'J';
+  static final byte FLOAT = 'F';
+  static final byte DOUBLE = 'D';
+  static final byte REFERENCE = 'L';
+  static final byte VOID = 'V';
+
+  private NativeValues() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Get the kind of the given type.
+   *
+   * @param type the type to get the kind of.
+   * @return the kind of the given type.
+   * @throws NullPointerException if the given type is null.
+   */
+  public static byte kindOf(@NonNull Class<?> type) {
+    if (!type.isPrimitive()) {
+      return REFERENCE;
+    }
+    if (type == boolean.class) {
+      return BOOLEAN;
+    }
+    if (type == byte.class) {
+      return BYTE;
+    }
+    if (type == char.class) {
+      return CHAR;
+    }
+    if (type == short.class) {
+      return SHORT;
+    }
+    if (type == int.class) {
+      return INT;
+    }
+    if (type == long.class) {
+      return LONG;
+    }
+    if (type == float.class) {
+      return FLOAT;
+    }
+    return type == double.class ? DOUBLE : VOID;
+  }
+
+  /**
+   * Get the kinds of the given types.
+   *
+   * @param types the types to get the kinds of.
+   * @return the kinds of the given types, in the same order.
+   * @throws NullPointerException if the given type array or an element of it is null.
+   */
+  public static @NonNull byte[] kindsOf(@NonNull Class<?>[] types) {
+    byte[] kinds = new byte[types.length];
+    for (int i = 0; i < types.length; i++) {
+      kinds[i] = kindOf(types[i]);
+    }
+    return kinds;
+  }
+
+  /**
+   * Converts the given boxed value to the raw bits of the given primitive kind.
+   *
+   * @param kind  the primitive kind to convert the value to.
+   * @param value the boxed value to convert.
+   * @return the raw bits of the converted value.
+   * @throws IllegalArgumentException if the given value cannot be converted to the given kind.
+   */
+  public static long toRaw(byte kind, @Nullable Object value) {
+    switch (kind) {
+      case BOOLEAN:
+        if (value instanceof Boolean) {
+          return (Boolean) value ? 1 : 0;
+        }
+        break;
+      case CHAR:
+        if (value instanceof Character) {
+          return (Character) value;
+        }
+        break;
+      case FLOAT:
+        if (canWiden(value, kind)) {
+          float floatValue = value instanceof Character ? (Character) value : ((Number) value).floatValue();
+          return Float.floatToRawIntBits(floatValue) & 0xFFFFFFFFL;
+        }
+        break;
+      case DOUBLE:
+        if (canWiden(value, kind)) {
+          double doubleValue = value instanceof Character ? (Character) value : ((Number) value).doubleValue();
+          return Double.doubleToRawLongBits(doubleValue);
+        }
+        break;
+      default:
+        // byte, short, int and long
+        if (canWiden(value, kind)) {
+          return value instanceof Character ? (Character) value : ((Number) value).longValue();
+        }
+        break;
+    }
+
+    String valueType = value == null ? "null" : value.getClass().getName();
+    throw new IllegalArgumentException("Cannot convert " + valueType + " to " + (char) kind);
+  }
+
+  /**
+   * Converts the given raw bits of the given kind into a boxed value.
+   *
+   * @param kind the kind of the given raw bits.
+   * @param raw  the raw bits to convert.
+   * @return the boxed value represented by the given raw bits, null for void.
+   */
+  public static @Nullable Object fromRaw(byte kind, long raw) {
+    switch (kind) {
+      case BOOLEAN:
+        return raw != 0;
+      case BYTE:
+        return (byte) raw;
+      case CHAR:
+        return (char) raw;
+      case SHORT:
+        return (short) raw;
+      case INT:
+        return (int) raw;
+      case LONG:
+        return raw;
+      case FLOAT:
+        return Float.intBitsToFloat((int) raw);
+      case DOUBLE:
+        return Double.longBitsToDouble(raw);
+      default:
+        return null;
+    }
+  }
+
+  /**
+   * Checks if the given boxed value can be converted to the given numeric kind using an identity or widening primitive
+   * conversion.
+   *
+   * @param value the boxed value to check.
+   * @param kind  the numeric kind to convert to, must not be boolean or char.
+   * @return true if the value can be converted to the given kind, false otherwise.
+   */
+  private static boolean canWiden(@Nullable Object value, byte kind) {
+    int valueRank = valueRank(value);
+    if (valueRank == 0) {
+      return false;
+    }
+
+    int targetRank = kindRank(kind);
+    // chars can only be widened to int or a wider type, but not to short which has the same rank
+    return valueRank < targetRank || (valueRank == targetRank && !(value instanceof Character));
+  }
+
+  /**
+   * Get the widening rank of the given boxed value.
+   *
+   * @param value the boxed value to get the rank of.
+   * @return the widening rank of the value, 0 if the value is not a supported numeric value.
+   */
+  private static int valueRank(@Nullable Object value) {
+    if (value instanceof Byte) {
+      return 1;
+    }
+    if (value instanceof Short || value instanceof Character) {
+      return 2;
+    }
+    if (value instanceof Integer) {
+      return 3;
+    }
+    if (value instanceof Long) {
+      return 4;
+    }
+    if (value instanceof Float) {
+      return 5;
+    }
+    return value instanceof Double ? 6 : 0;
+  }
+
+  /**
+   * Get the widening rank of the given numeric kind.
+   *
+   * @param kind the numeric kind to get the rank of.
+   * @return the widening rank of the kind.
+   */
+  private static int kindRank(byte kind) {
+    switch (kind) {
+      case BYTE:
+        return 1;
+      case SHORT:
+        return 2;
+      case INT:
+        return 3;
+      case LONG:
+        return 4;
+      case FLOAT:
+        return 5;
+      default:
+        return 6;
+    }
+  }
+}
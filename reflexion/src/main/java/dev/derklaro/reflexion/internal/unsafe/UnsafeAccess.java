@@ -0,0 +1,552 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.unsafe;
+
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Field;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: provides access to the field memory access methods of {@code sun.misc.Unsafe}. The methods are resolved
+ * once into handles bound to the unsafe instance and stored in constants, which allows the jit to inline them into the
+ * caller like a direct call to unsafe. No checks are done by the methods in this class, callers must ensure that the
+ * given base and offset belong to a field of the accessed type.
+ *
+ * @since 1.4
+ */
+final class UnsafeAccess {
+
+  private static final Object UNSAFE = resolveUnsafe();
+  // set to false if one of the handles can't be resolved, must be declared before the handles
+  private static boolean complete = UNSAFE != null;
+
+  private static final MethodType OFFSET_TYPE = MethodType.methodType(long.class, Field.class);
+  private static final MethodHandle OBJECT_FIELD_OFFSET = find("objectFieldOffset", OFFSET_TYPE);
+  private static final MethodHandle STATIC_FIELD_OFFSET = find("staticFieldOffset", OFFSET_TYPE);
+  private static final MethodHandle STATIC_FIELD_BASE = find(
+    "staticFieldBase",
+    OFFSET_TYPE.changeReturnType(Object.class));
+
+  private static final MethodHandle GET_BOOLEAN = getter("getBoolean", boolean.class);
+  private static final MethodHandle PUT_BOOLEAN = putter("putBoolean", boolean.class);
+  private static final MethodHandle GET_BOOLEAN_VOLATILE = getter("getBooleanVolatile", boolean.class);
+  private static final MethodHandle PUT_BOOLEAN_VOLATILE = putter("putBooleanVolatile", boolean.class);
+  private static final MethodHandle GET_BYTE = getter("getByte", byte.class);
+  private static final MethodHandle PUT_BYTE = putter("putByte", byte.class);
+  private static final MethodHandle GET_BYTE_VOLATILE = getter("getByteVolatile", byte.class);
+  private static final MethodHandle PUT_BYTE_VOLATILE = putter("putByteVolatile", byte.class);
+  private static final MethodHandle GET_CHAR = getter("getChar", char.class);
+  private static final MethodHandle PUT_CHAR = putter("putChar", char.class);
+  private static final MethodHandle GET_CHAR_VOLATILE = getter("getCharVolatile", char.class);
+  private static final MethodHandle PUT_CHAR_VOLATILE = putter("putCharVolatile", char.class);
+  private static final MethodHandle GET_SHORT = getter("getShort", short.class);
+  private static final MethodHandle PUT_SHORT = putter("putShort", short.class);
+  private static final MethodHandle GET_SHORT_VOLATILE = getter("getShortVolatile", short.class);
+  private static final MethodHandle PUT_SHORT_VOLATILE = putter("putShortVolatile", short.class);
+  private static final MethodHandle GET_INT = getter("getInt", int.class);
+  private static final MethodHandle PUT_INT = putter("putInt", int.class);
+  private static final MethodHandle GET_INT_VOLATILE = getter("getIntVolatile", int.class);
+  private static final MethodHandle PUT_INT_VOLATILE = putter("putIntVolatile", int.class);
+  private static final MethodHandle GET_LONG = getter("getLong", long.class);
+  private static final MethodHandle PUT_LONG = putter("putLong", long.class);
+  private static final MethodHandle GET_LONG_VOLATILE = getter("getLongVolatile", long.class);
+  private static final MethodHandle PUT_LONG_VOLATILE = putter("putLongVolatile", long.class);
+  private static final MethodHandle GET_FLOAT = getter("getFloat", float.class);
+  private static final MethodHandle PUT_FLOAT = putter("putFloat", float.class);
+  private static final MethodHandle GET_FLOAT_VOLATILE = getter("getFloatVolatile", float.class);
+  private static final MethodHandle PUT_FLOAT_VOLATILE = putter("putFloatVolatile", float.class);
+  private static final MethodHandle GET_DOUBLE = getter("getDouble", double.class);
+  private static final MethodHandle PUT_DOUBLE = putter("putDouble", double.class);
+  private static final MethodHandle GET_DOUBLE_VOLATILE = getter("getDoubleVolatile", double.class);
+  private static final MethodHandle PUT_DOUBLE_VOLATILE = putter("putDoubleVolatile", double.class);
+  private static final MethodHandle GET_OBJECT = getter("getObject", Object.class);
+  private static final MethodHandle PUT_OBJECT = putter("putObject", Object.class);
+  private static final MethodHandle GET_OBJECT_VOLATILE = getter("getObjectVolatile", Object.class);
+  private static final MethodHandle PUT_OBJECT_VOLATILE = putter("putObjectVolatile", Object.class);
+
+  static final boolean AVAILABLE = complete;
+
+  private UnsafeAccess() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Get the offset of the given instance field within the instances of its declaring class.
+   *
+   * @param field the instance field to get the offset of.
+   * @return the offset of the given field.
+   * @throws UnsupportedOperationException if the field is declared by a hidden class or a record.
+   */
+  static long objectFieldOffset(Field field) {
+    try {
+      return (long) OBJECT_FIELD_OFFSET.invokeExact(field);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Get the offset of the given static field relative to the base returned by {@link #staticFieldBase(Field)}.
+   *
+   * @param field the static field to get the offset of.
+   * @return the offset of the given field.
+   * @throws UnsupportedOperationException if the field is declared by a hidden class or a record.
+   */
+  static long staticFieldOffset(Field field) {
+    try {
+      return (long) STATIC_FIELD_OFFSET.invokeExact(field);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Get the base object which holds the value of the given static field.
+   *
+   * @param field the static field to get the base of.
+   * @return the base object of the given field.
+   * @throws UnsupportedOperationException if the field is declared by a hidden class or a record.
+   */
+  static Object staticFieldBase(Field field) {
+    try {
+      return (Object) STATIC_FIELD_BASE.invokeExact(field);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Reads a boolean field.
+   *
+   * @param base           the instance or static field base to read the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be read with volatile semantics.
+   * @return the current value of the field.
+   */
+  static boolean getBoolean(Object base, long offset, boolean volatileAccess) {
+    try {
+      if (volatileAccess) {
+        return (boolean) GET_BOOLEAN_VOLATILE.invokeExact(base, offset);
+      }
+      return (boolean) GET_BOOLEAN.invokeExact(base, offset);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Writes a boolean field.
+   *
+   * @param base           the instance or static field base to write the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be written with volatile semantics.
+   * @param value          the value to write.
+   */
+  static void putBoolean(Object base, long offset, boolean volatileAccess, boolean value) {
+    try {
+      if (volatileAccess) {
+        PUT_BOOLEAN_VOLATILE.invokeExact(base, offset, value);
+      } else {
+        PUT_BOOLEAN.invokeExact(base, offset, value);
+      }
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Reads a byte field.
+   *
+   * @param base           the instance or static field base to read the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be read with volatile semantics.
+   * @return the current value of the field.
+   */
+  static byte getByte(Object base, long offset, boolean volatileAccess) {
+    try {
+      if (volatileAccess) {
+        return (byte) GET_BYTE_VOLATILE.invokeExact(base, offset);
+      }
+      return (byte) GET_BYTE.invokeExact(base, offset);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Writes a byte field.
+   *
+   * @param base           the instance or static field base to write the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be written with volatile semantics.
+   * @param value          the value to write.
+   */
+  static void putByte(Object base, long offset, boolean volatileAccess, byte value) {
+    try {
+      if (volatileAccess) {
+        PUT_BYTE_VOLATILE.invokeExact(base, offset, value);
+      } else {
+        PUT_BYTE.invokeExact(base, offset, value);
+      }
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Reads a char field.
+   *
+   * @param base           the instance or static field base to read the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be read with volatile semantics.
+   * @return the current value of the field.
+   */
+  static char getChar(Object base, long offset, boolean volatileAccess) {
+    try {
+      if (volatileAccess) {
+        return (char) GET_CHAR_VOLATILE.invokeExact(base, offset);
+      }
+      return (char) GET_CHAR.invokeExact(base, offset);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Writes a char field.
+   *
+   * @param base           the instance or static field base to write the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be written with volatile semantics.
+   * @param value          the value to write.
+   */
+  static void putChar(Object base, long offset, boolean volatileAccess, char value) {
+    try {
+      if (volatileAccess) {
+        PUT_CHAR_VOLATILE.invokeExact(base, offset, value);
+      } else {
+        PUT_CHAR.invokeExact(base, offset, value);
+      }
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Reads a short field.
+   *
+   * @param base           the instance or static field base to read the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be read with volatile semantics.
+   * @return the current value of the field.
+   */
+  static short getShort(Object base, long offset, boolean volatileAccess) {
+    try {
+      if (volatileAccess) {
+        return (short) GET_SHORT_VOLATILE.invokeExact(base, offset);
+      }
+      return (short) GET_SHORT.invokeExact(base, offset);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Writes a short field.
+   *
+   * @param base           the instance or static field base to write the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be written with volatile semantics.
+   * @param value          the value to write.
+   */
+  static void putShort(Object base, long offset, boolean volatileAccess, short value) {
+    try {
+      if (volatileAccess) {
+        PUT_SHORT_VOLATILE.invokeExact(base, offset, value);
+      } else {
+        PUT_SHORT.invokeExact(base, offset, value);
+      }
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Reads an int field.
+   *
+   * @param base           the instance or static field base to read the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be read with volatile semantics.
+   * @return the current value of the field.
+   */
+  static int getInt(Object base, long offset, boolean volatileAccess) {
+    try {
+      if (volatileAccess) {
+        return (int) GET_INT_VOLATILE.invokeExact(base, offset);
+      }
+      return (int) GET_INT.invokeExact(base, offset);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Writes an int field.
+   *
+   * @param base           the instance or static field base to write the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be written with volatile semantics.
+   * @param value          the value to write.
+   */
+  static void putInt(Object base, long offset, boolean volatileAccess, int value) {
+    try {
+      if (volatileAccess) {
+        PUT_INT_VOLATILE.invokeExact(base, offset, value);
+      } else {
+        PUT_INT.invokeExact(base, offset, value);
+      }
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Reads a long field.
+   *
+   * @param base           the instance or static field base to read the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be read with volatile semantics.
+   * @return the current value of the field.
+   */
+  static long getLong(Object base, long offset, boolean volatileAccess) {
+    try {
+      if (volatileAccess) {
+        return (long) GET_LONG_VOLATILE.invokeExact(base, offset);
+      }
+      return (long) GET_LONG.invokeExact(base, offset);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Writes a long field.
+   *
+   * @param base           the instance or static field base to write the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be written with volatile semantics.
+   * @param value          the value to write.
+   */
+  static void putLong(Object base, long offset, boolean volatileAccess, long value) {
+    try {
+      if (volatileAccess) {
+        PUT_LONG_VOLATILE.invokeExact(base, offset, value);
+      } else {
+        PUT_LONG.invokeExact(base, offset, value);
+      }
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Reads a float field.
+   *
+   * @param base           the instance or static field base to read the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be read with volatile semantics.
+   * @return the current value of the field.
+   */
+  static float getFloat(Object base, long offset, boolean volatileAccess) {
+    try {
+      if (volatileAccess) {
+        return (float) GET_FLOAT_VOLATILE.invokeExact(base, offset);
+      }
+      return (float) GET_FLOAT.invokeExact(base, offset);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Writes a float field.
+   *
+   * @param base           the instance or static field base to write the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be written with volatile semantics.
+   * @param value          the value to write.
+   */
+  static void putFloat(Object base, long offset, boolean volatileAccess, float value) {
+    try {
+      if (volatileAccess) {
+        PUT_FLOAT_VOLATILE.invokeExact(base, offset, value);
+      } else {
+        PUT_FLOAT.invokeExact(base, offset, value);
+      }
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Reads a double field.
+   *
+   * @param base           the instance or static field base to read the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be read with volatile semantics.
+   * @return the current value of the field.
+   */
+  static double getDouble(Object base, long offset, boolean volatileAccess) {
+    try {
+      if (volatileAccess) {
+        return (double) GET_DOUBLE_VOLATILE.invokeExact(base, offset);
+      }
+      return (double) GET_DOUBLE.invokeExact(base, offset);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Writes a double field.
+   *
+   * @param base           the instance or static field base to write the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be written with volatile semantics.
+   * @param value          the value to write.
+   */
+  static void putDouble(Object base, long offset, boolean volatileAccess, double value) {
+    try {
+      if (volatileAccess) {
+        PUT_DOUBLE_VOLATILE.invokeExact(base, offset, value);
+      } else {
+        PUT_DOUBLE.invokeExact(base, offset, value);
+      }
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Reads an Object field.
+   *
+   * @param base           the instance or static field base to read the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be read with volatile semantics.
+   * @return the current value of the field.
+   */
+  static Object getObject(Object base, long offset, boolean volatileAccess) {
+    try {
+      if (volatileAccess) {
+        return (Object) GET_OBJECT_VOLATILE.invokeExact(base, offset);
+      }
+      return (Object) GET_OBJECT.invokeExact(base, offset);
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Writes an Object field.
+   *
+   * @param base           the instance or static field base to write the field of.
+   * @param offset         the offset of the field.
+   * @param volatileAccess if the field should be written with volatile semantics.
+   * @param value          the value to write.
+   */
+  static void putObject(Object base, long offset, boolean volatileAccess, Object value) {
+    try {
+      if (volatileAccess) {
+        PUT_OBJECT_VOLATILE.invokeExact(base, offset, value);
+      } else {
+        PUT_OBJECT.invokeExact(base, offset, value);
+      }
+    } catch (Throwable throwable) {
+      throw Util.throwUnchecked(throwable);
+    }
+  }
+
+  /**
+   * Resolves the unsafe instance of the jvm.
+   *
+   * @return the unsafe instance, null if unsafe is not available in this jvm.
+   */
+  private static @Nullable Object resolveUnsafe() {
+    try {
+      Field theUnsafe = Class.forName("sun.misc.Unsafe").getDeclaredField("theUnsafe");
+      theUnsafe.setAccessible(true);
+      return theUnsafe.get(null);
+    } catch (Throwable throwable) {
+      // unsafe is not available in this jvm
+      return null;
+    }
+  }
+
+  /**
+   * Finds the getter method with the given name which reads a field of the given type from a base and offset.
+   *
+   * @param name the name of the getter method.
+   * @param type the type of the field read by the getter.
+   * @return a handle to the getter bound to the unsafe instance, null if the getter is not available.
+   */
+  private static @Nullable MethodHandle getter(String name, Class<?> type) {
+    return find(name, MethodType.methodType(type, Object.class, long.class));
+  }
+
+  /**
+   * Finds the setter method with the given name which writes a field of the given type at a base and offset.
+   *
+   * @param name the name of the setter method.
+   * @param type the type of the field written by the setter.
+   * @return a handle to the setter bound to the unsafe instance, null if the setter is not available.
+   */
+  private static @Nullable MethodHandle putter(String name, Class<?> type) {
+    return find(name, MethodType.methodType(void.class, Object.class, long.class, type));
+  }
+
+  /**
+   * Finds the given method of the unsafe class and binds it to the unsafe instance.
+   *
+   * @param name the name of the method to find.
+   * @param type the type of the method.
+   * @return a handle to the method bound to the unsafe instance, null if the method is not available.
+   */
+  private static @Nullable MethodHandle find(String name, MethodType type) {
+    if (UNSAFE == null) {
+      return null;
+    }
+
+    try {
+      return MethodHandles.publicLookup().findVirtual(UNSAFE.getClass(), name, type).bindTo(UNSAFE);
+    } catch (Throwable throwable) {
+      // the method was removed from unsafe
+      complete = false;
+      return null;
+    }
+  }
+}
@@ -0,0 +1,628 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.unsafe;
+
+import dev.derklaro.reflexion.AccessorFactory;
+import dev.derklaro.reflexion.FieldAccessor;
+import dev.derklaro.reflexion.Reflexion;
+import dev.derklaro.reflexion.ReflexionException;
+import dev.derklaro.reflexion.Result;
+import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.bytecode.BytecodeAccessorFactory;
+import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.JniAccessorFactory;
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.invoke.MethodHandle;
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import java.util.function.Supplier;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * An accessor factory which reads and writes fields using the field offsets provided by {@code sun.misc.Unsafe}. The
+ * offset (and the base object for static fields) is resolved once when the field is wrapped, each access is a single
+ * unsafe memory access without any adaptation of the arguments. Volatile fields are accessed with volatile semantics.
+ * Methods and constructors are wrapped using method handles.
+ * <p>
+ * This factory is opt-in, it must be passed to {@link Reflexion#on(Class, Object, AccessorFactory)} explicitly. It is
+ * never preferred over the bytecode based factory, as the generated accessors use plain field instructions, which are
+ * at least as cheap as an access at the field offset. It is therefore only selected by default on java 8 to 16 if the
+ * bytecode based factory is not available, in that case it is preferred over the method handle based factories. The
+ * memory access methods of unsafe are deprecated on newer jvms and field offsets are not available for fields of
+ * hidden classes and records, these fields are wrapped using method handles instead.
+ *
+ * @since 1.4
+ */
+public final class UnsafeAccessorFactory extends MethodHandleAccessorFactory {
+
+  private static final boolean PREFERRED_JVM = javaVersion() < 17;
+
+  /**
+   * Get if this factory should be preferred over the method handle based factories in the current jvm, which is the
+   * case on java 8 to 16.
+   *
+   * @return true if this factory is preferred in the current jvm, false otherwise.
+   */
+  public static boolean isPreferredJvm() {
+    return PREFERRED_JVM;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public boolean isAvailable() {
+    return UnsafeAccess.AVAILABLE && super.isAvailable();
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull FieldAccessor wrapField(@NonNull Reflexion reflexion, @NonNull Field field) {
+    if (!UnsafeAccess.AVAILABLE) {
+      return this.wrapFallbackField(reflexion, field);
+    }
+
+    try {
+      int modifiers = field.getModifiers();
+      boolean staticField = Modifier.isStatic(modifiers);
+
+      Object base = null;
+      long offset;
+      if (staticField) {
+        base = UnsafeAccess.staticFieldBase(field);
+        offset = UnsafeAccess.staticFieldOffset(field);
+        // resolving the offset does not initialize the declaring class, but the value of the field might depend on it
+        Class<?> declaringClass = field.getDeclaringClass();
+        Class.forName(declaringClass.getName(), true, declaringClass.getClassLoader());
+      } else {
+        offset = UnsafeAccess.objectFieldOffset(field);
+      }
+
+      return new UnsafeFieldAccessor(
+        field,
+        reflexion,
+        base,
+        offset,
+        staticField,
+        Modifier.isVolatile(modifiers),
+        () -> this.wrapFallbackField(reflexion, field));
+    } catch (UnsupportedOperationException exception) {
+      // fields of hidden classes and records have no offset
+      return this.wrapFallbackField(reflexion, field);
+    } catch (ClassNotFoundException | LinkageError exception) {
+      throw new ReflexionException(exception);
+    }
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public int compareTo(@NonNull AccessorFactory o) {
+    // no preference between two instances of this factory
+    if (o instanceof UnsafeAccessorFactory) {
+      return 0;
+    }
+
+    // generated accessors use plain field instructions, let the bytecode factory decide
+    if (o instanceof BytecodeAccessorFactory) {
+      return -o.compareTo(this);
+    }
+
+    // prefer all other factories if unsafe or the trusted lookup are not available
+    if (!this.isAvailable()) {
+      return 1;
+    }
+
+    // field offsets are the cheapest field access on older jvms, prefer method handles on newer jvms
+    if (o instanceof MethodHandleAccessorFactory) {
+      return PREFERRED_JVM ? -1 : 1;
+    }
+
+    // prefer this one over plain reflection and jni
+    if (o instanceof BareAccessorFactory || o instanceof JniAccessorFactory) {
+      return -1;
+    }
+
+    // no opinion
+    return 0;
+  }
+
+  /**
+   * Wraps the given field using method handles, bypassing the field offset resolution.
+   *
+   * @param reflexion the reflexion instance which requested the accessor.
+   * @param field     the field to wrap.
+   * @return a method handle based accessor for the given field.
+   */
+  private @NonNull FieldAccessor wrapFallbackField(@NonNull Reflexion reflexion, @NonNull Field field) {
+    return super.wrapField(reflexion, field);
+  }
+
+  /**
+   * Get the feature version of the current jvm.
+   *
+   * @return the feature version of the current jvm.
+   */
+  private static int javaVersion() {
+    String version = System.getProperty("java.specification.version", "1.8");
+    try {
+      // java 8 and older use the 1.x version scheme
+      return Integer.parseInt(version.startsWith("1.") ? version.substring(2) : version);
+    } catch (NumberFormatException exception) {
+      return 8;
+    }
+  }
+
+  /**
+   * Get the jvm type descriptor char of the given type, {@code L} for all reference types.
+   *
+   * @param type the type to get the descriptor char of.
+   * @return the descriptor char of the given type.
+   */
+  private static char kindOf(Class<?> type) {
+    if (!type.isPrimitive()) {
+      return 'L';
+    }
+    if (type == boolean.class) {
+      return 'Z';
+    }
+    if (type == long.class) {
+      return 'J';
+    }
+    // the first char of the other primitive type names is their descriptor char
+    return Character.toUpperCase(type.getName().charAt(0));
+  }
+
+  /**
+   * A field accessor which reads and writes the field at its offset using unsafe. Accesses which need a conversion of
+   * the value (for example reading an int field as a long) are delegated to a method handle based accessor, which is
+   * created when first needed.
+   *
+   * @since 1.4
+   */
+  private static final class UnsafeFieldAccessor implements FieldAccessor {
+
+    private final Field field;
+    private final Reflexion reflexion;
+
+    private final Class<?> owner;
+    private final char kind;
+
+    private final Object base;
+    private final long offset;
+    private final boolean staticField;
+    private final boolean volatileField;
+
+    private final Supplier<FieldAccessor> fallbackFactory;
+    private volatile FieldAccessor fallback;
+
+    /**
+     * Constructs a new unsafe field accessor instance.
+     *
+     * @param field           the field to wrap.
+     * @param reflexion       the reflexion instance which produced this instance.
+     * @param base            the base object of the field if the field is static, null otherwise.
+     * @param offset          the offset of the field.
+     * @param staticField     if the field is static.
+     * @param volatileField   if the field is volatile.
+     * @param fallbackFactory the factory for the accessor to delegate accesses which need a value conversion to.
+     */
+    public UnsafeFieldAccessor(
+      Field field,
+      Reflexion reflexion,
+      Object base,
+      long offset,
+      boolean staticField,
+      boolean volatileField,
+      Supplier<FieldAccessor> fallbackFactory
+    ) {
+      this.field = field;
+      this.reflexion = reflexion;
+      this.owner = field.getDeclaringClass();
+      this.kind = kindOf(field.getType());
+      this.base = base;
+      this.offset = offset;
+      this.staticField = staticField;
+      this.volatileField = volatileField;
+      this.fallbackFactory = fallbackFactory;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Field getMember() {
+      return this.field;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Reflexion getReflexion() {
+      return this.reflexion;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <T> Result<T> getValue() {
+      return this.getValue(this.staticField ? null : this.reflexion.getBinding());
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull <T> Result<T> getValue(@Nullable Object instance) {
+      return Result.tryExecute(() -> this.getValueDirect(instance));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Result<Void> setValue(@Nullable Object value) {
+      return this.setValue(this.staticField ? null : this.reflexion.getBinding(), value);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull Result<Void> setValue(@Nullable Object instance, @Nullable Object value) {
+      return Result.tryExecute(() -> {
+        this.setValueDirect(instance, value);
+        return null;
+      });
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("unchecked")
+    public <T> T getValueDirect(@Nullable Object instance) {
+      Object target = this.target(instance);
+      switch (this.kind) {
+        case 'Z':
+          return (T) Boolean.valueOf(UnsafeAccess.getBoolean(target, this.offset, this.volatileField));
+        case 'B':
+          return (T) Byte.valueOf(UnsafeAccess.getByte(target, this.offset, this.volatileField));
+        case 'C':
+          return (T) Character.valueOf(UnsafeAccess.getChar(target, this.offset, this.volatileField));
+        case 'S':
+          return (T) Short.valueOf(UnsafeAccess.getShort(target, this.offset, this.volatileField));
+        case 'I':
+          return (T) Integer.valueOf(UnsafeAccess.getInt(target, this.offset, this.volatileField));
+        case 'J':
+          return (T) Long.valueOf(UnsafeAccess.getLong(target, this.offset, this.volatileField));
+        case 'F':
+          return (T) Float.valueOf(UnsafeAccess.getFloat(target, this.offset, this.volatileField));
+        case 'D':
+          return (T) Double.valueOf(UnsafeAccess.getDouble(target, this.offset, this.volatileField));
+        default:
+          return (T) UnsafeAccess.getObject(target, this.offset, this.volatileField);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setValueDirect(@Nullable Object instance, @Nullable Object value) {
+      Object target = this.target(instance);
+      switch (this.kind) {
+        case 'Z':
+          if (value instanceof Boolean) {
+            UnsafeAccess.putBoolean(target, this.offset, this.volatileField, (Boolean) value);
+            return;
+          }
+          break;
+        case 'B':
+          if (value instanceof Byte) {
+            UnsafeAccess.putByte(target, this.offset, this.volatileField, (Byte) value);
+            return;
+          }
+          break;
+        case 'C':
+          if (value instanceof Character) {
+            UnsafeAccess.putChar(target, this.offset, this.volatileField, (Character) value);
+            return;
+          }
+          break;
+        case 'S':
+          if (value instanceof Short) {
+            UnsafeAccess.putShort(target, this.offset, this.volatileField, (Short) value);
+            return;
+          }
+          break;
+        case 'I':
+          if (value instanceof Integer) {
+            UnsafeAccess.putInt(target, this.offset, this.volatileField, (Integer) value);
+            return;
+          }
+          break;
+        case 'J':
+          if (value instanceof Long) {
+            UnsafeAccess.putLong(target, this.offset, this.volatileField, (Long) value);
+            return;
+          }
+          break;
+        case 'F':
+          if (value instanceof Float) {
+            UnsafeAccess.putFloat(target, this.offset, this.volatileField, (Float) value);
+            return;
+          }
+          break;
+        case 'D':
+          if (value instanceof Double) {
+            UnsafeAccess.putDouble(target, this.offset, this.volatileField, (Double) value);
+            return;
+          }
+          break;
+        default:
+          UnsafeAccess.putObject(target, this.offset, this.volatileField, Util.checkFieldValue(this.field, value));
+          return;
+      }
+
+      // the value needs a widening conversion or is invalid, let the fallback decide
+      this.fallback().setValueDirect(instance, value);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean getBoolean(@Nullable Object instance) {
+      if (this.kind == 'Z') {
+        return UnsafeAccess.getBoolean(this.target(instance), this.offset, this.volatileField);
+      }
+      return this.fallback().getBoolean(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setBoolean(@Nullable Object instance, boolean value) {
+      if (this.kind == 'Z') {
+        UnsafeAccess.putBoolean(this.target(instance), this.offset, this.volatileField, value);
+      } else {
+        this.fallback().setBoolean(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public byte getByte(@Nullable Object instance) {
+      if (this.kind == 'B') {
+        return UnsafeAccess.getByte(this.target(instance), this.offset, this.volatileField);
+      }
+      return this.fallback().getByte(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setByte(@Nullable Object instance, byte value) {
+      if (this.kind == 'B') {
+        UnsafeAccess.putByte(this.target(instance), this.offset, this.volatileField, value);
+      } else {
+        this.fallback().setByte(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public char getChar(@Nullable Object instance) {
+      if (this.kind == 'C') {
+        return UnsafeAccess.getChar(this.target(instance), this.offset, this.volatileField);
+      }
+      return this.fallback().getChar(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setChar(@Nullable Object instance, char value) {
+      if (this.kind == 'C') {
+        UnsafeAccess.putChar(this.target(instance), this.offset, this.volatileField, value);
+      } else {
+        this.fallback().setChar(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public short getShort(@Nullable Object instance) {
+      if (this.kind == 'S') {
+        return UnsafeAccess.getShort(this.target(instance), this.offset, this.volatileField);
+      }
+      return this.fallback().getShort(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setShort(@Nullable Object instance, short value) {
+      if (this.kind == 'S') {
+        UnsafeAccess.putShort(this.target(instance), this.offset, this.volatileField, value);
+      } else {
+        this.fallback().setShort(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int getInt(@Nullable Object instance) {
+      if (this.kind == 'I') {
+        return UnsafeAccess.getInt(this.target(instance), this.offset, this.volatileField);
+      }
+      return this.fallback().getInt(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setInt(@Nullable Object instance, int value) {
+      if (this.kind == 'I') {
+        UnsafeAccess.putInt(this.target(instance), this.offset, this.volatileField, value);
+      } else {
+        this.fallback().setInt(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public long getLong(@Nullable Object instance) {
+      if (this.kind == 'J') {
+        return UnsafeAccess.getLong(this.target(instance), this.offset, this.volatileField);
+      }
+      return this.fallback().getLong(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setLong(@Nullable Object instance, long value) {
+      if (this.kind == 'J') {
+        UnsafeAccess.putLong(this.target(instance), this.offset, this.volatileField, value);
+      } else {
+        this.fallback().setLong(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public float getFloat(@Nullable Object instance) {
+      if (this.kind == 'F') {
+        return UnsafeAccess.getFloat(this.target(instance), this.offset, this.volatileField);
+      }
+      return this.fallback().getFloat(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setFloat(@Nullable Object instance, float value) {
+      if (this.kind == 'F') {
+        UnsafeAccess.putFloat(this.target(instance), this.offset, this.volatileField, value);
+      } else {
+        this.fallback().setFloat(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public double getDouble(@Nullable Object instance) {
+      if (this.kind == 'D') {
+        return UnsafeAccess.getDouble(this.target(instance), this.offset, this.volatileField);
+      }
+      return this.fallback().getDouble(instance);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void setDouble(@Nullable Object instance, double value) {
+      if (this.kind == 'D') {
+        UnsafeAccess.putDouble(this.target(instance), this.offset, this.volatileField, value);
+      } else {
+        this.fallback().setDouble(instance, value);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle getterHandle() {
+      return this.fallback().getterHandle();
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull MethodHandle setterHandle() {
+      return this.fallback().setterHandle();
+    }
+
+    /**
+     * Get the base object to pass to unsafe, validating that the given instance is an instance of the declaring class
+     * of the field if the field is not static.
+     *
+     * @param instance the instance given by the caller.
+     * @return the base object to pass to unsafe.
+     * @throws NullPointerException     if the field is not static and the given instance is null.
+     * @throws IllegalArgumentException if the field is not static and the given instance has the wrong type.
+     */
+    private @NonNull Object target(@Nullable Object instance) {
+      return this.staticField ? this.base : Util.checkInstance(this.field, this.owner, instance);
+    }
+
+    /**
+     * Get the method handle based accessor to delegate accesses which need a value conversion to, creating it if
+     * needed.
+     *
+     * @return the fallback accessor of this accessor.
+     */
+    private @NonNull FieldAccessor fallback() {
+      FieldAccessor fallback = this.fallback;
+      if (fallback == null) {
+        // racy creation is fine, all accessors are equivalent
+        this.fallback = fallback = this.fallbackFactory.get();
+      }
+      return fallback;
+    }
+  }
+}
@@ -0,0 +1,108 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.util;
+
+import dev.derklaro.reflexion.AccessorFactory;
+import java.lang.reflect.Member;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: emits java flight recorder events for expensive operations of reflexion. Flight recorder events are only
+ * available on java 11+, this java 8 variant does nothing and is replaced in the multi-release jar. The events are
+ * started by one of the begin methods, which return null if the event is not enabled, and committed by passing the
+ * returned handle to the matching end method.
+ *
+ * @since 1.4
+ */
+public final class FlightEvents {
+
+  private FlightEvents() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Begins a class resolution event.
+   *
+   * @return the started event, null if the event is not enabled.
+   */
+  public static @Nullable Object beginClassResolution() {
+    return null;
+  }
+
+  /**
+   * Ends and commits the given class resolution event, if the event took longer than its configured threshold.
+   *
+   * @param event     the event returned by {@link #beginClassResolution()}, passing null is a no-op.
+   * @param className the name of the class which was resolved.
+   * @param found     if the class was found.
+   */
+  public static void endClassResolution(@Nullable Object event, @NonNull String className, boolean found) {
+  }
+
+  /**
+   * Begins a hierarchy population event.
+   *
+   * @return the started event, null if the event is not enabled.
+   */
+  public static @Nullable Object beginPopulation() {
+    return null;
+  }
+
+  /**
+   * Ends and commits the given hierarchy population event, if the event took longer than its configured threshold.
+   *
+   * @param event       the event returned by {@link #beginPopulation()}, passing null is a no-op.
+   * @param type        the class whose hierarchy was populated.
+   * @param memberType  the type of members which were collected (field, method or constructor).
+   * @param memberCount the amount of members which were collected.
+   */
+  public static void endPopulation(
+    @Nullable Object event,
+    @NonNull Class<?> type,
+    @NonNull String memberType,
+    int memberCount
+  ) {
+  }
+
+  /**
+   * Begins a member wrap event.
+   *
+   * @return the started event, null if the event is not enabled.
+   */
+  public static @Nullable Object beginWrap() {
+    return null;
+  }
+
+  /**
+   * Ends and commits the given member wrap event, if the event took longer than its configured threshold.
+   *
+   * @param event   the event returned by {@link #beginWrap()}, passing null is a no-op.
+   * @param member  the member which was wrapped.
+   * @param factory the accessor factory which wrapped the member.
+   */
+  public static void endWrap(@Nullable Object event, @NonNull Member member, @NonNull AccessorFactory factory) {
+  }
+}
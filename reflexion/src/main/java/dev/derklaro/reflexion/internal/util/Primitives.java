@@ -0,0 +1,179 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.util;
+
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: unboxes field values into primitives. The same identity and widening primitive conversions as done by
+ * java.lang.reflect are applied, for example a Short can be unboxed to an int, but a Long can not.
+ *
+ * @since 1.4
+ */
+public final class Primitives {
+
+  private Primitives() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Unboxes the given value into a boolean.
+   *
+   * @param value the value to unbox.
+   * @return the unboxed value.
+   * @throws IllegalArgumentException if the value can't be converted to a boolean.
+   */
+  public static boolean toBoolean(@Nullable Object value) {
+    if (value instanceof Boolean) {
+      return (Boolean) value;
+    }
+    throw conversionError(value, boolean.class);
+  }
+
+  /**
+   * Unboxes the given value into a byte.
+   *
+   * @param value the value to unbox.
+   * @return the unboxed value.
+   * @throws IllegalArgumentException if the value can't be converted to a byte.
+   */
+  public static byte toByte(@Nullable Object value) {
+    if (value instanceof Byte) {
+      return (Byte) value;
+    }
+    throw conversionError(value, byte.class);
+  }
+
+  /**
+   * Unboxes the given value into a char.
+   *
+   * @param value the value to unbox.
+   * @return the unboxed value.
+   * @throws IllegalArgumentException if the value can't be converted to a char.
+   */
+  public static char toChar(@Nullable Object value) {
+    if (value instanceof Character) {
+      return (Character) value;
+    }
+    throw conversionError(value, char.class);
+  }
+
+  /**
+   * Unboxes the given value into a short, widening a byte.
+   *
+   * @param value the value to unbox.
+   * @return the unboxed value.
+   * @throws IllegalArgumentException if the value can't be converted to a short.
+   */
+  public static short toShort(@Nullable Object value) {
+    if (value instanceof Short || value instanceof Byte) {
+      return ((Number) value).shortValue();
+    }
+    throw conversionError(value, short.class);
+  }
+
+  /**
+   * Unboxes the given value into an int, widening a byte, short or char.
+   *
+   * @param value the value to unbox.
+   * @return the unboxed value.
+   * @throws IllegalArgumentException if the value can't be converted to an int.
+   */
+  public static int toInt(@Nullable Object value) {
+    return toInt(value, int.class);
+  }
+
+  /**
+   * Unboxes the given value into a long, widening a byte, short, char or int.
+   *
+   * @param value the value to unbox.
+   * @return the unboxed value.
+   * @throws IllegalArgumentException if the value can't be converted to a long.
+   */
+  public static long toLong(@Nullable Object value) {
+    if (value instanceof Long) {
+      return (Long) value;
+    }
+    return toInt(value, long.class);
+  }
+
+  /**
+   * Unboxes the given value into a float, widening all integral types.
+   *
+   * @param value the value to unbox.
+   * @return the unboxed value.
+   * @throws IllegalArgumentException if the value can't be converted to a float.
+   */
+  public static float toFloat(@Nullable Object value) {
+    if (value instanceof Float || value instanceof Long) {
+      return ((Number) value).floatValue();
+    }
+    return toInt(value, float.class);
+  }
+
+  /**
+   * Unboxes the given value into a double, widening all other primitive number types.
+   *
+   * @param value the value to unbox.
+   * @return the unboxed value.
+   * @throws IllegalArgumentException if the value can't be converted to a double.
+   */
+  public static double toDouble(@Nullable Object value) {
+    if (value instanceof Double || value instanceof Float || value instanceof Long) {
+      return ((Number) value).doubleValue();
+    }
+    return toInt(value, double.class);
+  }
+
+  /**
+   * Unboxes the given value into an int, widening a byte, short or char.
+   *
+   * @param value  the value to unbox.
+   * @param target the type the value gets converted to by the caller, used for the error message.
+   * @return the unboxed value.
+   * @throws IllegalArgumentException if the value can't be converted to an int.
+   */
+  private static int toInt(@Nullable Object value, Class<?> target) {
+    if (value instanceof Character) {
+      return (Character) value;
+    }
+    if (value instanceof Integer || value instanceof Short || value instanceof Byte) {
+      return ((Number) value).intValue();
+    }
+    throw conversionError(value, target);
+  }
+
+  /**
+   * Creates the exception to throw when the given value can't be converted to the given primitive type.
+   *
+   * @param value  the value which can't be converted.
+   * @param target the primitive type the value should be converted to.
+   * @return the exception to throw.
+   */
+  private static IllegalArgumentException conversionError(@Nullable Object value, Class<?> target) {
+    String type = value == null ? "null" : value.getClass().getName();
+    return new IllegalArgumentException("Cannot convert value of type " + type + " to " + target.getName());
+  }
+}
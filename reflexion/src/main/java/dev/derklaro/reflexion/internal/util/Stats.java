@@ -0,0 +1,213 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.internal.util;
+
+import dev.derklaro.reflexion.BaseAccessor;
+import dev.derklaro.reflexion.ReflexionStats;
+import java.lang.ref.WeakReference;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.WeakHashMap;
+import java.util.concurrent.atomic.LongAdder;
+import lombok.NonNull;
+
+/**
+ * Internal: the collector of the runtime statistics of reflexion. Collecting is disabled by default and can be enabled
+ * by setting the {@code dev.derklaro.reflexion.stats} system property to true. All callers check {@link #ENABLED}
+ * before recording, as the field is constant the checks are removed by the jit if collecting is disabled.
+ *
+ * @since 1.4
+ */
+public final class Stats {
+
+  /**
+   * If collecting statistics is enabled.
+   */
+  public static final boolean ENABLED = Boolean.getBoolean(BaseAccessor.class.getPackage().getName() + ".stats");
+
+  private static final LongAdder FIELD_WRAPS = new LongAdder();
+  private static final LongAdder METHOD_WRAPS = new LongAdder();
+  private static final LongAdder CONSTRUCTOR_WRAPS = new LongAdder();
+  private static final LongAdder HANDLE_BUILD_NANOS = new LongAdder();
+  private static final LongAdder GENERATION_FALLBACKS = new LongAdder();
+  private static final LongAdder EXCEPTIONAL_RESULTS = new LongAdder();
+
+  // the counters of each class are bound to the class, the known counters are only weakly tracked for snapshots
+  private static final Map<Class<?>, WeakReference<ClassCounters>> KNOWN_COUNTERS = Collections.synchronizedMap(
+    new WeakHashMap<>());
+  private static final ClassValue<ClassCounters> CLASS_COUNTERS = new ClassValue<ClassCounters>() {
+    @Override
+    protected ClassCounters computeValue(Class<?> type) {
+      ClassCounters counters = new ClassCounters();
+      KNOWN_COUNTERS.put(type, new WeakReference<>(counters));
+      return counters;
+    }
+  };
+
+  private Stats() {
+    throw new UnsupportedOperationException();
+  }
+
+  /**
+   * Records a lookup of a member cache of the given class.
+   *
+   * @param type the class whose member cache was requested.
+   * @param hit  true if the cache was populated before, false if it had to be populated.
+   * @throws NullPointerException if the given class is null.
+   */
+  public static void memberCacheLookup(@NonNull Class<?> type, boolean hit) {
+    ClassCounters counters = counters(type);
+    (hit ? counters.memberCacheHits : counters.memberCacheMisses).increment();
+  }
+
+  /**
+   * Records a lookup of a cached accessor for a member of the given class.
+   *
+   * @param type the class whose accessor cache was requested.
+   * @param hit  true if an accessor was cached before, false if the member had to be wrapped.
+   * @throws NullPointerException if the given class is null.
+   */
+  public static void accessorCacheLookup(@NonNull Class<?> type, boolean hit) {
+    ClassCounters counters = counters(type);
+    (hit ? counters.accessorCacheHits : counters.accessorCacheMisses).increment();
+  }
+
+  /**
+   * Records a call to the field wrap method of an accessor factory.
+   */
+  public static void fieldWrapped() {
+    FIELD_WRAPS.increment();
+  }
+
+  /**
+   * Records a call to the method wrap method of an accessor factory.
+   */
+  public static void methodWrapped() {
+    METHOD_WRAPS.increment();
+  }
+
+  /**
+   * Records a call to the constructor wrap method of an accessor factory.
+   */
+  public static void constructorWrapped() {
+    CONSTRUCTOR_WRAPS.increment();
+  }
+
+  /**
+   * Records the time it took to build the method handles of an accessor.
+   *
+   * @param nanos the time it took to build the handles, in nanoseconds.
+   */
+  public static void handlesBuilt(long nanos) {
+    HANDLE_BUILD_NANOS.add(nanos);
+  }
+
+  /**
+   * Records that no accessor class could be generated for a member and that method handles were used instead.
+   */
+  public static void generationFallback() {
+    GENERATION_FALLBACKS.increment();
+  }
+
+  /**
+   * Records the creation of an exceptional result.
+   */
+  public static void exceptionalResult() {
+    EXCEPTIONAL_RESULTS.increment();
+  }
+
+  /**
+   * Takes a snapshot of the current statistics. The counters are not read atomically, concurrent updates might be
+   * partially included in the snapshot. The snapshot only contains the counters of classes which were not unloaded.
+   *
+   * @return a snapshot of the current statistics.
+   */
+  public static @NonNull ReflexionStats snapshot() {
+    Map<Class<?>, ReflexionStats.ClassStats> classStats = new HashMap<>();
+    synchronized (KNOWN_COUNTERS) {
+      KNOWN_COUNTERS.forEach((type, reference) -> {
+        ClassCounters counters = reference.get();
+        if (counters != null) {
+          classStats.put(type, new ReflexionStats.ClassStats(
+            counters.memberCacheHits.sum(),
+            counters.memberCacheMisses.sum(),
+            counters.accessorCacheHits.sum(),
+            counters.accessorCacheMisses.sum()));
+        }
+      });
+    }
+
+    return new ReflexionStats(
+      ENABLED,
+      FIELD_WRAPS.sum(),
+      METHOD_WRAPS.sum(),
+      CONSTRUCTOR_WRAPS.sum(),
+      HANDLE_BUILD_NANOS.sum(),
+      GENERATION_FALLBACKS.sum(),
+      EXCEPTIONAL_RESULTS.sum(),
+      classStats);
+  }
+
+  /**
+   * Resets all counters to zero and drops the counters of all classes.
+   */
+  public static void reset() {
+    FIELD_WRAPS.reset();
+    METHOD_WRAPS.reset();
+    CONSTRUCTOR_WRAPS.reset();
+    HANDLE_BUILD_NANOS.reset();
+    GENERATION_FALLBACKS.reset();
+    EXCEPTIONAL_RESULTS.reset();
+
+    synchronized (KNOWN_COUNTERS) {
+      KNOWN_COUNTERS.keySet().forEach(CLASS_COUNTERS::remove);
+      KNOWN_COUNTERS.clear();
+    }
+  }
+
+  /**
+   * Get the counters of the given class, creating them if needed.
+   *
+   * @param type the class to get the counters of.
+   * @return the counters of the given class.
+   */
+  private static @NonNull ClassCounters counters(@NonNull Class<?> type) {
+    return CLASS_COUNTERS.get(type);
+  }
+
+  /**
+   * The counters of a single class.
+   *
+   * @since 1.4
+   */
+  private static final class ClassCounters {
+
+    private final LongAdder memberCacheHits = new LongAdder();
+    private final LongAdder memberCacheMisses = new LongAdder();
+    private final LongAdder accessorCacheHits = new LongAdder();
+    private final LongAdder accessorCacheMisses = new LongAdder();
+  }
+}
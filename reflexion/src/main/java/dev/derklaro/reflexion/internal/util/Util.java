@@ -24,11 +24,17 @@
 
 package dev.derklaro.reflexion.internal.util;
 
+import dev.derklaro.reflexion.BaseAccessor;
 import dev.derklaro.reflexion.ReflexionException;
+import java.lang.reflect.Field;
+import java.lang.reflect.Member;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.HashMap;
 import java.util.HashSet;
+import java.util.List;
 import java.util.Map;
 import java.util.Set;
 import java.util.function.BiPredicate;
@@ -138,17 +144,82 @@ public static int fastModulo(int leftOperator, int rightOperator) {
 
   /**
    * Throws the given exception as an unchecked exception removing the need to catch non-runtime exceptions.
+   * <p>
+   * The method is declared to return an exception, allowing callers to write {@code throw Util.throwUnchecked(ex)}
+   * to signal the compiler that the method never completes normally.
    *
    * @param throwable the throwable to rethrow.
    * @param <T>       the inferred type of the throwable.
+   * @return never returns normally.
    * @throws T                    the exception to rethrow.
    * @throws NullPointerException if the given throwable is null.
    */
   @SuppressWarnings("unchecked")
-  public static <T extends Throwable> void throwUnchecked(@NonNull Throwable throwable) throws T {
+  public static <T extends Throwable> RuntimeException throwUnchecked(@NonNull Throwable throwable) throws T {
     throw (T) throwable;
   }
 
+  /**
+   * Get the instance an accessor should use for an operation which was not given an explicit instance. This is the
+   * binding of the reflexion instance which created the accessor, or null if the wrapped member is static.
+   *
+   * @param accessor the accessor to get the implicit instance of.
+   * @return the instance to use for the operation, null if the member is static or the reflexion is not bound.
+   * @throws NullPointerException if the given accessor is null.
+   */
+  public static @Nullable Object implicitInstance(@NonNull BaseAccessor<?> accessor) {
+    return Modifier.isStatic(accessor.getMember().getModifiers()) ? null : accessor.getReflexion().getBinding();
+  }
+
+  /**
+   * Checks if the given instance can be used to access the given instance member. Accessors which access memory
+   * without checks by the jvm (for example using jni or unsafe) must validate the instance first, as passing an
+   * instance of another type (or null) would corrupt the jvm.
+   *
+   * @param member   the instance field or method to access.
+   * @param owner    the declaring class of the member.
+   * @param instance the instance to check.
+   * @return the given instance.
+   * @throws NullPointerException     if the given member or owner is null or the member requires an instance.
+   * @throws IllegalArgumentException if the given instance is not an instance of the declaring class of the member.
+   */
+  public static @NonNull Object checkInstance(
+    @NonNull Member member,
+    @NonNull Class<?> owner,
+    @Nullable Object instance
+  ) {
+    if (owner.isInstance(instance)) {
+      return instance;
+    }
+
+    boolean field = member instanceof Field;
+    if (instance == null) {
+      throw new NullPointerException((field ? "Field " : "Method ") + member + " requires an instance");
+    }
+    throw new IllegalArgumentException(
+      (field ? "Cannot access field " : "Cannot invoke method ") + member + " on instance of "
+        + instance.getClass().getName());
+  }
+
+  /**
+   * Checks if the given value can be stored in the given reference field. Accessors which access memory without checks
+   * by the jvm (for example using jni or unsafe) must validate the value first, as storing a value of another type
+   * would corrupt the jvm.
+   *
+   * @param field the reference field to store the value in.
+   * @param value the value to check.
+   * @return the given value.
+   * @throws NullPointerException     if the given field is null.
+   * @throws IllegalArgumentException if the given value is not assignable to the type of the field.
+   */
+  public static @Nullable Object checkFieldValue(@NonNull Field field, @Nullable Object value) {
+    if (value != null && !field.getType().isInstance(value)) {
+      throw new IllegalArgumentException(
+        "Cannot set field " + field + " to value of type " + value.getClass().getName());
+    }
+    return value;
+  }
+
   /**
    * Checks if all elements in both arrays match taking care of some edge cases to reduce computation time.
    *
@@ -191,6 +262,25 @@ public static <T> boolean allMatch(@Nullable T[] leftArr, @Nullable T[] rightArr
     return true;
   }
 
+  /**
+   * Applies all elements of the given list to the given mapper and returns a list containing the mapped elements in
+   * the order of the given list.
+   *
+   * @param in     the list to map the elements of.
+   * @param mapper the mapper to map the elements of the given list.
+   * @param <T>    the type of elements before the mapping.
+   * @param <O>    the type of elements after the mapping.
+   * @return a list containing all mapped elements of the given list.
+   * @throws NullPointerException if the given input list or mapper is null.
+   */
+  public static @NonNull <T, O> List<O> map(@NonNull List<T> in, @NonNull Function<T, O> mapper) {
+    List<O> out = new ArrayList<>(in.size());
+    for (T t : in) {
+      out.add(mapper.apply(t));
+    }
+    return out;
+  }
+
   /**
    * Filters all elements from the given collection and applies the matching ones to the given mapper and returns a
    * collection containing all filtered and mapped elements.
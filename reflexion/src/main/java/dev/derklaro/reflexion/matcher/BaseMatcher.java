@@ -24,9 +24,8 @@
 
 package dev.derklaro.reflexion.matcher;
 
-import dev.derklaro.reflexion.internal.util.Util;
 import java.lang.reflect.Member;
-import java.util.Arrays;
+import java.util.Collections;
 import java.util.function.Function;
 import java.util.function.Predicate;
 import java.util.regex.Pattern;
@@ -43,7 +42,22 @@
 @SuppressWarnings("unchecked") // we all love generics, don't we?
 public abstract class BaseMatcher<T extends Member, M extends BaseMatcher<T, M>> implements Predicate<T> {
 
-  protected Predicate<T> currentMatcher = $ -> true;
+  private static final Predicate<?> MATCH_ALL = $ -> true;
+
+  /**
+   * The matching predicate set by a subclass. Predicates assigned to this field are combined with the constraints
+   * recorded by this matcher using an AND operation the next time this matcher is compiled or modified, after which
+   * the field is reset to a predicate which matches all members.
+   *
+   * @deprecated the constraints of a matcher are now recorded as data, use {@link #and(Predicate)} or any of the other
+   * constraint methods instead. Predicates assigned to this field are evaluated as user provided predicates, which
+   * means that the results of this matcher are no longer memoized.
+   */
+  @Deprecated
+  protected Predicate<T> currentMatcher = (Predicate<T>) MATCH_ALL;
+
+  private MatcherNode<T> root = new MatcherNode.All<>(Collections.emptyList());
+  private volatile MatcherPlan<T> compiledPlan;
 
   /**
    * Checks if the member has the exact name which was supplied.
@@ -53,7 +67,7 @@
    * @throws NullPointerException if the given name is null.
    */
   public @NonNull M hasName(@NonNull String name) {
-    return this.and(member -> member.getName().equals(name));
+    return this.and(MatcherNode.Constraint.name(name));
   }
 
   /**
@@ -76,7 +90,7 @@
     }
 
     Pattern pattern = Pattern.compile(name, compiledFlags);
-    return this.and(member -> pattern.matcher(member.getName()).matches());
+    return this.and(MatcherNode.Constraint.namePattern(pattern));
   }
 
   /**
@@ -86,7 +100,7 @@
    * @return the same instance as used to call the method, for chaining.
    */
   public @NonNull M hasModifier(int mod) {
-    return this.and(member -> (member.getModifiers() & mod) == mod);
+    return this.and(MatcherNode.Constraint.value(MatcherNode.Kind.HAS_MODIFIERS, mod));
   }
 
   /**
@@ -112,7 +126,7 @@
    * @return the same instance as used to call the method, for chaining.
    */
   public @NonNull M denyModifier(int mod) {
-    return this.and(member -> (member.getModifiers() & mod) != mod);
+    return this.and(MatcherNode.Constraint.value(MatcherNode.Kind.DENY_MODIFIERS, mod));
   }
 
   /**
@@ -140,10 +154,7 @@
    * @throws NullPointerException if the given reader function or expected type is null.
    */
   public @NonNull M exactType(@NonNull Function<T, Class<?>> typeReader, @NonNull Class<?> expectedType) {
-    return this.and(member -> {
-      Class<?> type = typeReader.apply(member);
-      return type != null && type.equals(expectedType);
-    });
+    return this.and(MatcherNode.Constraint.type(MatcherNode.Kind.EXACT_TYPE, typeReader, expectedType, 0));
   }
 
   /**
@@ -156,10 +167,7 @@
    * @throws NullPointerException if the given reader function or expected type is null.
    */
   public @NonNull M superType(@NonNull Function<T, Class<?>> typeReader, @NonNull Class<?> expectedType) {
-    return this.and(member -> {
-      Class<?> type = typeReader.apply(member);
-      return type != null && type.isAssignableFrom(expectedType);
-    });
+    return this.and(MatcherNode.Constraint.type(MatcherNode.Kind.SUPER_TYPE, typeReader, expectedType, 0));
   }
 
   /**
@@ -172,10 +180,7 @@
    * @throws NullPointerException if the given type extractor or expected type is null.
    */
   public @NonNull M derivedType(@NonNull Function<T, Class<?>> typeReader, @NonNull Class<?> expectedType) {
-    return this.and(member -> {
-      Class<?> type = typeReader.apply(member);
-      return type != null && expectedType.isAssignableFrom(type);
-    });
+    return this.and(MatcherNode.Constraint.type(MatcherNode.Kind.DERIVED_TYPE, typeReader, expectedType, 0));
   }
 
   /**
@@ -187,10 +192,7 @@
    * @throws NullPointerException if the given extractor or expected type array is null.
    */
   public @NonNull M exactTypes(@NonNull Function<T, Class<?>[]> typesReader, @NonNull Class<?>... expectedTypes) {
-    return this.and(member -> {
-      Class<?>[] types = typesReader.apply(member);
-      return types != null && Arrays.equals(types, expectedTypes);
-    });
+    return this.and(MatcherNode.Constraint.types(MatcherNode.Kind.EXACT_TYPES, typesReader, expectedTypes));
   }
 
   /**
@@ -202,10 +204,7 @@
    * @throws NullPointerException if the given extractor or expected type array is null.
    */
   public @NonNull M superTypes(@NonNull Function<T, Class<?>[]> typesReader, @NonNull Class<?>... expectedTypes) {
-    return this.and(member -> {
-      Class<?>[] types = typesReader.apply(member);
-      return Util.allMatch(expectedTypes, types, (expected, actual) -> actual.isAssignableFrom(expected));
-    });
+    return this.and(MatcherNode.Constraint.types(MatcherNode.Kind.SUPER_TYPES, typesReader, expectedTypes));
   }
 
   /**
@@ -217,10 +216,7 @@
    * @throws NullPointerException if the given extractor or expected type array is null.
    */
   public @NonNull M derivedTypes(@NonNull Function<T, Class<?>[]> reader, @NonNull Class<?>... expectedTypes) {
-    return this.and(member -> {
-      Class<?>[] types = reader.apply(member);
-      return Util.allMatch(expectedTypes, types, Class::isAssignableFrom);
-    });
+    return this.and(MatcherNode.Constraint.types(MatcherNode.Kind.DERIVED_TYPES, reader, expectedTypes));
   }
 
   /**
@@ -234,10 +230,7 @@
    * @throws NullPointerException if the given type reader or expected type is null.
    */
   public @NonNull M exactTypeAt(@NonNull Function<T, Class<?>[]> typesReader, @NonNull Class<?> expectedType, int idx) {
-    return this.and(member -> {
-      Class<?>[] types = typesReader.apply(member);
-      return types != null && idx >= 0 && types.length > idx && types[idx].equals(expectedType);
-    });
+    return this.and(MatcherNode.Constraint.type(MatcherNode.Kind.EXACT_TYPE_AT, typesReader, expectedType, idx));
   }
 
   /**
@@ -252,10 +245,7 @@
    * @throws NullPointerException if the given type reader or expected type is null.
    */
   public @NonNull M superTypeAt(@NonNull Function<T, Class<?>[]> typesReader, @NonNull Class<?> expectedType, int idx) {
-    return this.and(member -> {
-      Class<?>[] types = typesReader.apply(member);
-      return types != null && idx >= 0 && types.length > idx && types[idx].isAssignableFrom(expectedType);
-    });
+    return this.and(MatcherNode.Constraint.type(MatcherNode.Kind.SUPER_TYPE_AT, typesReader, expectedType, idx));
   }
 
   /**
@@ -270,10 +260,26 @@
    * @throws NullPointerException if the given type reader or expected type is null.
    */
   public @NonNull M derivedTypeAt(@NonNull Function<T, Class<?>[]> reader, @NonNull Class<?> expectedType, int idx) {
-    return this.and(member -> {
-      Class<?>[] types = reader.apply(member);
-      return types != null && idx >= 0 && types.length > idx && expectedType.isAssignableFrom(types[idx]);
-    });
+    return this.and(MatcherNode.Constraint.type(MatcherNode.Kind.DERIVED_TYPE_AT, reader, expectedType, idx));
+  }
+
+  /**
+   * Compiles the constraints added to this matcher into a plan. The plan evaluates cheap constraints (like modifier
+   * checks) first and exposes the information needed to look up candidates using an index rather than testing every
+   * member. Two plans are equal if they were compiled from structurally equal matchers of the same type, which allows
+   * callers to use them as a cache key. The returned plan is not affected by later modifications of this matcher.
+   *
+   * @return the compiled plan of this matcher.
+   * @since 1.4
+   */
+  public @NonNull MatcherPlan<T> compile() {
+    MatcherNode<T> root = this.root();
+    MatcherPlan<T> plan = this.compiledPlan;
+    if (plan == null) {
+      plan = MatcherPlan.compile(this.getClass(), root);
+      this.compiledPlan = plan;
+    }
+    return plan;
   }
 
   /**
@@ -281,7 +287,7 @@
    */
   @Override
   public boolean test(T t) {
-    return this.currentMatcher.test(t);
+    return this.compile().test(t);
   }
 
   /**
@@ -294,7 +300,7 @@ public boolean test(T t) {
    */
   @Override
   public @NonNull M and(@NonNull Predicate<? super T> other) {
-    this.currentMatcher = this.currentMatcher.and(other);
+    this.update(MatcherNode.and(this.root(), MatcherNode.of(other)));
     return (M) this;
   }
 
@@ -308,7 +314,7 @@ public boolean test(T t) {
    */
   @Override
   public @NonNull M or(@NonNull Predicate<? super T> other) {
-    this.currentMatcher = this.currentMatcher.or(other);
+    this.update(MatcherNode.or(this.root(), MatcherNode.of(other)));
     return (M) this;
   }
 
@@ -320,7 +326,32 @@ public boolean test(T t) {
    */
   @Override
   public @NonNull M negate() {
-    this.currentMatcher = this.currentMatcher.negate();
+    this.update(MatcherNode.not(this.root()));
     return (M) this;
   }
+
+  /**
+   * Get the current root node of the constraint tree of this matcher, folding the predicate assigned to the deprecated
+   * {@link #currentMatcher} field by a subclass into the tree first.
+   *
+   * @return the current root node of this matcher.
+   */
+  @NonNull MatcherNode<T> root() {
+    Predicate<T> legacyMatcher = this.currentMatcher;
+    if (legacyMatcher != MATCH_ALL) {
+      this.currentMatcher = (Predicate<T>) MATCH_ALL;
+      this.update(MatcherNode.and(this.root, MatcherNode.of(legacyMatcher)));
+    }
+    return this.root;
+  }
+
+  /**
+   * Replaces the root node of this matcher and drops the plan compiled for the previous root.
+   *
+   * @param root the new root node of this matcher.
+   */
+  private void update(@NonNull MatcherNode<T> root) {
+    this.root = root;
+    this.compiledPlan = null;
+  }
 }
@@ -25,6 +25,7 @@
 package dev.derklaro.reflexion.matcher;
 
 import java.lang.reflect.Constructor;
+import java.util.function.Function;
 import lombok.NonNull;
 
 /**
@@ -53,6 +54,40 @@ private ConstructorMatcher() {
    * @return the same instance as used to call the method, for chaining.
    */
   public @NonNull ConstructorMatcher parameterCount(int count) {
-    return this.and(member -> member.getParameterCount() == count);
+    return this.and(MatcherNode.Constraint.value(MatcherNode.Kind.PARAMETER_COUNT, count));
+  }
+
+  /**
+   * Checks if the parameter types of the constructor are exactly the given types. Other than
+   * {@link #exactTypes(Function, Class[])} the result of this check only depends on the constructor and the results of
+   * the matcher can therefore be cached.
+   *
+   * @param expectedTypes the parameter types the constructor must have.
+   * @return the same instance as used to call the method, for chaining.
+   * @throws NullPointerException if the given type array is null.
+   * @since 1.4
+   */
+  public @NonNull ConstructorMatcher exactParameterTypes(@NonNull Class<?>... expectedTypes) {
+    return this.and(MatcherNode.Constraint.types(
+      MatcherNode.Kind.EXACT_TYPES,
+      MatcherNode.TypeReader.PARAMETER_TYPES,
+      expectedTypes));
+  }
+
+  /**
+   * Checks if each parameter type of the constructor is the given type or a subtype of it (parameter type instanceof
+   * expected). Other than {@link #derivedTypes(Function, Class[])} the result of this check only depends on the
+   * constructor and the results of the matcher can therefore be cached.
+   *
+   * @param expectedTypes the types the parameter types of the constructor must be assignable to.
+   * @return the same instance as used to call the method, for chaining.
+   * @throws NullPointerException if the given type array is null.
+   * @since 1.4
+   */
+  public @NonNull ConstructorMatcher derivedParameterTypes(@NonNull Class<?>... expectedTypes) {
+    return this.and(MatcherNode.Constraint.types(
+      MatcherNode.Kind.DERIVED_TYPES,
+      MatcherNode.TypeReader.PARAMETER_TYPES,
+      expectedTypes));
   }
 }
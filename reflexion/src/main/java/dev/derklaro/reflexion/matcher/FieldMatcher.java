@@ -25,6 +25,7 @@
 package dev.derklaro.reflexion.matcher;
 
 import java.lang.reflect.Field;
+import java.util.function.Function;
 import lombok.NonNull;
 
 /**
@@ -45,4 +46,39 @@ private FieldMatcher() {
   public static @NonNull FieldMatcher newMatcher() {
     return new FieldMatcher();
   }
+
+  /**
+   * Checks if the type of the field is exactly the given type. Other than {@link #exactType(Function, Class)} the
+   * result of this check only depends on the field and the results of the matcher can therefore be cached.
+   *
+   * @param expectedType the type the field must have.
+   * @return the same instance as used to call the method, for chaining.
+   * @throws NullPointerException if the given type is null.
+   * @since 1.4
+   */
+  public @NonNull FieldMatcher exactType(@NonNull Class<?> expectedType) {
+    return this.and(MatcherNode.Constraint.type(
+      MatcherNode.Kind.EXACT_TYPE,
+      MatcherNode.TypeReader.FIELD_TYPE,
+      expectedType,
+      0));
+  }
+
+  /**
+   * Checks if the type of the field is the given type or a subtype of it (field type instanceof expected). Other than
+   * {@link #derivedType(Function, Class)} the result of this check only depends on the field and the results of the
+   * matcher can therefore be cached.
+   *
+   * @param expectedType the type the field type must be assignable to.
+   * @return the same instance as used to call the method, for chaining.
+   * @throws NullPointerException if the given type is null.
+   * @since 1.4
+   */
+  public @NonNull FieldMatcher derivedType(@NonNull Class<?> expectedType) {
+    return this.and(MatcherNode.Constraint.type(
+      MatcherNode.Kind.DERIVED_TYPE,
+      MatcherNode.TypeReader.FIELD_TYPE,
+      expectedType,
+      0));
+  }
 }
@@ -0,0 +1,767 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.matcher;
+
+import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.reflect.Executable;
+import java.lang.reflect.Field;
+import java.lang.reflect.Member;
+import java.lang.reflect.Method;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.List;
+import java.util.Objects;
+import java.util.function.Function;
+import java.util.function.Predicate;
+import java.util.regex.Pattern;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * Internal: a node in the constraint tree of a matcher. All nodes are immutable, therefore a compiled plan can safely
+ * keep a reference to the tree of the matcher while the matcher itself is modified further.
+ *
+ * @param <T> the type of member matched by the node.
+ * @since 1.4
+ */
+abstract class MatcherNode<T extends Member> implements Predicate<T> {
+
+  // the relative costs of evaluating a node, cheap nodes are evaluated first
+  static final int COST_MODIFIERS = 0;
+  static final int COST_NAME = 1;
+  static final int COST_TYPE = 2;
+  static final int COST_TYPES = 3;
+  static final int COST_PATTERN = 4;
+  static final int COST_CUSTOM = 5;
+
+  /**
+   * Get the relative cost of evaluating this node.
+   *
+   * @return the relative cost of evaluating this node.
+   */
+  abstract int cost();
+
+  /**
+   * Get if the result of this node only depends on the tested member, which is the case for all nodes that are not
+   * based on a user provided predicate or type reader function.
+   *
+   * @return true if the result of this node can be cached, false otherwise.
+   */
+  abstract boolean cacheable();
+
+  /**
+   * Converts the given predicate into a node. Matchers are converted into their current constraint tree, other
+   * predicates are wrapped as custom nodes.
+   *
+   * @param predicate the predicate to convert.
+   * @param <T>       the type of member matched by the predicate.
+   * @return a node for the given predicate.
+   * @throws NullPointerException if the given predicate is null.
+   */
+  @SuppressWarnings("unchecked")
+  static @NonNull <T extends Member> MatcherNode<T> of(@NonNull Predicate<? super T> predicate) {
+    if (predicate instanceof MatcherNode<?>) {
+      return (MatcherNode<T>) predicate;
+    } else if (predicate instanceof BaseMatcher<?, ?>) {
+      return ((BaseMatcher<T, ?>) predicate).root();
+    } else {
+      return new Custom<>(predicate);
+    }
+  }
+
+  /**
+   * Combines the given nodes using an AND operation, flattening nested AND nodes.
+   *
+   * @param left  the left side of the operation.
+   * @param right the right side of the operation.
+   * @param <T>   the type of member matched by the nodes.
+   * @return a node which matches if both given nodes match.
+   * @throws NullPointerException if one of the given nodes is null.
+   */
+  static @NonNull <T extends Member> MatcherNode<T> and(@NonNull MatcherNode<T> left, @NonNull MatcherNode<T> right) {
+    List<MatcherNode<T>> children = new ArrayList<>();
+    addFlattened(children, left, All.class);
+    addFlattened(children, right, All.class);
+    return new All<>(children);
+  }
+
+  /**
+   * Combines the given nodes using an OR operation, flattening nested OR nodes.
+   *
+   * @param left  the left side of the operation.
+   * @param right the right side of the operation.
+   * @param <T>   the type of member matched by the nodes.
+   * @return a node which matches if one of the given nodes matches.
+   * @throws NullPointerException if one of the given nodes is null.
+   */
+  static @NonNull <T extends Member> MatcherNode<T> or(@NonNull MatcherNode<T> left, @NonNull MatcherNode<T> right) {
+    List<MatcherNode<T>> children = new ArrayList<>();
+    addFlattened(children, left, Any.class);
+    addFlattened(children, right, Any.class);
+    return new Any<>(children);
+  }
+
+  /**
+   * Negates the given node, removing a double negation.
+   *
+   * @param node the node to negate.
+   * @param <T>  the type of member matched by the node.
+   * @return a node which matches if the given node does not match.
+   * @throws NullPointerException if the given node is null.
+   */
+  static @NonNull <T extends Member> MatcherNode<T> not(@NonNull MatcherNode<T> node) {
+    return node instanceof Not<?> ? ((Not<T>) node).child : new Not<>(node);
+  }
+
+  /**
+   * Adds the given node to the given list, adding the children of the node instead if it is of the given group type.
+   *
+   * @param target the list to add the node to.
+   * @param node   the node to add.
+   * @param group  the type of group node to flatten.
+   * @param <T>    the type of member matched by the node.
+   */
+  private static <T extends Member> void addFlattened(
+    @NonNull List<MatcherNode<T>> target,
+    @NonNull MatcherNode<T> node,
+    @NonNull Class<?> group
+  ) {
+    if (group.isInstance(node)) {
+      target.addAll(((Group<T>) node).children);
+    } else {
+      target.add(node);
+    }
+  }
+
+  /**
+   * The kinds of constraints which can be expressed without a user provided predicate.
+   *
+   * @since 1.4
+   */
+  enum Kind {
+
+    NAME(COST_NAME),
+    NAME_PATTERN(COST_PATTERN),
+    HAS_MODIFIERS(COST_MODIFIERS),
+    DENY_MODIFIERS(COST_MODIFIERS),
+    PARAMETER_COUNT(COST_MODIFIERS),
+    EXACT_TYPE(COST_TYPE),
+    SUPER_TYPE(COST_TYPE),
+    DERIVED_TYPE(COST_TYPE),
+    EXACT_TYPES(COST_TYPES),
+    SUPER_TYPES(COST_TYPES),
+    DERIVED_TYPES(COST_TYPES),
+    EXACT_TYPE_AT(COST_TYPES),
+    SUPER_TYPE_AT(COST_TYPES),
+    DERIVED_TYPE_AT(COST_TYPES);
+
+    private final int cost;
+
+    /**
+     * Constructs a new constraint kind.
+     *
+     * @param cost the relative cost of evaluating a constraint of the kind.
+     */
+    Kind(int cost) {
+      this.cost = cost;
+    }
+  }
+
+  /**
+   * The built-in readers for the types of a member. Other than user provided reader functions the built-in readers
+   * only depend on the member and are equal by value, therefore constraints using them can be cached.
+   *
+   * @since 1.4
+   */
+  enum TypeReader implements Function<Member, Object> {
+
+    FIELD_TYPE {
+      @Override
+      public Object apply(Member member) {
+        return ((Field) member).getType();
+      }
+    },
+    RETURN_TYPE {
+      @Override
+      public Object apply(Member member) {
+        return ((Method) member).getReturnType();
+      }
+    },
+    PARAMETER_TYPES {
+      @Override
+      public Object apply(Member member) {
+        return ((Executable) member).getParameterTypes();
+      }
+    }
+  }
+
+  /**
+   * A single constraint which is recorded as data. Depending on the kind of the constraint only some of the fields are
+   * set, the unused fields are null (or 0). Type constraints are only cacheable if they use a built-in type reader, a
+   * user provided reader function might depend on some external state.
+   *
+   * @param <T> the type of member matched by the constraint.
+   * @since 1.4
+   */
+  static final class Constraint<T extends Member> extends MatcherNode<T> {
+
+    private final Kind kind;
+    private final @Nullable String name;
+    private final @Nullable Pattern pattern;
+    private final int value;
+    private final @Nullable Function<? super T, ?> reader;
+    private final @Nullable Class<?> type;
+    private final Class<?> @Nullable [] types;
+
+    /**
+     * Constructs a new constraint.
+     *
+     * @param kind    the kind of the constraint.
+     * @param name    the expected name, for name constraints.
+     * @param pattern the pattern the name must match, for pattern constraints.
+     * @param value   the modifiers, parameter count or index, depending on the kind.
+     * @param reader  the function reading the type(s) from the member, for type constraints.
+     * @param type    the expected type, for single type constraints.
+     * @param types   the expected types, for multi type constraints.
+     */
+    private Constraint(
+      @NonNull Kind kind,
+      @Nullable String name,
+      @Nullable Pattern pattern,
+      int value,
+      @Nullable Function<? super T, ?> reader,
+      @Nullable Class<?> type,
+      Class<?> @Nullable [] types
+    ) {
+      this.kind = kind;
+      this.name = name;
+      this.pattern = pattern;
+      this.value = value;
+      this.reader = reader;
+      this.type = type;
+      this.types = types == null ? null : types.clone();
+    }
+
+    /**
+     * Creates a constraint which checks the exact name of the member.
+     *
+     * @param name the expected name of the member.
+     * @param <T>  the type of member matched by the constraint.
+     * @return a new name constraint.
+     */
+    static @NonNull <T extends Member> Constraint<T> name(@NonNull String name) {
+      return new Constraint<>(Kind.NAME, name, null, 0, null, null, null);
+    }
+
+    /**
+     * Creates a constraint which checks if the name of the member matches the given pattern.
+     *
+     * @param pattern the pattern the name must match.
+     * @param <T>     the type of member matched by the constraint.
+     * @return a new name pattern constraint.
+     */
+    static @NonNull <T extends Member> Constraint<T> namePattern(@NonNull Pattern pattern) {
+      return new Constraint<>(Kind.NAME_PATTERN, null, pattern, 0, null, null, null);
+    }
+
+    /**
+     * Creates a constraint which checks the modifiers or parameter count of the member.
+     *
+     * @param kind  the kind of the constraint, one of the modifier kinds or the parameter count kind.
+     * @param value the modifiers or the parameter count to check.
+     * @param <T>   the type of member matched by the constraint.
+     * @return a new modifier or parameter count constraint.
+     */
+    static @NonNull <T extends Member> Constraint<T> value(@NonNull Kind kind, int value) {
+      return new Constraint<>(kind, null, null, value, null, null, null);
+    }
+
+    /**
+     * Creates a constraint which checks a single type read from the member.
+     *
+     * @param kind   the kind of type check, one of the single type kinds.
+     * @param reader the reader for the type to check.
+     * @param type   the expected type.
+     * @param idx    the index of the type to check, for the kinds which check a type in an array.
+     * @param <T>    the type of member matched by the constraint.
+     * @return a new type constraint.
+     */
+    static @NonNull <T extends Member> Constraint<T> type(
+      @NonNull Kind kind,
+      @NonNull Function<? super T, ?> reader,
+      @NonNull Class<?> type,
+      int idx
+    ) {
+      return new Constraint<>(kind, null, null, idx, reader, type, null);
+    }
+
+    /**
+     * Creates a constraint which checks an array of types read from the member.
+     *
+     * @param kind   the kind of type check, one of the multi type kinds.
+     * @param reader the reader for the types to check.
+     * @param types  the expected types.
+     * @param <T>    the type of member matched by the constraint.
+     * @return a new types constraint.
+     */
+    static @NonNull <T extends Member> Constraint<T> types(
+      @NonNull Kind kind,
+      @NonNull Function<? super T, ?> reader,
+      @NonNull Class<?>[] types
+    ) {
+      return new Constraint<>(kind, null, null, 0, reader, null, types);
+    }
+
+    /**
+     * Get the name expected by this constraint if this constraint checks the exact name of a member.
+     *
+     * @return the exact name expected by this constraint, null if this constraint does not check the exact name.
+     */
+    @Nullable String exactName() {
+      return this.kind == Kind.NAME ? this.name : null;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    int cost() {
+      return this.kind.cost;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    boolean cacheable() {
+      return this.reader == null || this.reader instanceof TypeReader;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    @SuppressWarnings("ConstantConditions")
+    public boolean test(T member) {
+      switch (this.kind) {
+        case NAME:
+          return member.getName().equals(this.name);
+        case NAME_PATTERN:
+          return this.pattern.matcher(member.getName()).matches();
+        case HAS_MODIFIERS:
+          return (member.getModifiers() & this.value) == this.value;
+        case DENY_MODIFIERS:
+          return (member.getModifiers() & this.value) != this.value;
+        case PARAMETER_COUNT:
+          return ((Executable) member).getParameterCount() == this.value;
+        case EXACT_TYPE: {
+          Class<?> type = (Class<?>) this.reader.apply(member);
+          return type != null && type.equals(this.type);
+        }
+        case SUPER_TYPE: {
+          Class<?> type = (Class<?>) this.reader.apply(member);
+          return type != null && type.isAssignableFrom(this.type);
+        }
+        case DERIVED_TYPE: {
+          Class<?> type = (Class<?>) this.reader.apply(member);
+          return type != null && this.type.isAssignableFrom(type);
+        }
+        case EXACT_TYPES: {
+          Class<?>[] types = (Class<?>[]) this.reader.apply(member);
+          return types != null && Arrays.equals(types, this.types);
+        }
+        case SUPER_TYPES: {
+          Class<?>[] types = (Class<?>[]) this.reader.apply(member);
+          return Util.allMatch(this.types, types, (expected, actual) -> actual.isAssignableFrom(expected));
+        }
+        case DERIVED_TYPES: {
+          Class<?>[] types = (Class<?>[]) this.reader.apply(member);
+          return Util.allMatch(this.types, types, Class::isAssignableFrom);
+        }
+        case EXACT_TYPE_AT: {
+          Class<?>[] types = (Class<?>[]) this.reader.apply(member);
+          return types != null && this.value >= 0 && types.length > this.value && types[this.value].equals(this.type);
+        }
+        case SUPER_TYPE_AT: {
+          Class<?>[] types = (Class<?>[]) this.reader.apply(member);
+          return types != null
+            && this.value >= 0
+            && types.length > this.value
+            && types[this.value].isAssignableFrom(this.type);
+        }
+        case DERIVED_TYPE_AT: {
+          Class<?>[] types = (Class<?>[]) this.reader.apply(member);
+          return types != null
+            && this.value >= 0
+            && types.length > this.value
+            && this.type.isAssignableFrom(types[this.value]);
+        }
+        default:
+          throw new IllegalStateException("Unhandled constraint kind " + this.kind);
+      }
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean equals(Object o) {
+      if (this == o) {
+        return true;
+      }
+      if (!(o instanceof Constraint<?>)) {
+        return false;
+      }
+
+      Constraint<?> that = (Constraint<?>) o;
+      return this.kind == that.kind
+        && this.value == that.value
+        && Objects.equals(this.name, that.name)
+        && Objects.equals(this.pattern == null ? null : this.pattern.pattern(),
+        that.pattern == null ? null : that.pattern.pattern())
+        && (this.pattern == null ? 0 : this.pattern.flags()) == (that.pattern == null ? 0 : that.pattern.flags())
+        && Objects.equals(this.reader, that.reader)
+        && Objects.equals(this.type, that.type)
+        && Arrays.equals(this.types, that.types);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int hashCode() {
+      int result = Objects.hash(
+        this.kind,
+        this.name,
+        this.pattern == null ? null : this.pattern.pattern(),
+        this.value,
+        this.reader,
+        this.type);
+      return 31 * result + Arrays.hashCode(this.types);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull String toString() {
+      switch (this.kind) {
+        case NAME:
+          return "name == " + this.name;
+        case NAME_PATTERN:
+          return "name ~= " + this.pattern.pattern();
+        case HAS_MODIFIERS:
+        case DENY_MODIFIERS:
+        case PARAMETER_COUNT:
+          return this.kind.name().toLowerCase() + "(" + this.value + ")";
+        default:
+          return this.kind.name().toLowerCase() + "(" + (this.types == null
+            ? this.type + (this.kind.cost == COST_TYPES ? " @ " + this.value : "")
+            : Arrays.toString(this.types)) + ")";
+      }
+    }
+  }
+
+  /**
+   * A node wrapping a user provided predicate. Custom nodes are only equal to nodes wrapping the same predicate
+   * instance and are never cacheable, as their result might depend on some external state.
+   *
+   * @param <T> the type of member matched by the node.
+   * @since 1.4
+   */
+  static final class Custom<T extends Member> extends MatcherNode<T> {
+
+    private final Predicate<? super T> predicate;
+
+    /**
+     * Constructs a new custom node.
+     *
+     * @param predicate the predicate to wrap.
+     */
+    private Custom(@NonNull Predicate<? super T> predicate) {
+      this.predicate = predicate;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    int cost() {
+      return COST_CUSTOM;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    boolean cacheable() {
+      return false;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean test(T member) {
+      return this.predicate.test(member);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean equals(Object o) {
+      return this == o || (o instanceof Custom<?> && ((Custom<?>) o).predicate == this.predicate);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int hashCode() {
+      return System.identityHashCode(this.predicate);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull String toString() {
+      return "custom(" + this.predicate + ")";
+    }
+  }
+
+  /**
+   * The base for nodes which combine multiple child nodes.
+   *
+   * @param <T> the type of member matched by the node.
+   * @since 1.4
+   */
+  abstract static class Group<T extends Member> extends MatcherNode<T> {
+
+    final List<MatcherNode<T>> children;
+    private final int cost;
+    private final boolean cacheable;
+
+    /**
+     * Constructs a new group node.
+     *
+     * @param children the children of the group.
+     */
+    private Group(@NonNull List<MatcherNode<T>> children) {
+      this.children = Collections.unmodifiableList(children);
+
+      // the group is as expensive as the most expensive child
+      int cost = COST_MODIFIERS;
+      boolean cacheable = true;
+      for (MatcherNode<T> child : children) {
+        cost = Math.max(cost, child.cost());
+        cacheable &= child.cacheable();
+      }
+      this.cost = cost;
+      this.cacheable = cacheable;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    int cost() {
+      return this.cost;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    boolean cacheable() {
+      return this.cacheable;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean equals(Object o) {
+      return this == o || (o != null && o.getClass() == this.getClass()
+        && this.children.equals(((Group<?>) o).children));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int hashCode() {
+      return 31 * this.getClass().hashCode() + this.children.hashCode();
+    }
+  }
+
+  /**
+   * A node which matches if all children match, the empty node matches all members.
+   *
+   * @param <T> the type of member matched by the node.
+   * @since 1.4
+   */
+  static final class All<T extends Member> extends Group<T> {
+
+    /**
+     * Constructs a new AND node.
+     *
+     * @param children the children which must all match.
+     */
+    All(@NonNull List<MatcherNode<T>> children) {
+      super(children);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean test(T member) {
+      for (MatcherNode<T> child : this.children) {
+        if (!child.test(member)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull String toString() {
+      return "all" + this.children;
+    }
+  }
+
+  /**
+   * A node which matches if any child matches.
+   *
+   * @param <T> the type of member matched by the node.
+   * @since 1.4
+   */
+  static final class Any<T extends Member> extends Group<T> {
+
+    /**
+     * Constructs a new OR node.
+     *
+     * @param children the children of which one must match.
+     */
+    Any(@NonNull List<MatcherNode<T>> children) {
+      super(children);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean test(T member) {
+      for (MatcherNode<T> child : this.children) {
+        if (child.test(member)) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull String toString() {
+      return "any" + this.children;
+    }
+  }
+
+  /**
+   * A node which negates its child.
+   *
+   * @param <T> the type of member matched by the node.
+   * @since 1.4
+   */
+  static final class Not<T extends Member> extends MatcherNode<T> {
+
+    private final MatcherNode<T> child;
+
+    /**
+     * Constructs a new negation node.
+     *
+     * @param child the node to negate.
+     */
+    private Not(@NonNull MatcherNode<T> child) {
+      this.child = child;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    int cost() {
+      return this.child.cost();
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    boolean cacheable() {
+      return this.child.cacheable();
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean test(T member) {
+      return !this.child.test(member);
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public boolean equals(Object o) {
+      return this == o || (o instanceof Not<?> && this.child.equals(((Not<?>) o).child));
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public int hashCode() {
+      return ~this.child.hashCode();
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public @NonNull String toString() {
+      return "not(" + this.child + ")";
+    }
+  }
+}
@@ -0,0 +1,190 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion.matcher;
+
+import java.lang.reflect.Member;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.List;
+import java.util.function.Predicate;
+import lombok.NonNull;
+import org.jetbrains.annotations.Nullable;
+
+/**
+ * A compiled, immutable representation of the constraints of a matcher. The top level constraints of a plan are
+ * ordered by their evaluation cost, for example modifier checks are executed before any type check or regular
+ * expression. Constraints based on predicates which were supplied by the user are always evaluated last, but keep
+ * their relative order.
+ *
+ * <p>Plans are structurally comparable: two plans are equal if they were compiled from matchers of the same type which
+ * have equal constraints. Note that type readers and custom predicates are compared by identity, so constraints which
+ * use them are only equal if the same reader or predicate instance was supplied.
+ *
+ * @param <T> the type of member matched by this plan.
+ * @since 1.4
+ */
+public final class MatcherPlan<T extends Member> implements Predicate<T> {
+
+  private final Class<?> matcherType;
+  private final List<MatcherNode<T>> constraints;
+  private final @Nullable String requiredName;
+  private final boolean cacheable;
+  private final int hashCode;
+
+  /**
+   * Constructs a new matcher plan.
+   *
+   * @param matcherType  the type of matcher the plan was compiled from.
+   * @param constraints  the top level constraints of the plan, ordered by their cost.
+   * @param requiredName the exact name a member must have to match, null if not known.
+   * @param cacheable    if the result of the plan only depends on the tested member.
+   */
+  private MatcherPlan(
+    @NonNull Class<?> matcherType,
+    @NonNull List<MatcherNode<T>> constraints,
+    @Nullable String requiredName,
+    boolean cacheable
+  ) {
+    this.matcherType = matcherType;
+    this.constraints = constraints;
+    this.requiredName = requiredName;
+    this.cacheable = cacheable;
+    this.hashCode = 31 * matcherType.hashCode() + constraints.hashCode();
+  }
+
+  /**
+   * Compiles the given constraint tree into a plan.
+   *
+   * @param matcherType the type of matcher the tree belongs to.
+   * @param root        the root node of the constraint tree.
+   * @param <T>         the type of member matched by the tree.
+   * @return a plan for the given constraint tree.
+   * @throws NullPointerException if the given matcher type or root node is null.
+   */
+  static @NonNull <T extends Member> MatcherPlan<T> compile(
+    @NonNull Class<?> matcherType,
+    @NonNull MatcherNode<T> root
+  ) {
+    // the top level constraints of the plan which must all match
+    List<MatcherNode<T>> constraints = new ArrayList<>();
+    if (root instanceof MatcherNode.All<?>) {
+      constraints.addAll(((MatcherNode.All<T>) root).children);
+    } else {
+      constraints.add(root);
+    }
+
+    // the sort is stable, nodes with the same cost (for example custom predicates) keep their relative order
+    constraints.sort(Comparator.comparingInt(MatcherNode::cost));
+
+    String requiredName = null;
+    boolean cacheable = true;
+    for (MatcherNode<T> constraint : constraints) {
+      cacheable &= constraint.cacheable();
+      if (requiredName == null && constraint instanceof MatcherNode.Constraint<?>) {
+        requiredName = ((MatcherNode.Constraint<T>) constraint).exactName();
+      }
+    }
+
+    return new MatcherPlan<>(matcherType, Collections.unmodifiableList(constraints), requiredName, cacheable);
+  }
+
+  /**
+   * Get the exact name a member must have in order to be matched by this plan. Callers can use the name to look up
+   * the candidates to test in a name index; members with any other name will never match.
+   *
+   * @return the exact name a member must have to match, null if this plan has no top level exact name constraint.
+   */
+  public @Nullable String getRequiredName() {
+    return this.requiredName;
+  }
+
+  /**
+   * Get if the result of this plan only depends on the tested member. This is not the case if the plan contains a
+   * custom predicate or type reader function which might depend on some external state. The results of cacheable plans
+   * can be memoized.
+   *
+   * @return true if the results of this plan can be memoized, false otherwise.
+   */
+  public boolean isCacheable() {
+    return this.cacheable;
+  }
+
+  /**
+   * Get the amount of top level constraints of this plan which must all match.
+   *
+   * @return the amount of top level constraints of this plan.
+   */
+  public int getConstraintCount() {
+    return this.constraints.size();
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public boolean test(T member) {
+    for (MatcherNode<T> constraint : this.constraints) {
+      if (!constraint.test(member)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public boolean equals(Object o) {
+    if (this == o) {
+      return true;
+    }
+    if (!(o instanceof MatcherPlan<?>)) {
+      return false;
+    }
+
+    MatcherPlan<?> that = (MatcherPlan<?>) o;
+    return this.hashCode == that.hashCode
+      && this.matcherType.equals(that.matcherType)
+      && this.constraints.equals(that.constraints);
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public int hashCode() {
+    return this.hashCode;
+  }
+
+  /**
+   * {@inheritDoc}
+   */
+  @Override
+  public @NonNull String toString() {
+    return this.matcherType.getSimpleName() + this.constraints;
+  }
+}
@@ -25,6 +25,7 @@
 package dev.derklaro.reflexion.matcher;
 
 import java.lang.reflect.Method;
+import java.util.function.Function;
 import lombok.NonNull;
 
 /**
@@ -53,6 +54,75 @@ private MethodMatcher() {
    * @return the same instance as used to call the method, for chaining.
    */
   public @NonNull MethodMatcher parameterCount(int count) {
-    return this.and(member -> member.getParameterCount() == count);
+    return this.and(MatcherNode.Constraint.value(MatcherNode.Kind.PARAMETER_COUNT, count));
+  }
+
+  /**
+   * Checks if the return type of the method is exactly the given type. Other than {@link #exactType(Function, Class)}
+   * the result of this check only depends on the method and the results of the matcher can therefore be cached.
+   *
+   * @param expectedType the return type the method must have.
+   * @return the same instance as used to call the method, for chaining.
+   * @throws NullPointerException if the given type is null.
+   * @since 1.4
+   */
+  public @NonNull MethodMatcher exactReturnType(@NonNull Class<?> expectedType) {
+    return this.and(MatcherNode.Constraint.type(
+      MatcherNode.Kind.EXACT_TYPE,
+      MatcherNode.TypeReader.RETURN_TYPE,
+      expectedType,
+      0));
+  }
+
+  /**
+   * Checks if the return type of the method is the given type or a subtype of it (return type instanceof expected).
+   * Other than {@link #derivedType(Function, Class)} the result of this check only depends on the method and the
+   * results of the matcher can therefore be cached.
+   *
+   * @param expectedType the type the return type of the method must be assignable to.
+   * @return the same instance as used to call the method, for chaining.
+   * @throws NullPointerException if the given type is null.
+   * @since 1.4
+   */
+  public @NonNull MethodMatcher derivedReturnType(@NonNull Class<?> expectedType) {
+    return this.and(MatcherNode.Constraint.type(
+      MatcherNode.Kind.DERIVED_TYPE,
+      MatcherNode.TypeReader.RETURN_TYPE,
+      expectedType,
+      0));
+  }
+
+  /**
+   * Checks if the parameter types of the method are exactly the given types. Other than
+   * {@link #exactTypes(Function, Class[])} the result of this check only depends on the method and the results of
+   * the matcher can therefore be cached.
+   *
+   * @param expectedTypes the parameter types the method must have.
+   * @return the same instance as used to call the method, for chaining.
+   * @throws NullPointerException if the given type array is null.
+   * @since 1.4
+   */
+  public @NonNull MethodMatcher exactParameterTypes(@NonNull Class<?>... expectedTypes) {
+    return this.and(MatcherNode.Constraint.types(
+      MatcherNode.Kind.EXACT_TYPES,
+      MatcherNode.TypeReader.PARAMETER_TYPES,
+      expectedTypes));
+  }
+
+  /**
+   * Checks if each parameter type of the method is the given type or a subtype of it (parameter type instanceof
+   * expected). Other than {@link #derivedTypes(Function, Class[])} the result of this check only depends on the
+   * method and the results of the matcher can therefore be cached.
+   *
+   * @param expectedTypes the types the parameter types of the method must be assignable to.
+   * @return the same instance as used to call the method, for chaining.
+   * @throws NullPointerException if the given type array is null.
+   * @since 1.4
+   */
+  public @NonNull MethodMatcher derivedParameterTypes(@NonNull Class<?>... expectedTypes) {
+    return this.and(MatcherNode.Constraint.types(
+      MatcherNode.Kind.DERIVED_TYPES,
+      MatcherNode.TypeReader.PARAMETER_TYPES,
+      expectedTypes));
   }
 }
@@ -0,0 +1,56 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.AccessorFactoryLoader;
+import dev.derklaro.reflexion.internal.bytecode.BytecodeAccessorFactory;
+import java.util.List;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+class AccessorFactorySelectionTest {
+
+  @Test
+  void testDefaultSelectionReport() {
+    AccessorFactorySelection selection = Reflexion.getFactorySelection();
+    Assertions.assertSame(Reflexion.ACCESSOR_FACTORY, selection.getSelectedFactory());
+    Assertions.assertFalse(selection.getProbes().isEmpty());
+    Assertions.assertTrue(selection.toString().contains(selection.getSelectedFactory().getClass().getName()));
+  }
+
+  @Test
+  void testProbingStopsAtFirstAvailableDefault() {
+    AccessorFactorySelection selection = AccessorFactoryLoader.selectFactory();
+    Assertions.assertInstanceOf(BytecodeAccessorFactory.class, selection.getSelectedFactory());
+
+    // the bytecode factory has the highest priority, no other default factory should have been constructed
+    List<AccessorFactorySelection.Probe> probes = selection.getProbes();
+    Assertions.assertEquals(1, probes.size());
+    Assertions.assertEquals(BytecodeAccessorFactory.class, probes.get(0).getFactoryType());
+    Assertions.assertTrue(probes.get(0).isAvailable());
+    Assertions.assertFalse(probes.get(0).isService());
+    Assertions.assertTrue(selection.getTotalTime().compareTo(probes.get(0).getProbeTime()) >= 0);
+  }
+}
@@ -24,10 +24,19 @@
 
 package dev.derklaro.reflexion;
 
+import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.bytecode.BytecodeAccessorFactory;
 import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.JniAccessorFactory;
 import dev.derklaro.reflexion.internal.natives.NativeAccessorFactory;
+import dev.derklaro.reflexion.internal.unsafe.UnsafeAccessorFactory;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodType;
 import java.lang.reflect.Constructor;
 import java.lang.reflect.Method;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
 import java.util.Optional;
 import org.junit.jupiter.api.Assertions;
 import org.junit.jupiter.params.ParameterizedTest;
@@ -36,7 +45,25 @@
 class AccessorFactoryTest {
 
   static AccessorFactory[] factories() {
-    return new AccessorFactory[]{new NativeAccessorFactory(), new MethodHandleAccessorFactory()};
+    return new AccessorFactory[]{
+      new NativeAccessorFactory(), new MethodHandleAccessorFactory(), new BytecodeAccessorFactory()};
+  }
+
+  static AccessorFactory[] allFactories() {
+    List<AccessorFactory> factories = new ArrayList<>(Arrays.asList(
+      new NativeAccessorFactory(), new MethodHandleAccessorFactory(), new BytecodeAccessorFactory(),
+      new BareAccessorFactory()));
+    // the jni factory can only be tested if the native library is available
+    JniAccessorFactory jniFactory = new JniAccessorFactory();
+    if (jniFactory.isAvailable()) {
+      factories.add(jniFactory);
+    }
+    // the unsafe factory requires sun.misc.Unsafe and the trusted lookup
+    UnsafeAccessorFactory unsafeFactory = new UnsafeAccessorFactory();
+    if (unsafeFactory.isAvailable()) {
+      factories.add(unsafeFactory);
+    }
+    return factories.toArray(new AccessorFactory[0]);
   }
 
   @ParameterizedTest
@@ -122,4 +149,179 @@ void testConstructorWrap(AccessorFactory factory) {
     Result<SeedClass> invalidResult = accessor.get().invokeWithArgs("This will", "break :)");
     Assertions.assertTrue(invalidResult.wasExceptional());
   }
+
+  @ParameterizedTest
+  @MethodSource("allFactories")
+  void testPrimitiveFieldAccess(AccessorFactory factory) {
+    SeedSuperClass seed = new SeedSuperClass();
+    Reflexion reflexion = Reflexion.on(SeedSuperClass.class, null, factory);
+
+    FieldAccessor intAccessor = reflexion.findField("c").orElse(null);
+    Assertions.assertNotNull(intAccessor);
+
+    intAccessor.setInt(seed, 42);
+    Assertions.assertEquals(42, seed.getC());
+    Assertions.assertEquals(42, intAccessor.getInt(seed));
+    Assertions.assertEquals(42L, intAccessor.getLong(seed));
+    Assertions.assertEquals(42D, intAccessor.getDouble(seed));
+    Assertions.assertThrows(RuntimeException.class, () -> intAccessor.getBoolean(seed));
+    Assertions.assertThrows(RuntimeException.class, () -> intAccessor.setLong(seed, 1L));
+
+    FieldAccessor doubleAccessor = reflexion.findField("e").orElse(null);
+    Assertions.assertNotNull(doubleAccessor);
+
+    doubleAccessor.setDouble(seed, 1.5D);
+    Assertions.assertEquals(1.5D, doubleAccessor.getDouble(seed));
+    doubleAccessor.setInt(seed, 3);
+    Assertions.assertEquals(3D, doubleAccessor.getDouble(seed));
+
+    FieldAccessor staticAccessor = Reflexion.on(SeedClass.class, null, factory).findField("LONG").orElse(null);
+    Assertions.assertNotNull(staticAccessor);
+    Assertions.assertEquals(123456789L, staticAccessor.getLong());
+  }
+
+  @ParameterizedTest
+  @MethodSource("allFactories")
+  void testDirectAccess(AccessorFactory factory) {
+    SeedSuperClass seed = new SeedSuperClass();
+    Reflexion reflexion = Reflexion.on(SeedSuperClass.class, null, factory);
+
+    FieldAccessor fieldAccessor = reflexion.findField("a").orElse(null);
+    Assertions.assertNotNull(fieldAccessor);
+
+    fieldAccessor.setValueDirect(seed, "Hello");
+    Assertions.assertEquals("Hello", fieldAccessor.getValueDirect(seed));
+    Assertions.assertThrows(RuntimeException.class, () -> fieldAccessor.getValueDirect("Not a seed"));
+
+    MethodAccessor<Method> methodAccessor = reflexion.findMethod("getA").orElse(null);
+    Assertions.assertNotNull(methodAccessor);
+    Assertions.assertEquals("Hello", methodAccessor.invokeDirect(seed));
+
+    // the exception thrown by the method must be rethrown as-is
+    MethodAccessor<Method> parseInt = Reflexion.on(Integer.class, null, factory)
+      .findMethod("parseInt", String.class)
+      .orElse(null);
+    Assertions.assertNotNull(parseInt);
+    Integer result = parseInt.invokeWithArgsDirect("123");
+    Assertions.assertEquals(123, result.intValue());
+    Assertions.assertThrows(NumberFormatException.class, () -> parseInt.invokeWithArgsDirect("abc"));
+  }
+
+  @ParameterizedTest
+  @MethodSource("allFactories")
+  void testFixedArityInvoke(AccessorFactory factory) {
+    SeedClass seedClass = new SeedClass(1, 2, true, "WORLD :)");
+    Reflexion reflexion = Reflexion.on(SeedClass.class, null, factory);
+
+    MethodAccessor<Method> getter = reflexion.findMethod("getStr").orElse(null);
+    Assertions.assertNotNull(getter);
+    Assertions.assertEquals("WORLD :)", getter.invoke0(seedClass));
+
+    MethodAccessor<Method> append = reflexion.findMethod("appendToStr", String.class).orElse(null);
+    Assertions.assertNotNull(append);
+    Assertions.assertEquals("WORLD :) HELLO", append.invoke1(seedClass, "HELLO"));
+    Assertions.assertThrows(RuntimeException.class, () -> append.invoke2(seedClass, "HELLO", "WORLD"));
+
+    MethodAccessor<Method> staticMethod = reflexion.findMethod("abc", String.class, SeedClass.class).orElse(null);
+    Assertions.assertNotNull(staticMethod);
+    Assertions.assertEquals("HELLO // WORLD :)", staticMethod.invoke2(null, "HELLO", seedClass));
+
+    MethodAccessor<Constructor<?>> ctor = reflexion.findConstructor(double.class, String.class).orElse(null);
+    Assertions.assertNotNull(ctor);
+
+    SeedClass constructed = ctor.invoke2(null, 1234D, "World :))");
+    Assertions.assertEquals(1234D, constructed.getD());
+    Assertions.assertEquals("World :))", constructed.getStr());
+    Assertions.assertThrows(RuntimeException.class, () -> ctor.invoke1(null, 1234D));
+  }
+
+  @ParameterizedTest
+  @MethodSource("allFactories")
+  void testExactMethodHandles(AccessorFactory factory) throws Throwable {
+    SeedSuperClass seed = new SeedSuperClass();
+    FieldAccessor field = Reflexion.on(SeedSuperClass.class, null, factory).findField("c").orElse(null);
+    Assertions.assertNotNull(field);
+
+    MethodHandle getter = field.getterHandle();
+    MethodHandle setter = field.setterHandle();
+    Assertions.assertEquals(MethodType.methodType(int.class, SeedSuperClass.class), getter.type());
+    Assertions.assertEquals(MethodType.methodType(void.class, SeedSuperClass.class, int.class), setter.type());
+
+    setter.invokeExact(seed, 1234);
+    Assertions.assertEquals(1234, (int) getter.invokeExact(seed));
+
+    Reflexion reflexion = Reflexion.on(SeedClass.class, null, factory);
+    MethodAccessor<Method> method = reflexion.findMethod("abc", String.class, SeedClass.class).orElse(null);
+    Assertions.assertNotNull(method);
+
+    SeedClass seedClass = new SeedClass(1, 2, true, "WORLD :)");
+    MethodHandle methodHandle = method.asMethodHandle();
+    Assertions.assertEquals(MethodType.methodType(String.class, String.class, SeedClass.class), methodHandle.type());
+    Assertions.assertEquals("HELLO // WORLD :)", (String) methodHandle.invokeExact("HELLO", seedClass));
+
+    MethodAccessor<Constructor<?>> ctor = reflexion.findConstructor(double.class, String.class).orElse(null);
+    Assertions.assertNotNull(ctor);
+
+    MethodHandle ctorHandle = ctor.asMethodHandle();
+    Assertions.assertEquals(MethodType.methodType(SeedClass.class, double.class, String.class), ctorHandle.type());
+    Assertions.assertEquals("World :))", ((SeedClass) ctorHandle.invokeExact(1234D, "World :))")).getStr());
+  }
+
+  @ParameterizedTest
+  @MethodSource("factories")
+  void testPrimitiveWidening(AccessorFactory factory) {
+    PrimitiveSeedClass seed = new PrimitiveSeedClass(1L, 2D);
+    Reflexion reflexion = Reflexion.on(PrimitiveSeedClass.class, null, factory);
+
+    FieldAccessor longAccessor = reflexion.findField("l").orElse(null);
+    Assertions.assertNotNull(longAccessor);
+    Assertions.assertTrue(longAccessor.setValue(seed, 5).wasSuccessful());
+    Assertions.assertEquals(5L, seed.getL());
+    Assertions.assertTrue(longAccessor.setValue(seed, 1.5D).wasExceptional());
+    Assertions.assertTrue(longAccessor.setValue(seed, null).wasExceptional());
+
+    FieldAccessor doubleAccessor = reflexion.findField("d").orElse(null);
+    Assertions.assertNotNull(doubleAccessor);
+    Assertions.assertTrue(doubleAccessor.setValue(seed, 3).wasSuccessful());
+    Assertions.assertEquals(3D, seed.getD());
+    Assertions.assertTrue(doubleAccessor.setValue(seed, 4L).wasSuccessful());
+    Assertions.assertEquals(4D, seed.getD());
+
+    MethodAccessor<Method> sum = reflexion.findMethod("sum", long.class, double.class).orElse(null);
+    Assertions.assertNotNull(sum);
+    Assertions.assertEquals(7D, sum.invokeWithArgs(3, 4).getOrElse(null));
+    Assertions.assertEquals(7D, sum.invokeWithArgs(3L, 4D).getOrElse(null));
+    Assertions.assertTrue(sum.invokeWithArgs(3D, 4D).wasExceptional());
+
+    MethodAccessor<Constructor<?>> ctor = reflexion.findConstructor(long.class, double.class).orElse(null);
+    Assertions.assertNotNull(ctor);
+
+    Result<PrimitiveSeedClass> constructed = ctor.invokeWithArgs(5, 6);
+    Assertions.assertTrue(constructed.wasSuccessful());
+    Assertions.assertEquals(5L, constructed.get().getL());
+    Assertions.assertEquals(6D, constructed.get().getD());
+  }
+
+  @ParameterizedTest
+  @MethodSource("factories")
+  void testWrongArgumentCount(AccessorFactory factory) {
+    SeedClass seedClass = new SeedClass(1, 2, true, "WORLD :)");
+    Reflexion reflexion = Reflexion.on(SeedClass.class, null, factory);
+
+    MethodAccessor<Method> append = reflexion.findMethod("appendToStr", String.class).orElse(null);
+    Assertions.assertNotNull(append);
+    Assertions.assertTrue(append.invoke(seedClass).wasExceptional());
+    Assertions.assertTrue(append.invoke(seedClass, "HELLO", "WORLD").wasExceptional());
+
+    MethodAccessor<Method> staticMethod = reflexion.findMethod("abc", String.class, SeedClass.class).orElse(null);
+    Assertions.assertNotNull(staticMethod);
+    Assertions.assertTrue(staticMethod.invokeWithArgs("HELLO").wasExceptional());
+    Assertions.assertTrue(staticMethod.invokeWithArgs("HELLO", seedClass, "WORLD").wasExceptional());
+
+    MethodAccessor<Constructor<?>> ctor = reflexion.findConstructor(double.class, String.class).orElse(null);
+    Assertions.assertNotNull(ctor);
+    Assertions.assertTrue(ctor.invokeWithArgs(1234D).wasExceptional());
+    Assertions.assertTrue(ctor.invokeWithArgs(1234D, "World", "Mars").wasExceptional());
+    Assertions.assertThrows(RuntimeException.class, () -> ctor.invokeWithArgsDirect(1234D));
+  }
 }
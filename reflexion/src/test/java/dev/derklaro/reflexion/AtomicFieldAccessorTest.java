@@ -0,0 +1,83 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.condition.EnabledForJreRange;
+import org.junit.jupiter.api.condition.JRE;
+
+@EnabledForJreRange(min = JRE.JAVA_9)
+class AtomicFieldAccessorTest {
+
+  @Test
+  void testPrimitiveFieldAccess() {
+    SeedSuperClass seed = new SeedSuperClass();
+    AtomicFieldAccessor accessor = Reflexion.on(SeedSuperClass.class).findField("c")
+      .map(FieldAccessor::atomic)
+      .orElse(null);
+    Assertions.assertNotNull(accessor);
+
+    accessor.setRelease(seed, 5);
+    Assertions.assertEquals(5, seed.getC());
+    Assertions.assertEquals(5, (int) accessor.getVolatile(seed));
+    Assertions.assertEquals(5, (int) accessor.getAcquire(seed));
+
+    Assertions.assertTrue(accessor.compareAndSet(seed, 5, 6));
+    Assertions.assertFalse(accessor.compareAndSet(seed, 5, 7));
+    Assertions.assertEquals(6, seed.getC());
+
+    Assertions.assertEquals(6, (int) accessor.getAndAdd(seed, 4));
+    Assertions.assertEquals(10, (int) accessor.getAndSet(seed, 1));
+    Assertions.assertEquals(1, seed.getC());
+  }
+
+  @Test
+  void testReferenceFieldAccess() {
+    SeedSuperClass seed = new SeedSuperClass();
+    AtomicFieldAccessor accessor = Reflexion.on(SeedSuperClass.class).bind(seed).findField("b")
+      .map(FieldAccessor::atomic)
+      .orElse(null);
+    Assertions.assertNotNull(accessor);
+
+    // the bound instance is used implicitly
+    Assertions.assertTrue(accessor.compareAndSet(null, "World"));
+    Assertions.assertEquals("World", seed.getB());
+    Assertions.assertEquals("World", accessor.getAndSet("Hello"));
+    Assertions.assertEquals("Hello", accessor.getVolatile());
+
+    // numeric operations are not supported for reference fields
+    Assertions.assertThrows(UnsupportedOperationException.class, () -> accessor.getAndAdd(1));
+  }
+
+  @Test
+  void testStaticFieldAccess() {
+    AtomicFieldAccessor accessor = Reflexion.on(SeedClass.class).findField("LONG")
+      .map(FieldAccessor::atomic)
+      .orElse(null);
+    Assertions.assertNotNull(accessor);
+    Assertions.assertEquals(123456789L, (long) accessor.getVolatile());
+  }
+}
@@ -0,0 +1,155 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.bytecode.BytecodeAccessorFactory;
+import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.NativeAccessorFactory;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.util.Arrays;
+import java.util.List;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+class BytecodeAccessorFactoryTest {
+
+  @Test
+  void testFactoryIsPreferred() {
+    AccessorFactory bytecode = new BytecodeAccessorFactory();
+    Assertions.assertTrue(bytecode.isAvailable());
+
+    List<AccessorFactory> factories = Arrays.asList(
+      new BareAccessorFactory(), new MethodHandleAccessorFactory(), new NativeAccessorFactory(), bytecode);
+    factories.sort(null);
+    Assertions.assertSame(bytecode, factories.get(0));
+  }
+
+  @Test
+  void testServiceFactoryTakesPrecedence() {
+    AccessorFactory bytecode = new BytecodeAccessorFactory();
+    AccessorFactory service = new ServiceAccessorFactory();
+    Assertions.assertEquals(0, bytecode.compareTo(service));
+    Assertions.assertEquals(0, service.compareTo(bytecode));
+
+    // service factories are sorted first, the sort must keep them before the bytecode factory
+    List<AccessorFactory> factories = Arrays.asList(service, new MethodHandleAccessorFactory(), bytecode);
+    factories.sort(null);
+    Assertions.assertSame(service, factories.get(0));
+    Assertions.assertSame(bytecode, factories.get(1));
+  }
+
+  @Test
+  void testPrimitiveAndFinalFieldAccess() {
+    SeedClass seedClass = new SeedClass(1, 2D, true, "World");
+    Reflexion reflexion = Reflexion.on(SeedClass.class, null, new BytecodeAccessorFactory());
+
+    FieldAccessor accessor = reflexion.findField("i").orElse(null);
+    Assertions.assertNotNull(accessor);
+    Assertions.assertEquals(1, accessor.getValue(seedClass).getOrElse(null));
+
+    // final fields are written using the method handle fallback
+    Assertions.assertTrue(accessor.setValue(seedClass, 5).wasSuccessful());
+    Assertions.assertEquals(5, seedClass.getI());
+
+    Assertions.assertTrue(accessor.setValue(seedClass, "Hello").wasExceptional());
+    Assertions.assertTrue(accessor.getValue("Not a seed class").wasExceptional());
+  }
+
+  @Test
+  void testNoArgsAccess() {
+    Reflexion reflexion = Reflexion.on(SeedClass.class, null, new BytecodeAccessorFactory());
+
+    MethodAccessor<?> accessor = reflexion.findMethod("abc").orElse(null);
+    Assertions.assertNotNull(accessor);
+    Assertions.assertEquals("World", accessor.invoke().getOrElse(null));
+
+    MethodAccessor<?> ctor = reflexion.findConstructor().orElse(null);
+    Assertions.assertNotNull(ctor);
+    Assertions.assertInstanceOf(SeedClass.class, ctor.invoke().getOrElse(null));
+  }
+
+  @Test
+  void testNonAsciiMemberNames() {
+    long fallbacks = Reflexion.stats().getGenerationFallbacks();
+    NonAsciiMembers members = new NonAsciiMembers();
+    Reflexion reflexion = Reflexion.on(NonAsciiMembers.class, null, new BytecodeAccessorFactory());
+
+    FieldAccessor field = reflexion.findField("größe").orElse(null);
+    Assertions.assertNotNull(field);
+    Assertions.assertTrue(field.setValue(members, "łączny").wasSuccessful());
+    Assertions.assertEquals("łączny", field.getValue(members).getOrElse(null));
+
+    MethodAccessor<?> method = reflexion.findMethod("zählen", String.class).orElse(null);
+    Assertions.assertNotNull(method);
+    Assertions.assertEquals("łączny 日本", method.invoke(members, "日本").getOrElse(null));
+
+    // the member names must be encoded correctly, otherwise the jvm rejects the generated classes
+    Assertions.assertEquals(fallbacks, Reflexion.stats().getGenerationFallbacks());
+  }
+
+  static final class ServiceAccessorFactory implements AccessorFactory {
+
+    private final AccessorFactory delegate = new MethodHandleAccessorFactory();
+
+    @Override
+    public boolean isAvailable() {
+      return true;
+    }
+
+    @Override
+    public FieldAccessor wrapField(Reflexion reflexion, Field field) {
+      return this.delegate.wrapField(reflexion, field);
+    }
+
+    @Override
+    public MethodAccessor<Method> wrapMethod(Reflexion reflexion, Method method) {
+      return this.delegate.wrapMethod(reflexion, method);
+    }
+
+    @Override
+    public MethodAccessor<Constructor<?>> wrapConstructor(Reflexion rfx, Constructor<?> ct) {
+      return this.delegate.wrapConstructor(rfx, ct);
+    }
+
+    @Override
+    public int compareTo(AccessorFactory o) {
+      return 0;
+    }
+  }
+
+  // CHECKSTYLE.OFF: MemberName|MethodName
+  static final class NonAsciiMembers {
+
+    private String größe;
+
+    private String zählen(String suffix) {
+      return this.größe + " " + suffix;
+    }
+  }
+  // CHECKSTYLE.ON
+}
@@ -26,6 +26,7 @@
 
 import static dev.derklaro.reflexion.matcher.ConstructorMatcher.newMatcher;
 
+import dev.derklaro.reflexion.matcher.FieldMatcher;
 import java.lang.reflect.Constructor;
 import java.lang.reflect.Modifier;
 import java.util.Optional;
@@ -83,4 +84,22 @@ void testArgsConstructorLookup() {
     Assertions.assertEquals(1234D, seed.getD());
     Assertions.assertEquals(":))", seed.getStr());
   }
+
+  @Test
+  void testAllocateInstance() {
+    SeedClass allocated = Reflexion.on(SeedClass.class).allocateInstance();
+    Assertions.assertNotNull(allocated);
+    // no constructor ran, all fields hold their default value
+    Assertions.assertEquals(0, allocated.getI());
+    Assertions.assertNull(allocated.getStr());
+    Assertions.assertFalse(allocated.isB());
+
+    ObjectShape shape = Reflexion.on(SeedSuperClass.class).shape(FieldMatcher.newMatcher());
+    SeedSuperClass populated = shape.allocate(new Object[]{"a", "b", 3, 4D});
+    Assertions.assertEquals("a", populated.getA());
+    Assertions.assertEquals("b", populated.getB());
+    Assertions.assertEquals(3, populated.getC());
+
+    Assertions.assertThrows(IllegalArgumentException.class, () -> Reflexion.on(Runnable.class).allocateInstance());
+  }
 }
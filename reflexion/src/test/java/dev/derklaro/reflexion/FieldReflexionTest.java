@@ -28,6 +28,11 @@
 
 import java.lang.reflect.Field;
 import java.lang.reflect.Modifier;
+import java.util.Arrays;
+import java.util.function.BiConsumer;
+import java.util.function.ObjIntConsumer;
+import java.util.function.Supplier;
+import java.util.function.ToIntFunction;
 import java.util.stream.Stream;
 import org.junit.jupiter.api.Assertions;
 import org.junit.jupiter.api.Test;
@@ -147,4 +152,85 @@ void testStaticFieldNameSetAccessInstance(Class<?> clazz, String name, Object in
     // reset the field
     accessor.setValue(initial);
   }
+
+  @Test
+  void testReadAll() {
+    Reflexion reflexion = Reflexion.on(SeedClass.class);
+    Object[] instances = {new SeedClass(1, 1, true, "a"), "not a seed", new SeedClass(3, 1, true, "c")};
+
+    FieldAccessor str = reflexion.findField("str").orElseThrow(IllegalStateException::new);
+    Object[] values = new Object[instances.length];
+    BatchResult result = str.readAll(instances, values);
+    Assertions.assertFalse(result.wasSuccessful());
+    Assertions.assertEquals(1, result.getFailures().size());
+    Assertions.assertEquals(1, result.getFailures().get(0).getIndex());
+    Assertions.assertArrayEquals(new Object[]{"a", null, "c"}, values);
+
+    FieldAccessor i = reflexion.findField("i").orElseThrow(IllegalStateException::new);
+    int[] ints = new int[instances.length];
+    Assertions.assertEquals(1, i.readAllInt(instances, ints).getFailures().size());
+    Assertions.assertArrayEquals(new int[]{1, 0, 3}, ints);
+
+    // static fields are read once, the instances are ignored
+    FieldAccessor lng = reflexion.findField("LONG").orElseThrow(IllegalStateException::new);
+    long[] longs = new long[instances.length];
+    Assertions.assertTrue(lng.readAllLong(instances, longs).wasSuccessful());
+    Assertions.assertArrayEquals(new long[]{123456789L, 123456789L, 123456789L}, longs);
+
+    Assertions.assertThrows(IllegalArgumentException.class, () -> str.readAll(instances, new Object[1]));
+  }
+
+  @Test
+  void testShape() {
+    ObjectShape shape = Reflexion.on(SeedClass.class).shape(newMatcher().denyModifier(Modifier.STATIC));
+    Assertions.assertEquals(8, shape.getFieldCount());
+    Assertions.assertEquals(Arrays.asList("a", "b", "c", "e", "b", "d", "i", "str"), shape.getFieldNames());
+    // the field of the subclass hides the field of the super class
+    Assertions.assertEquals(4, shape.slotOf("b"));
+    Assertions.assertEquals(-1, shape.slotOf("WORLD"));
+
+    Object[] slots = shape.newSlots();
+    shape.readInto(new SeedClass(5, 6D, true, "Hello"), slots);
+    Assertions.assertEquals(true, slots[shape.slotOf("b")]);
+    Assertions.assertEquals(5, slots[shape.slotOf("i")]);
+    Assertions.assertEquals("Hello", slots[shape.slotOf("str")]);
+    Assertions.assertNull(slots[shape.slotOf("a")]);
+
+    ObjectShape superShape = Reflexion.on(SeedSuperClass.class).shape(newMatcher());
+    SeedSuperClass target = new SeedSuperClass();
+    superShape.writeFrom(new Object[]{"first", "second", 3, 4D}, target);
+    Assertions.assertEquals("first", target.getA());
+    Assertions.assertEquals("second", target.getB());
+    Assertions.assertEquals(3, target.getC());
+
+    Assertions.assertThrows(IllegalArgumentException.class, () -> shape.readInto(null, new Object[1]));
+  }
+
+  @Test
+  @SuppressWarnings("unchecked")
+  void testFieldAsInterface() {
+    SeedClass seed = new SeedClass(7, 2D, true, "seed");
+    FieldAccessor i = Reflexion.on(SeedClass.class).findField("i").orElseThrow(IllegalStateException::new);
+    ToIntFunction<SeedClass> intGetter = i.getterAsInterface(ToIntFunction.class);
+    Assertions.assertEquals(7, intGetter.applyAsInt(seed));
+
+    FieldAccessor world = Reflexion.on(SeedClass.class).findField("WORLD").orElseThrow(IllegalStateException::new);
+    Supplier<String> worldGetter = world.getterAsInterface(Supplier.class);
+    Assertions.assertEquals("World", worldGetter.get());
+
+    SeedSuperClass target = new SeedSuperClass();
+    Reflexion superReflexion = Reflexion.on(SeedSuperClass.class);
+    FieldAccessor a = superReflexion.findField("a").orElseThrow(IllegalStateException::new);
+    BiConsumer<SeedSuperClass, String> aSetter = a.setterAsInterface(BiConsumer.class);
+    aSetter.accept(target, "written");
+    Assertions.assertEquals("written", target.getA());
+
+    FieldAccessor c = superReflexion.findField("c").orElseThrow(IllegalStateException::new);
+    ObjIntConsumer<SeedSuperClass> cSetter = c.setterAsInterface(ObjIntConsumer.class);
+    cSetter.accept(target, 42);
+    Assertions.assertEquals(42, target.getC());
+
+    Assertions.assertThrows(IllegalArgumentException.class, () -> a.getterAsInterface(Runnable.class));
+    Assertions.assertThrows(IllegalArgumentException.class, () -> a.setterAsInterface(Supplier.class));
+  }
 }
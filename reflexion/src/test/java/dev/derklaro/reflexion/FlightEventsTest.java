@@ -0,0 +1,79 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.matcher.FieldMatcher;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.Set;
+import java.util.stream.Collectors;
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.condition.EnabledForJreRange;
+import org.junit.jupiter.api.condition.JRE;
+
+@EnabledForJreRange(min = JRE.JAVA_11)
+class FlightEventsTest {
+
+  @Test
+  void testEventsAreRecorded() throws Exception {
+    Path file = Files.createTempFile("reflexion", ".jfr");
+    try (Recording recording = new Recording()) {
+      recording.enable("dev.derklaro.reflexion.ClassResolution");
+      recording.enable("dev.derklaro.reflexion.HierarchyPopulation");
+      recording.enable("dev.derklaro.reflexion.MemberWrap");
+      recording.start();
+
+      ReflexionRegistry.invalidate(SeedClass.class);
+      Reflexion reflexion = Reflexion.find(SeedClass.class.getName()).orElseThrow(IllegalStateException::new);
+      reflexion.findFields(FieldMatcher.newMatcher().hasName("str"));
+
+      recording.stop();
+      recording.dump(file);
+    }
+
+    try {
+      List<RecordedEvent> events = RecordingFile.readAllEvents(file);
+      Set<String> types = events.stream().map(event -> event.getEventType().getName()).collect(Collectors.toSet());
+      Assertions.assertTrue(types.contains("dev.derklaro.reflexion.ClassResolution"));
+      Assertions.assertTrue(types.contains("dev.derklaro.reflexion.HierarchyPopulation"));
+      Assertions.assertTrue(types.contains("dev.derklaro.reflexion.MemberWrap"));
+
+      RecordedEvent wrap = events.stream()
+        .filter(event -> event.getEventType().getName().equals("dev.derklaro.reflexion.MemberWrap"))
+        .findFirst()
+        .orElseThrow(IllegalStateException::new);
+      Assertions.assertEquals("str", wrap.getString("memberName"));
+      Assertions.assertEquals(Reflexion.getFactorySelection().getSelectedFactory().getClass().getName(),
+        wrap.getString("factory"));
+    } finally {
+      Files.deleteIfExists(file);
+    }
+  }
+}
@@ -122,4 +122,85 @@ void testClassGetAnyClassLoader() {
     Assertions.assertEquals(SeedClass.class, reflexion.getWrappedClass());
     Assertions.assertThrows(ReflexionException.class, () -> Reflexion.getAny(loader, "a", "b", "c"));
   }
+
+  @Test
+  void testClassLookupIsCached() {
+    CountingClassLoader loader = new CountingClassLoader();
+    Assertions.assertFalse(Reflexion.find("dev.derklaro.reflexion.Gone", loader).isPresent());
+    Assertions.assertFalse(Reflexion.find("dev.derklaro.reflexion.Gone", loader).isPresent());
+    Assertions.assertEquals(1, loader.lookups);
+
+    Reflexion.invalidateClassResolution(loader);
+    Assertions.assertFalse(Reflexion.find("dev.derklaro.reflexion.Gone", loader).isPresent());
+    Assertions.assertEquals(2, loader.lookups);
+
+    Optional<Reflexion> reflexion = Reflexion.find("dev.derklaro.reflexion.SeedClass", loader);
+    Assertions.assertTrue(reflexion.isPresent());
+    Assertions.assertEquals(SeedClass.class, reflexion.get().getWrappedClass());
+  }
+
+  @Test
+  void testClassLookupMissesAreEvicted() {
+    CountingClassLoader loader = new CountingClassLoader();
+    for (int i = 0; i <= 1024; i++) {
+      Assertions.assertFalse(Reflexion.find("dev.derklaro.reflexion.Gone" + i, loader).isPresent());
+    }
+    Assertions.assertEquals(1025, loader.lookups);
+
+    // the latest miss is still cached, the eldest miss was evicted to stay within the limit
+    Assertions.assertFalse(Reflexion.find("dev.derklaro.reflexion.Gone1024", loader).isPresent());
+    Assertions.assertEquals(1025, loader.lookups);
+    Assertions.assertFalse(Reflexion.find("dev.derklaro.reflexion.Gone0", loader).isPresent());
+    Assertions.assertEquals(1026, loader.lookups);
+  }
+
+  @Test
+  void testClassCandidates() {
+    ClassLoader loader = ClassLoader.getSystemClassLoader();
+    ClassCandidates candidates = ClassCandidates.of("gone", "dev.derklaro.reflexion.SeedClass", "gone2");
+
+    for (int i = 0; i < 2; i++) {
+      Optional<Reflexion> reflexion = candidates.find(loader);
+      Assertions.assertTrue(reflexion.isPresent());
+      Assertions.assertEquals(SeedClass.class, reflexion.get().getWrappedClass());
+    }
+
+    Assertions.assertFalse(ClassCandidates.of("gone", "gone2").find(loader).isPresent());
+    Assertions.assertFalse(ClassCandidates.of().find(loader).isPresent());
+    Assertions.assertEquals(3, candidates.getNames().size());
+  }
+
+  @Test
+  void testEmptySuccessIsShared() {
+    Assertions.assertSame(Result.success(null), Result.success(null));
+    Assertions.assertTrue(Result.success(null).wasSuccessful());
+    Assertions.assertNull(Result.success(null).getOrElse("fallback"));
+    Assertions.assertEquals("value", Result.success("value").get());
+  }
+
+  @Test
+  void testExceptionStackTrace() {
+    ReflexionException exception = new ReflexionException("test");
+    Assertions.assertEquals(ReflexionException.isStackless(), exception.getStackTrace().length == 0);
+
+    IllegalStateException cause = new IllegalStateException("cause");
+    ReflexionException wrapping = new ReflexionException(cause);
+    Assertions.assertSame(cause, wrapping.getCause());
+    Assertions.assertEquals(cause.toString(), wrapping.getMessage());
+  }
+
+  private static final class CountingClassLoader extends ClassLoader {
+
+    private int lookups;
+
+    CountingClassLoader() {
+      super(GeneralReflexionTest.class.getClassLoader());
+    }
+
+    @Override
+    protected Class<?> findClass(String name) throws ClassNotFoundException {
+      this.lookups++;
+      throw new ClassNotFoundException(name);
+    }
+  }
 }
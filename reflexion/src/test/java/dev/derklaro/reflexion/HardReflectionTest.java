@@ -24,6 +24,7 @@
 
 package dev.derklaro.reflexion;
 
+import dev.derklaro.reflexion.internal.bytecode.BytecodeAccessorFactory;
 import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
 import dev.derklaro.reflexion.internal.natives.NativeAccessorFactory;
 import java.lang.invoke.MethodHandles.Lookup;
@@ -40,7 +41,8 @@
 class HardReflectionTest {
 
   static AccessorFactory[] factories() {
-    return new AccessorFactory[]{new NativeAccessorFactory(), new MethodHandleAccessorFactory()};
+    return new AccessorFactory[]{
+      new NativeAccessorFactory(), new MethodHandleAccessorFactory(), new BytecodeAccessorFactory()};
   }
 
   @ParameterizedTest
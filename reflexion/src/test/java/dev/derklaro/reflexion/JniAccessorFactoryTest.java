@@ -0,0 +1,117 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.JniAccessorFactory;
+import dev.derklaro.reflexion.internal.natives.NativeFieldBatch;
+import java.util.AbstractList;
+import java.util.Arrays;
+import java.util.List;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Assumptions;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+class JniAccessorFactoryTest {
+
+  private JniAccessorFactory factory;
+
+  @BeforeEach
+  void setUp() {
+    this.factory = new JniAccessorFactory();
+    if (Boolean.getBoolean("dev.derklaro.reflexion.test.requireNatives")) {
+      Assertions.assertTrue(this.factory.isAvailable(), "native library is bundled but cannot be loaded");
+    } else {
+      Assumptions.assumeTrue(this.factory.isAvailable(), "native library is not available");
+    }
+  }
+
+  @Test
+  void testFactoryIsPreferredOverBare() {
+    List<AccessorFactory> factories = Arrays.asList(new BareAccessorFactory(), this.factory);
+    factories.sort(null);
+    Assertions.assertSame(this.factory, factories.get(0));
+  }
+
+  @Test
+  void testArgumentsAreValidated() {
+    SeedClass seedClass = new SeedClass(1, 2D, true, "World");
+    Reflexion reflexion = Reflexion.on(SeedClass.class, null, this.factory);
+
+    FieldAccessor accessor = reflexion.findField("str").orElse(null);
+    Assertions.assertNotNull(accessor);
+    Assertions.assertTrue(accessor.setValue(seedClass, 5).wasExceptional());
+    Assertions.assertTrue(accessor.getValue("Not a seed class").wasExceptional());
+    Assertions.assertTrue(accessor.getValue(null).wasExceptional());
+
+    // final fields can be written through jni
+    FieldAccessor intAccessor = reflexion.findField("i").orElse(null);
+    Assertions.assertNotNull(intAccessor);
+    Assertions.assertTrue(intAccessor.setValue(seedClass, (short) 5).wasSuccessful());
+    Assertions.assertEquals(5, seedClass.getI());
+    Assertions.assertTrue(intAccessor.setValue(seedClass, 5L).wasExceptional());
+
+    MethodAccessor<?> method = reflexion.findMethod("appendToStr", String.class).orElse(null);
+    Assertions.assertNotNull(method);
+    Assertions.assertTrue(method.invoke(seedClass, 5).wasExceptional());
+    Assertions.assertTrue(method.invoke("Not a seed class", "Hello").wasExceptional());
+  }
+
+  @Test
+  void testAbstractClassesAreNotInstantiated() {
+    MethodAccessor<?> constructor = Reflexion.on(AbstractList.class, null, this.factory).findConstructor().orElse(null);
+    Assertions.assertNotNull(constructor);
+
+    Result<?> result = constructor.invoke();
+    Assertions.assertTrue(result.wasExceptional());
+    Assertions.assertInstanceOf(InstantiationException.class, result.getException());
+  }
+
+  @Test
+  void testBatchRead() throws Exception {
+    SeedSuperClass seed = new SeedSuperClass();
+    Reflexion reflexion = Reflexion.on(SeedSuperClass.class);
+    reflexion.findField("c").orElseThrow(IllegalStateException::new).setInt(seed, 42);
+    reflexion.findField("e").orElseThrow(IllegalStateException::new).setDouble(seed, 1.5D);
+
+    NativeFieldBatch batch = this.factory.compileBatch(
+      SeedSuperClass.class,
+      SeedSuperClass.class.getDeclaredField("c"),
+      SeedSuperClass.class.getDeclaredField("e"));
+    Assertions.assertEquals(2, batch.getFieldCount());
+
+    long[] values = new long[2];
+    batch.readRaw(seed, values);
+    Assertions.assertEquals(42L, values[0]);
+    Assertions.assertEquals(1.5D, Double.longBitsToDouble(values[1]));
+
+    Assertions.assertThrows(IllegalArgumentException.class, () -> batch.readRaw("Not a seed", values));
+    Assertions.assertThrows(IllegalArgumentException.class, () -> batch.readRaw(seed, new long[1]));
+    Assertions.assertThrows(
+      IllegalArgumentException.class,
+      () -> this.factory.compileBatch(SeedSuperClass.class, SeedSuperClass.class.getDeclaredField("a")));
+  }
+}
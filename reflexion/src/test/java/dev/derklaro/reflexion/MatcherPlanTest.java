@@ -0,0 +1,186 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.matcher.BaseMatcher;
+import dev.derklaro.reflexion.matcher.ConstructorMatcher;
+import dev.derklaro.reflexion.matcher.FieldMatcher;
+import dev.derklaro.reflexion.matcher.MatcherPlan;
+import dev.derklaro.reflexion.matcher.MethodMatcher;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+class MatcherPlanTest {
+
+  @Test
+  void testStructurallyEqualPlans() {
+    MatcherPlan<Method> first = MethodMatcher.newMatcher().hasName("abc").hasModifier(Modifier.STATIC).compile();
+    MatcherPlan<Method> second = MethodMatcher.newMatcher().hasName("abc").hasModifier(Modifier.STATIC).compile();
+
+    Assertions.assertEquals(first, second);
+    Assertions.assertEquals(first.hashCode(), second.hashCode());
+    Assertions.assertNotEquals(first, MethodMatcher.newMatcher().hasName("abcd").compile());
+    Assertions.assertNotEquals(first, MethodMatcher.newMatcher().hasName("abc").compile());
+
+    // the type of matcher is part of the plan
+    Assertions.assertNotEquals(
+      FieldMatcher.newMatcher().hasName("abc").compile(),
+      MethodMatcher.newMatcher().hasName("abc").compile());
+  }
+
+  @Test
+  void testRequiredName() {
+    MatcherPlan<Method> plan = MethodMatcher.newMatcher().hasModifier(Modifier.STATIC).hasName("abc").compile();
+    Assertions.assertEquals("abc", plan.getRequiredName());
+    Assertions.assertTrue(plan.isCacheable());
+
+    MatcherPlan<Method> alternative = MethodMatcher.newMatcher().hasName("abc").or(m -> true).compile();
+    Assertions.assertNull(alternative.getRequiredName());
+    Assertions.assertFalse(alternative.isCacheable());
+
+    // type readers are user provided functions as well
+    MatcherPlan<Field> typed = FieldMatcher.newMatcher()
+      .hasName("str")
+      .exactType(Field::getType, String.class)
+      .compile();
+    Assertions.assertFalse(typed.isCacheable());
+  }
+
+  @Test
+  void testBuiltInTypeConstraintsAreCacheable() throws Exception {
+    MatcherPlan<Field> typed = FieldMatcher.newMatcher().hasName("str").exactType(String.class).compile();
+    Assertions.assertTrue(typed.isCacheable());
+    Assertions.assertEquals(typed, FieldMatcher.newMatcher().hasName("str").exactType(String.class).compile());
+    Assertions.assertNotEquals(typed, FieldMatcher.newMatcher().hasName("str").exactType(Object.class).compile());
+    Assertions.assertTrue(typed.test(SeedClass.class.getDeclaredField("str")));
+    Assertions.assertTrue(FieldMatcher.newMatcher().derivedType(CharSequence.class).compile().isCacheable());
+
+    MatcherPlan<Method> method = MethodMatcher.newMatcher()
+      .exactReturnType(String.class)
+      .exactParameterTypes(String.class)
+      .compile();
+    Assertions.assertTrue(method.isCacheable());
+    Assertions.assertTrue(method.test(SeedClass.class.getDeclaredMethod("appendToStr", String.class)));
+    Assertions.assertFalse(method.test(SeedClass.class.getDeclaredMethod("getStr")));
+
+    MatcherPlan<Constructor<?>> ctor = ConstructorMatcher.newMatcher()
+      .derivedParameterTypes(double.class, CharSequence.class)
+      .compile();
+    Assertions.assertTrue(ctor.isCacheable());
+    Assertions.assertTrue(ctor.test(SeedClass.class.getDeclaredConstructor(double.class, String.class)));
+    Assertions.assertFalse(ctor.test(SeedClass.class.getDeclaredConstructor()));
+  }
+
+  @Test
+  void testLegacyMatcherFieldIsFolded() throws Exception {
+    LegacyMethodMatcher matcher = new LegacyMethodMatcher().hasModifier(Modifier.PUBLIC);
+    MatcherPlan<Method> plan = matcher.compile();
+    Assertions.assertTrue(plan.isCacheable());
+
+    matcher.requireName("abc");
+    Assertions.assertNotEquals(plan, matcher.compile());
+    Assertions.assertFalse(matcher.compile().isCacheable());
+
+    Assertions.assertTrue(matcher.test(SeedClass.class.getDeclaredMethod("abc")));
+    Assertions.assertFalse(matcher.test(SeedClass.class.getDeclaredMethod("abc", String.class, SeedClass.class)));
+    Assertions.assertFalse(matcher.test(SeedClass.class.getDeclaredMethod("getI")));
+  }
+
+  @Test
+  void testCustomPredicatesAreEvaluatedLast() throws Exception {
+    AtomicInteger calls = new AtomicInteger();
+    MethodMatcher matcher = MethodMatcher.newMatcher()
+      .and(method -> calls.incrementAndGet() > 0)
+      .hasModifier(Modifier.STATIC);
+
+    Assertions.assertFalse(matcher.test(SeedClass.class.getDeclaredMethod("getI")));
+    Assertions.assertEquals(0, calls.get());
+
+    Assertions.assertTrue(matcher.test(SeedClass.class.getDeclaredMethod("abc")));
+    Assertions.assertEquals(1, calls.get());
+  }
+
+  @Test
+  void testPlanIsNotAffectedByLaterChanges() throws Exception {
+    FieldMatcher matcher = FieldMatcher.newMatcher().hasName("str");
+    MatcherPlan<Field> plan = matcher.compile();
+    Assertions.assertSame(plan, matcher.compile());
+
+    matcher.hasModifier(Modifier.STATIC);
+    Assertions.assertNotEquals(plan, matcher.compile());
+    Assertions.assertTrue(plan.test(SeedClass.class.getDeclaredField("str")));
+    Assertions.assertFalse(matcher.test(SeedClass.class.getDeclaredField("str")));
+  }
+
+  @Test
+  void testMatchesAreMemoized() {
+    ReflexionRegistry.ClassMembers members = ReflexionRegistry.lookup(SeedClass.class);
+
+    MatcherPlan<Method> plan = MethodMatcher.newMatcher().hasName("abc").compile();
+    List<Method> matched = members.findMatching(plan, members.getMethods(), members.getMethodIndex());
+    Assertions.assertEquals(2, matched.size());
+
+    MatcherPlan<Method> equalPlan = MethodMatcher.newMatcher().hasName("abc").compile();
+    Assertions.assertSame(matched, members.findMatching(equalPlan, members.getMethods(), members.getMethodIndex()));
+    Assertions.assertSame(
+      matched.get(0),
+      members.findFirstMatching(equalPlan, members.getMethods(), members.getMethodIndex()));
+  }
+
+  @Test
+  void testMemoizedMatchesAreEvicted() {
+    ReflexionRegistry.ClassMembers members = ReflexionRegistry.lookup(SeedClass.class);
+
+    MatcherPlan<Method> plan = MethodMatcher.newMatcher().hasName("abc").denyModifier(Modifier.NATIVE).compile();
+    List<Method> matched = members.findMatching(plan, members.getMethods(), members.getMethodIndex());
+    Assertions.assertFalse(matched.isEmpty());
+    Assertions.assertSame(matched, members.findMatching(plan, members.getMethods(), members.getMethodIndex()));
+
+    // memoize enough other plans to exceed the cache limit, the eldest result should be evicted
+    for (int i = 0; i < 256; i++) {
+      MatcherPlan<Method> other = MethodMatcher.newMatcher().hasName("abc" + i).compile();
+      members.findMatching(other, members.getMethods(), members.getMethodIndex());
+    }
+
+    List<Method> rematched = members.findMatching(plan, members.getMethods(), members.getMethodIndex());
+    Assertions.assertNotSame(matched, rematched);
+    Assertions.assertEquals(matched, rematched);
+  }
+
+  static final class LegacyMethodMatcher extends BaseMatcher<Method, LegacyMethodMatcher> {
+
+    @SuppressWarnings("deprecation")
+    void requireName(String name) {
+      // the way subclasses added constraints before 1.4
+      this.currentMatcher = this.currentMatcher.and(method -> method.getName().equals(name));
+    }
+  }
+}
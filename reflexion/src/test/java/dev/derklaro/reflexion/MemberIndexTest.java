@@ -0,0 +1,74 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+class MemberIndexTest {
+
+  @Test
+  void testFieldIndex() throws Exception {
+    MemberIndex<Field> index = ReflexionRegistry.lookup(SeedClass.class).getFieldIndex();
+
+    Assertions.assertEquals(SeedClass.class.getDeclaredField("str"), index.firstByName("str"));
+    Assertions.assertEquals(SeedSuperClass.class.getDeclaredField("a"), index.firstByName("a"));
+    Assertions.assertEquals(1, index.byName("WORLD").size());
+
+    Assertions.assertNull(index.firstByName("gone"));
+    Assertions.assertTrue(index.byName("gone").isEmpty());
+  }
+
+  @Test
+  void testMethodIndex() throws Exception {
+    MemberIndex<Method> index = ReflexionRegistry.lookup(SeedClass.class).getMethodIndex();
+
+    Assertions.assertEquals(2, index.byName("abc").size());
+    Assertions.assertEquals(SeedClass.class.getDeclaredMethod("abc"), index.bySignature("abc", new Class<?>[0]));
+    Assertions.assertEquals(
+      SeedClass.class.getDeclaredMethod("abc", String.class, SeedClass.class),
+      index.bySignature("abc", new Class<?>[]{String.class, SeedClass.class}));
+    Assertions.assertEquals(
+      SeedSuperClass.class.getDeclaredMethod("setA", String.class),
+      index.bySignature("setA", new Class<?>[]{String.class}));
+
+    Assertions.assertNull(index.bySignature("abc", new Class<?>[]{String.class}));
+    Assertions.assertNull(index.bySignature(null, new Class<?>[0]));
+  }
+
+  @Test
+  void testConstructorIndexPrefersClosestClass() throws Exception {
+    MemberIndex<Constructor<?>> index = ReflexionRegistry.lookup(SeedClass.class).getConstructorIndex();
+
+    // SeedSuperClass and Object both declare a no-args constructor as well
+    Assertions.assertEquals(SeedClass.class.getDeclaredConstructor(), index.bySignature(null, new Class<?>[0]));
+    Assertions.assertEquals(
+      SeedClass.class.getDeclaredConstructor(double.class, String.class),
+      index.bySignature(null, new Class<?>[]{double.class, String.class}));
+  }
+}
@@ -26,9 +26,14 @@
 
 import static dev.derklaro.reflexion.matcher.MethodMatcher.newMatcher;
 
+import java.lang.reflect.Constructor;
 import java.lang.reflect.Method;
 import java.lang.reflect.Modifier;
 import java.util.Optional;
+import java.util.function.BiFunction;
+import java.util.function.Function;
+import java.util.function.Supplier;
+import java.util.function.UnaryOperator;
 import org.junit.jupiter.api.Assertions;
 import org.junit.jupiter.api.Test;
 import org.junit.jupiter.api.condition.EnabledForJreRange;
@@ -106,4 +111,65 @@ void testFindArgsMethod() {
     Assertions.assertNotNull(result);
     Assertions.assertEquals("test passed!", result);
   }
+
+  @Test
+  void testInvokeAll() {
+    MethodAccessor<Method> append = Reflexion.on(SeedClass.class)
+      .findMethod("appendToStr", String.class)
+      .orElseThrow(IllegalStateException::new);
+
+    Object[] instances = {new SeedClass(1, 1, true, "a"), new SeedClass(1, 1, true, "b")};
+    Object[][] args = {{"1"}, {2}};
+    Object[] results = new Object[instances.length];
+
+    BatchResult result = append.invokeAll(instances, args, results);
+    Assertions.assertEquals(1, result.getFailures().size());
+    Assertions.assertEquals(1, result.getFailures().get(0).getIndex());
+    Assertions.assertEquals("a 1", results[0]);
+    Assertions.assertNull(results[1]);
+    Assertions.assertThrows(ReflexionException.class, result::rethrowFirst);
+
+    MethodAccessor<Method> abc = Reflexion.on(SeedClass.class)
+      .findMethod("abc")
+      .orElseThrow(IllegalStateException::new);
+    Object[] staticResults = new Object[2];
+    Assertions.assertTrue(abc.invokeAll(new Object[2], null, staticResults).wasSuccessful());
+    Assertions.assertEquals(SeedClass.abc(), staticResults[0]);
+    Assertions.assertEquals(SeedClass.abc(), staticResults[1]);
+  }
+
+  @Test
+  @SuppressWarnings("unchecked")
+  void testAsInterface() {
+    Reflexion reflexion = Reflexion.on(SeedClass.class);
+    SeedClass seed = new SeedClass(1, 2D, true, "seed");
+
+    MethodAccessor<Method> getStr = reflexion.findMethod("getStr").orElseThrow(IllegalStateException::new);
+    Function<SeedClass, String> getter = getStr.asInterface(Function.class);
+    Assertions.assertEquals("seed", getter.apply(seed));
+
+    MethodAccessor<Method> abc = reflexion
+      .findMethod("abc", String.class, SeedClass.class)
+      .orElseThrow(IllegalStateException::new);
+    BiFunction<String, SeedClass, String> joiner = abc.asInterface(BiFunction.class);
+    Assertions.assertEquals("Hello // seed", joiner.apply("Hello", seed));
+
+    // the receiver is taken from the binding
+    MethodAccessor<Method> append = Reflexion.onBound(seed)
+      .findMethod("appendToStr", String.class)
+      .orElseThrow(IllegalStateException::new);
+    UnaryOperator<String> appender = append.asInterface(UnaryOperator.class);
+    Assertions.assertEquals("seed :)", appender.apply(":)"));
+
+    MethodAccessor<Constructor<?>> ctor = reflexion
+      .findConstructor(double.class, String.class)
+      .orElseThrow(IllegalStateException::new);
+    BiFunction<Double, String, SeedClass> factory = ctor.asInterface(BiFunction.class);
+    Assertions.assertEquals("ctor", factory.apply(5D, "ctor").getStr());
+    Assertions.assertEquals(5D, factory.apply(5D, "ctor").getD());
+
+    Assertions.assertThrows(IllegalArgumentException.class, () -> getStr.asInterface(Runnable.class));
+    Assertions.assertThrows(IllegalArgumentException.class, () -> getStr.asInterface(Object.class));
+    Assertions.assertThrows(IllegalArgumentException.class, () -> append.asInterface(Supplier.class));
+  }
 }
@@ -0,0 +1,94 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+class ReflexionCopierTest {
+
+  @Test
+  void testCopyIncludesSuperClassFields() {
+    SeedClass source = new SeedClass(1234, 2D, true, "World");
+    Reflexion.on(SeedSuperClass.class).findField("a").ifPresent(accessor -> accessor.setValue(source, "Hello"));
+    Reflexion.on(SeedSuperClass.class).findField("c").ifPresent(accessor -> accessor.setInt(source, 42));
+
+    SeedClass target = new SeedClass(0, 0D, false, null);
+    ReflexionCopier<SeedClass> copier = Reflexion.on(SeedClass.class).copier();
+    copier.copy(source, target);
+
+    // final fields of the class
+    Assertions.assertEquals(1234, target.getI());
+    Assertions.assertEquals(2D, target.getD());
+    Assertions.assertTrue(target.isB());
+    Assertions.assertEquals("World", target.getStr());
+
+    // private fields of the super class
+    Assertions.assertEquals("Hello", target.getA());
+    Assertions.assertEquals(42, target.getC());
+  }
+
+  @Test
+  void testClone() {
+    SeedClass source = new SeedClass(1234, 2D, true, "World");
+    ReflexionCopier<SeedClass> copier = Reflexion.on(SeedClass.class).copier();
+    Assertions.assertTrue(copier.canClone());
+
+    SeedClass clone = copier.clone(source);
+    Assertions.assertNotSame(source, clone);
+    Assertions.assertEquals(1234, clone.getI());
+    Assertions.assertEquals("World", clone.getStr());
+  }
+
+  @Test
+  void testCopierIsCached() {
+    ReflexionCopier<SeedClass> copier = Reflexion.on(SeedClass.class).copier();
+    Assertions.assertSame(copier, Reflexion.on(SeedClass.class).copier());
+    Assertions.assertSame(copier, Reflexion.on(SeedClass.class).bind(new SeedClass(1, 2D, true, "World")).copier());
+  }
+
+  @Test
+  void testCloneWithoutNoArgsConstructor() {
+    ReflexionCopier<NoArgsMissing> copier = Reflexion.on(NoArgsMissing.class).copier();
+    Assertions.assertFalse(copier.canClone());
+    Assertions.assertEquals(1, copier.getFieldCount());
+    Assertions.assertThrows(IllegalStateException.class, () -> copier.clone(new NoArgsMissing("World")));
+
+    NoArgsMissing target = new NoArgsMissing("Hello");
+    copier.copy(new NoArgsMissing("World"), target);
+    Assertions.assertEquals("World", target.value);
+  }
+
+  private static final class NoArgsMissing {
+
+    private static final String CONSTANT = "Constant";
+
+    private final String value;
+
+    public NoArgsMissing(String value) {
+      this.value = value;
+    }
+  }
+}
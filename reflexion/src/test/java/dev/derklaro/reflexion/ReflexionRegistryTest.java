@@ -0,0 +1,244 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.matcher.FieldMatcher;
+import dev.derklaro.reflexion.matcher.MethodMatcher;
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+class ReflexionRegistryTest {
+
+  @Test
+  void testMembersAreSharedBetweenInstances() {
+    Reflexion first = Reflexion.on(SeedClass.class);
+    Reflexion second = Reflexion.on(SeedClass.class, null, new BareAccessorFactory());
+
+    Assertions.assertTrue(first.findField("str").isPresent());
+    Assertions.assertTrue(second.findField("str").isPresent());
+
+    ReflexionRegistry.ClassMembers members = ReflexionRegistry.lookup(SeedClass.class);
+    Assertions.assertSame(members, ReflexionRegistry.lookup(SeedClass.class));
+    Assertions.assertSame(members.getFields(), members.getFields());
+    Assertions.assertEquals(10, members.getFields().size());
+  }
+
+  @Test
+  void testInvalidate() {
+    ReflexionRegistry.ClassMembers members = ReflexionRegistry.lookup(SeedSuperClass.class);
+    ReflexionRegistry.invalidate(SeedSuperClass.class);
+
+    ReflexionRegistry.ClassMembers newMembers = ReflexionRegistry.lookup(SeedSuperClass.class);
+    Assertions.assertNotSame(members, newMembers);
+    Assertions.assertEquals(members.getMethods(), newMembers.getMethods());
+  }
+
+  @Test
+  void testMemberCachesAreUnmodifiable() {
+    ReflexionRegistry.ClassMembers members = ReflexionRegistry.lookup(SeedClass.class);
+    Assertions.assertThrows(UnsupportedOperationException.class, () -> members.getConstructors().clear());
+  }
+
+  @Test
+  void testAccessorsAreCached() {
+    Reflexion reflexion = Reflexion.on(SeedClass.class);
+
+    FieldAccessor field = reflexion.findField("WORLD").orElse(null);
+    Assertions.assertNotNull(field);
+    Assertions.assertSame(field, reflexion.findField("WORLD").orElse(null));
+    Assertions.assertSame(field, Reflexion.on(SeedClass.class).findField("WORLD").orElse(null));
+
+    MethodAccessor<?> method = reflexion.findMethod("getStr").orElse(null);
+    Assertions.assertNotNull(method);
+    Assertions.assertSame(method, reflexion.findMethod("getStr").orElse(null));
+
+    MethodAccessor<?> constructor = reflexion.findConstructor(double.class, String.class).orElse(null);
+    Assertions.assertNotNull(constructor);
+    Assertions.assertSame(constructor, reflexion.findConstructor(double.class, String.class).orElse(null));
+  }
+
+  @Test
+  void testAccessorsAreCachedPerFactory() {
+    FieldAccessor first = Reflexion.on(SeedClass.class).findField("WORLD").orElse(null);
+    Reflexion bareReflexion = Reflexion.on(SeedClass.class, null, new BareAccessorFactory());
+    FieldAccessor second = bareReflexion.findField("WORLD").orElse(null);
+
+    Assertions.assertNotNull(first);
+    Assertions.assertNotNull(second);
+    Assertions.assertNotSame(first, second);
+  }
+
+  @Test
+  void testBoundAccessorsUseBinding() {
+    SeedClass first = new SeedClass(1, 2, true, "first");
+    SeedClass second = new SeedClass(1, 2, true, "second");
+
+    FieldAccessor firstAcc = Reflexion.onBound(first).findField("str").orElse(null);
+    FieldAccessor secondAcc = Reflexion.onBound(second).findField("str").orElse(null);
+
+    Assertions.assertNotNull(firstAcc);
+    Assertions.assertNotNull(secondAcc);
+    Assertions.assertEquals("first", firstAcc.getValue().getOrElse(null));
+    Assertions.assertEquals("second", secondAcc.getValue().getOrElse(null));
+    Assertions.assertSame(first, firstAcc.getReflexion().getBinding());
+
+    MethodAccessor<?> method = Reflexion.onBound(second).findMethod("appendToStr", String.class).orElse(null);
+    Assertions.assertNotNull(method);
+    Assertions.assertEquals("second :)", method.invokeWithArgs(":)").getOrElse(null));
+  }
+
+  @Test
+  void testLazyLookupsMatchPopulatedLookups() throws Exception {
+    ReflexionRegistry.invalidate(SeedClass.class);
+    ReflexionRegistry.ClassMembers lazy = ReflexionRegistry.lookup(SeedClass.class);
+
+    // resolved while travelling the hierarchy, the member caches are not populated
+    Assertions.assertEquals(SeedClass.class.getDeclaredField("str"), lazy.findField("str"));
+    Assertions.assertEquals(SeedSuperClass.class.getDeclaredField("a"), lazy.findField("a"));
+    Assertions.assertEquals(SeedClass.class.getDeclaredMethod("abc"), lazy.findMethod("abc", new Class<?>[0]));
+    Assertions.assertEquals(
+      SeedClass.class.getDeclaredConstructor(),
+      lazy.findConstructor(new Class<?>[0]));
+    Assertions.assertEquals(
+      SeedClass.class.getDeclaredMethod("abc"),
+      lazy.findMethod(MethodMatcher.newMatcher().hasName("abc").hasModifier(Modifier.PUBLIC).compile()));
+
+    // misses populate the caches and use them afterwards
+    Assertions.assertNull(lazy.findField("gone"));
+    Assertions.assertNull(lazy.findField(FieldMatcher.newMatcher().hasName("gone").compile()));
+    Assertions.assertEquals(SeedSuperClass.class.getDeclaredField("a"), lazy.findField("a"));
+    Assertions.assertEquals(
+      SeedClass.class.getDeclaredField("str"),
+      lazy.findField(FieldMatcher.newMatcher().hasName("str").compile()));
+  }
+
+  @Test
+  void testConcurrentPopulationComputesOnce() throws Exception {
+    ReflexionRegistry.invalidate(SeedClass.class);
+    ReflexionRegistry.ClassMembers members = ReflexionRegistry.lookup(SeedClass.class);
+
+    int threads = 8;
+    CountDownLatch start = new CountDownLatch(1);
+    ExecutorService executor = Executors.newFixedThreadPool(threads);
+    try {
+      List<Future<Set<Field>>> results = new ArrayList<>();
+      for (int i = 0; i < threads; i++) {
+        results.add(executor.submit(() -> {
+          start.await();
+          return members.getFields();
+        }));
+      }
+
+      start.countDown();
+      Set<Field> first = results.get(0).get();
+      for (Future<Set<Field>> result : results) {
+        Assertions.assertSame(first, result.get());
+      }
+    } finally {
+      executor.shutdownNow();
+    }
+  }
+
+  @Test
+  void testPreloadFillsSharedCaches() throws Exception {
+    ReflexionRegistry.invalidate(SeedClass.class);
+    TargetSpec spec = TargetSpec.of(SeedClass.class.getName())
+      .withFields("str")
+      .withMethods("abc")
+      .withConstructors();
+    TargetSpec missing = TargetSpec.of("dev.derklaro.reflexion.DoesNotExist").withFields("str");
+
+    ExecutorService executor = Executors.newFixedThreadPool(2);
+    try {
+      Map<String, Reflexion> preloaded = Reflexion.preload(null, Arrays.asList(spec, missing), executor).get();
+      Assertions.assertEquals(1, preloaded.size());
+      Assertions.assertSame(SeedClass.class, preloaded.get(SeedClass.class.getName()).getWrappedClass());
+    } finally {
+      executor.shutdownNow();
+    }
+
+    ReflexionRegistry.ClassMembers members = ReflexionRegistry.lookup(SeedClass.class);
+    AccessorFactory factory = Reflexion.ACCESSOR_FACTORY;
+    Assertions.assertNotNull(members.getAccessor(factory, SeedClass.class.getDeclaredField("str")));
+    Assertions.assertNotNull(members.getAccessor(factory, SeedClass.class.getDeclaredMethod("abc")));
+    Assertions.assertNotNull(members.getAccessor(
+      factory,
+      SeedClass.class.getDeclaredMethod("abc", String.class, SeedClass.class)));
+    Assertions.assertNotNull(members.getAccessor(factory, SeedClass.class.getDeclaredConstructor()));
+  }
+
+  @Test
+  void testCacheUsage() {
+    ReflexionRegistry.invalidate(SeedSuperClass.class);
+    ReflexionCacheUsage before = Reflexion.cacheUsage();
+
+    Assertions.assertTrue(Reflexion.on(SeedSuperClass.class).findMethod("getA").isPresent());
+    ReflexionCacheUsage populated = Reflexion.cacheUsage();
+    Assertions.assertTrue(populated.getCachedClasses() > before.getCachedClasses());
+    Assertions.assertTrue(populated.getCachedMembers() > before.getCachedMembers());
+    Assertions.assertTrue(populated.getCachedAccessors() > before.getCachedAccessors());
+    Assertions.assertTrue(populated.getEstimatedSize() > before.getEstimatedSize());
+
+    ReflexionRegistry.invalidate(SeedSuperClass.class);
+    ReflexionCacheUsage invalidated = Reflexion.cacheUsage();
+    Assertions.assertEquals(populated.getCachedClasses() - 1, invalidated.getCachedClasses());
+    Assertions.assertTrue(invalidated.getCachedAccessors() < populated.getCachedAccessors());
+  }
+
+  @Test
+  void testBoundInstancesAreViews() throws Exception {
+    SeedClass instance = new SeedClass(1, 2, true, "view");
+    Reflexion unbound = Reflexion.on(SeedClass.class);
+    Assertions.assertSame(unbound, Reflexion.on(SeedClass.class));
+    Assertions.assertSame(unbound, Reflexion.on(instance));
+
+    Reflexion bound = Reflexion.onBound(instance);
+    Assertions.assertNotSame(unbound, bound);
+    Assertions.assertSame(instance, bound.getBinding());
+    Assertions.assertSame(unbound, bound.bind(null));
+
+    FieldAccessor accessor = bound.findField("str").orElse(null);
+    Assertions.assertNotNull(accessor);
+    Assertions.assertEquals("view", accessor.getValue().getOrElse(null));
+
+    // the bound view wraps the accessor cached for the unbound instance
+    ReflexionRegistry.ClassMembers members = ReflexionRegistry.lookup(SeedClass.class);
+    FieldAccessor shared = members.getAccessor(Reflexion.ACCESSOR_FACTORY, SeedClass.class.getDeclaredField("str"));
+    Assertions.assertSame(shared, unbound.findField("str").orElse(null));
+    Assertions.assertSame(unbound, shared.getReflexion());
+  }
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
+import dev.derklaro.reflexion.matcher.FieldMatcher;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+class ReflexionStatsTest {
+
+  @Test
+  void testStatsAreCollected() {
+    Assertions.assertTrue(Reflexion.stats().isEnabled());
+
+    ReflexionRegistry.invalidate(SeedClass.class);
+    Reflexion.resetStats();
+    Assertions.assertNull(Reflexion.stats().getClassStats(SeedClass.class));
+
+    Reflexion reflexion = Reflexion.on(SeedClass.class, null, new MethodHandleAccessorFactory());
+    FieldAccessor accessor = reflexion.findField("str").orElseThrow(IllegalStateException::new);
+    Assertions.assertSame(accessor, reflexion.findField("str").orElseThrow(IllegalStateException::new));
+    reflexion.findFields(FieldMatcher.newMatcher());
+
+    // a getter on a missing instance fails
+    Assertions.assertFalse(accessor.getValue().wasSuccessful());
+
+    ReflexionStats stats = Reflexion.stats();
+    Assertions.assertTrue(stats.getFieldWraps() >= 1);
+    Assertions.assertTrue(stats.getHandleBuildTime().toNanos() > 0);
+    Assertions.assertTrue(stats.getExceptionalResults() >= 1);
+
+    ReflexionStats.ClassStats classStats = stats.getClassStats(SeedClass.class);
+    Assertions.assertNotNull(classStats);
+    Assertions.assertTrue(classStats.getAccessorCacheHits() >= 1);
+    Assertions.assertTrue(classStats.getAccessorCacheMisses() >= 1);
+    Assertions.assertEquals(1, classStats.getMemberCacheMisses());
+  }
+}
@@ -0,0 +1,91 @@
+/*
+ * This file is part of reflexion, licensed under the MIT License (MIT).
+ *
+ * Copyright (c) 2022 Pasqual K., Aldin S. and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package dev.derklaro.reflexion;
+
+import dev.derklaro.reflexion.internal.bare.BareAccessorFactory;
+import dev.derklaro.reflexion.internal.bytecode.BytecodeAccessorFactory;
+import dev.derklaro.reflexion.internal.handles.MethodHandleAccessorFactory;
+import dev.derklaro.reflexion.internal.unsafe.UnsafeAccessorFactory;
+import java.util.Arrays;
+import java.util.List;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Assumptions;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+class UnsafeAccessorFactoryTest {
+
+  private UnsafeAccessorFactory factory;
+
+  @BeforeEach
+  void setUp() {
+    this.factory = new UnsafeAccessorFactory();
+    Assumptions.assumeTrue(this.factory.isAvailable(), "unsafe is not available");
+  }
+
+  @Test
+  void testFactoryRanking() {
+    AccessorFactory handles = new MethodHandleAccessorFactory();
+    List<AccessorFactory> factories = Arrays.asList(new BareAccessorFactory(), handles, this.factory);
+    factories.sort(null);
+    Assertions.assertSame(UnsafeAccessorFactory.isPreferredJvm() ? this.factory : handles, factories.get(0));
+    Assertions.assertEquals(-this.factory.compareTo(handles), handles.compareTo(this.factory));
+
+    // generated accessors are always preferred
+    AccessorFactory bytecode = new BytecodeAccessorFactory();
+    Assumptions.assumeTrue(bytecode.isAvailable());
+    Assertions.assertTrue(bytecode.compareTo(this.factory) < 0);
+    Assertions.assertTrue(this.factory.compareTo(bytecode) > 0);
+  }
+
+  @Test
+  void testFieldAccess() {
+    SeedClass seedClass = new SeedClass(1, 2D, true, "World");
+    Reflexion reflexion = Reflexion.on(SeedClass.class, null, this.factory);
+
+    // final fields are written at their offset as well
+    FieldAccessor intAccessor = reflexion.findField("i").orElse(null);
+    Assertions.assertNotNull(intAccessor);
+    intAccessor.setInt(seedClass, 5);
+    Assertions.assertEquals(5, seedClass.getI());
+    Assertions.assertEquals(5L, intAccessor.getLong(seedClass));
+    Assertions.assertTrue(intAccessor.setValue(seedClass, (short) 6).wasSuccessful());
+    Assertions.assertEquals(6, intAccessor.getInt(seedClass));
+    Assertions.assertTrue(intAccessor.setValue(seedClass, null).wasExceptional());
+
+    FieldAccessor strAccessor = reflexion.findField("str").orElse(null);
+    Assertions.assertNotNull(strAccessor);
+    Assertions.assertTrue(strAccessor.setValue(seedClass, 5).wasExceptional());
+    Assertions.assertTrue(strAccessor.getValue("Not a seed class").wasExceptional());
+    Assertions.assertTrue(strAccessor.getValue(null).wasExceptional());
+    Assertions.assertTrue(strAccessor.setValue(seedClass, "Hello").wasSuccessful());
+    Assertions.assertEquals("Hello", strAccessor.getValue(seedClass).getOrElse(null));
+
+    FieldAccessor staticAccessor = reflexion.findField("WORLD").orElse(null);
+    Assertions.assertNotNull(staticAccessor);
+    Assertions.assertEquals("World", staticAccessor.getValue().getOrElse(null));
+    Assertions.assertEquals("World", staticAccessor.getValueDirect("ignored for static fields"));
+  }
+}
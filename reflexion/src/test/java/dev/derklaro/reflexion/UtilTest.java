@@ -24,7 +24,9 @@
 
 package dev.derklaro.reflexion;
 
+import dev.derklaro.reflexion.internal.util.Primitives;
 import dev.derklaro.reflexion.internal.util.Util;
+import java.lang.reflect.Field;
 import java.util.Arrays;
 import java.util.Collection;
 import java.util.Collections;
@@ -50,6 +52,23 @@ void testMapFromArray() {
     Assertions.assertEquals("!", multiple.get(2));
   }
 
+  @Test
+  void testPrimitiveUnboxing() {
+    Assertions.assertEquals(5, Primitives.toInt(5));
+    Assertions.assertEquals(5, Primitives.toInt((short) 5));
+    Assertions.assertEquals('a', Primitives.toInt('a'));
+    Assertions.assertEquals(5L, Primitives.toLong(5));
+    Assertions.assertEquals(5F, Primitives.toFloat(5L));
+    Assertions.assertEquals(1.5D, Primitives.toDouble(1.5F));
+    Assertions.assertTrue(Primitives.toBoolean(true));
+
+    // narrowing conversions and null are rejected
+    Assertions.assertThrows(IllegalArgumentException.class, () -> Primitives.toInt(5L));
+    Assertions.assertThrows(IllegalArgumentException.class, () -> Primitives.toShort('a'));
+    Assertions.assertThrows(IllegalArgumentException.class, () -> Primitives.toLong(1.5D));
+    Assertions.assertThrows(IllegalArgumentException.class, () -> Primitives.toBoolean(null));
+  }
+
   @Test
   void testFastModulo() {
     Assertions.assertEquals(4 % 2, Util.fastModulo(4, 2));
@@ -95,4 +114,18 @@ void testFilterAndMap() {
     Assertions.assertEquals('W', iterator.next());
     Assertions.assertEquals('H', iterator.next());
   }
+
+  @Test
+  void testInstanceAndValueChecks() throws Exception {
+    Field field = SeedClass.class.getDeclaredField("str");
+    SeedClass instance = new SeedClass(1, 2D, true, "World");
+
+    Assertions.assertSame(instance, Util.checkInstance(field, SeedClass.class, instance));
+    Assertions.assertThrows(NullPointerException.class, () -> Util.checkInstance(field, SeedClass.class, null));
+    Assertions.assertThrows(IllegalArgumentException.class, () -> Util.checkInstance(field, SeedClass.class, "World"));
+
+    Assertions.assertNull(Util.checkFieldValue(field, null));
+    Assertions.assertEquals("Hello", Util.checkFieldValue(field, "Hello"));
+    Assertions.assertThrows(IllegalArgumentException.class, () -> Util.checkFieldValue(field, 5));
+  }
 }
@@ -24,4 +24,4 @@
 
 rootProject.name = "reflexion-parent"
 
-include("native", "reflexion")
+include("native", "reflexion", "reflexion-processor")